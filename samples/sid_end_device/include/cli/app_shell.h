@@ -186,6 +186,32 @@
 
 #define CMD_SID_SDK_CONFIG_DESCRIPTION "Print sid sdk config"
 
+#define CMD_SID_TIMER_STATS_DESCRIPTION                                                            \
+	"<reset>\n"                                                                               \
+	"print Sidewalk timer statistics, lateness per priority class, critical region hold time and callback duration.\n"\
+	"Histogram bucket n counts values from 2^(n-1) to 2^n us.\n"                              \
+	"   reset - clear the statistics"
+
+#define CMD_SID_CRIT_STATS_DESCRIPTION                                                             \
+	"<reset>\n"                                                                               \
+	"print call sites with the longest Sidewalk critical region hold time.\n"                 \
+	"   reset - clear the statistics"
+
+#define CMD_SID_CRYPTO_DESCRIPTION "Sidewalk cryptography"
+
+#define CMD_SID_CRYPTO_STATS_DESCRIPTION                                                           \
+	"<reset>\n"                                                                               \
+	"print calls, bytes, failures and latency of the Sidewalk cryptography per algorithm.\n"  \
+	"Histogram bucket n counts values from 2^(n-1) to 2^n cycles.\n"                          \
+	"   reset - clear the statistics"
+
+#define CMD_SID_STORAGE_STATS_DESCRIPTION                                                          \
+	"<reset|save>\n"                                                                          \
+	"print flash writes, deletes and commits of the Sidewalk storage per group,\n"            \
+	"the most written records, other flash users and backend sector erases.\n"                \
+	"   reset - clear the statistics, in RAM and in settings\n"                               \
+	"   save  - save the statistics to settings now"
+
 #define CMD_NORDIC_DFU_ARG_REQUIRED 1
 #define CMD_NORDIC_DFU_ARG_OPTIONAL 0
 
@@ -235,6 +261,14 @@
 #define CMD_SID_SDK_VERSION_DESCRIPTION_ARG_OPTIONAL 0
 #define CMD_SID_SDK_CONFIG_DESCRIPTION_ARG_REQUIRED 1
 #define CMD_SID_SDK_CONFIG_DESCRIPTION_ARG_OPTIONAL 0
+#define CMD_SID_TIMER_STATS_ARG_REQUIRED 1
+#define CMD_SID_TIMER_STATS_ARG_OPTIONAL 1
+#define CMD_SID_CRIT_STATS_ARG_REQUIRED 1
+#define CMD_SID_CRIT_STATS_ARG_OPTIONAL 1
+#define CMD_SID_CRYPTO_STATS_ARG_REQUIRED 1
+#define CMD_SID_CRYPTO_STATS_ARG_OPTIONAL 1
+#define CMD_SID_STORAGE_STATS_ARG_REQUIRED 1
+#define CMD_SID_STORAGE_STATS_ARG_OPTIONAL 1
 
 int cmd_nordic_dfu(const struct shell *shell, int32_t argc, const char **argv);
 
@@ -270,6 +304,22 @@ int cmd_sid_set_rsp_id(const struct shell *shell, int32_t argc, const char **arg
 int cmd_sid_sdk_version(const struct shell *shell, int32_t argc, const char **argv);
 int cmd_sid_sdk_config(const struct shell *shell, int32_t argc, const char **argv);
 
+#ifdef CONFIG_SIDEWALK_TIMER_STATS
+int cmd_sid_timer_stats(const struct shell *shell, int32_t argc, const char **argv);
+#endif
+
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_PROFILER
+int cmd_sid_crit_stats(const struct shell *shell, int32_t argc, const char **argv);
+#endif
+
+#ifdef CONFIG_SIDEWALK_CRYPTO_STATS
+int cmd_sid_crypto_stats(const struct shell *shell, int32_t argc, const char **argv);
+#endif
+
+#ifdef CONFIG_SIDEWALK_STORAGE_STATS
+int cmd_sid_storage_stats(const struct shell *shell, int32_t argc, const char **argv);
+#endif
+
 #ifdef CONFIG_SIDEWALK_TRACE_HEAP
 int cmd_sid_print_heap_stats(const struct shell *shell, int32_t argc, const char **argv);
 void print_open_buffers(void);
@@ -26,6 +26,21 @@
 #if defined(CONFIG_SIDEWALK_DFU_SERVICE_BLE)
 #include <sidewalk_dfu/nordic_dfu.h>
 #endif
+#if defined(CONFIG_SIDEWALK_TIMER_STATS)
+#include <sid_timer_stats.h>
+#endif
+#if defined(CONFIG_SIDEWALK_TIMER_COALESCING)
+#include <sid_timer_coalescing.h>
+#endif
+#if defined(CONFIG_SIDEWALK_CRITICAL_REGION_PROFILER)
+#include <sid_critical_region_profiler.h>
+#endif
+#if defined(CONFIG_SIDEWALK_CRYPTO_STATS)
+#include <sid_crypto_stats.h>
+#endif
+#if defined(CONFIG_SIDEWALK_STORAGE_STATS)
+#include <sid_storage_stats.h>
+#endif
 
 #define CLI_CMD_OPT_LINK_BLE 1
 #define CLI_CMD_OPT_LINK_FSK 2
@@ -78,6 +93,14 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 
 	SHELL_SUBCMD_SET_END);
 
+#ifdef CONFIG_SIDEWALK_CRYPTO_STATS
+SHELL_STATIC_SUBCMD_SET_CREATE(
+	sub_sid_crypto,
+	SHELL_CMD_ARG(stats, NULL, CMD_SID_CRYPTO_STATS_DESCRIPTION, cmd_sid_crypto_stats,
+		      CMD_SID_CRYPTO_STATS_ARG_REQUIRED, CMD_SID_CRYPTO_STATS_ARG_OPTIONAL),
+	SHELL_SUBCMD_SET_END);
+#endif
+
 SHELL_STATIC_SUBCMD_SET_CREATE(
 	sub_services,
 	SHELL_CMD_ARG(nordic_dfu, NULL, CMD_NORDIC_DFU_DESCRIPTION, cmd_nordic_dfu,
@@ -116,6 +139,22 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 	SHELL_CMD_ARG(sdk_config, NULL, CMD_SID_SDK_CONFIG_DESCRIPTION, cmd_sid_sdk_config,
 		      CMD_SID_SDK_CONFIG_DESCRIPTION_ARG_REQUIRED,
 		      CMD_SID_SDK_CONFIG_DESCRIPTION_ARG_OPTIONAL),
+#ifdef CONFIG_SIDEWALK_TIMER_STATS
+	SHELL_CMD_ARG(timer_stats, NULL, CMD_SID_TIMER_STATS_DESCRIPTION, cmd_sid_timer_stats,
+		      CMD_SID_TIMER_STATS_ARG_REQUIRED, CMD_SID_TIMER_STATS_ARG_OPTIONAL),
+#endif
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_PROFILER
+	SHELL_CMD_ARG(crit_stats, NULL, CMD_SID_CRIT_STATS_DESCRIPTION, cmd_sid_crit_stats,
+		      CMD_SID_CRIT_STATS_ARG_REQUIRED, CMD_SID_CRIT_STATS_ARG_OPTIONAL),
+#endif
+#ifdef CONFIG_SIDEWALK_CRYPTO_STATS
+	SHELL_CMD(crypto, &sub_sid_crypto, CMD_SID_CRYPTO_DESCRIPTION, NULL),
+#endif
+#ifdef CONFIG_SIDEWALK_STORAGE_STATS
+	SHELL_CMD_ARG(storage_stats, NULL, CMD_SID_STORAGE_STATS_DESCRIPTION,
+		      cmd_sid_storage_stats, CMD_SID_STORAGE_STATS_ARG_REQUIRED,
+		      CMD_SID_STORAGE_STATS_ARG_OPTIONAL),
+#endif
 #ifdef CONFIG_SIDEWALK_TRACE_HEAP
 	SHELL_CMD_ARG(heap_stat, NULL, "print heap statistics", cmd_sid_print_heap_stats, 1, 0),
 #endif
@@ -1084,6 +1123,190 @@ int cmd_sid_sdk_config(const struct shell *shell, int32_t argc, const char **arg
 	return 0;
 }
 
+#ifdef CONFIG_SIDEWALK_TIMER_STATS
+static void timer_stats_hist_print(const struct shell *shell, const char *name,
+				   const struct sid_timer_stats_hist *hist)
+{
+	shell_info(shell, "%s: count %u, avg %llu us, max %u us", name, hist->count,
+		   hist->count ? (hist->sum_us / hist->count) : 0, hist->max_us);
+	for (int i = 0; i < SID_TIMER_STATS_HIST_BUCKETS; i++) {
+		if (!hist->buckets[i]) {
+			continue;
+		}
+		if (i == SID_TIMER_STATS_HIST_BUCKETS - 1) {
+			shell_print(shell, "  >=%u us: %u", 1u << (i - 1), hist->buckets[i]);
+		} else {
+			shell_print(shell, "  <%u us: %u", 1u << i, hist->buckets[i]);
+		}
+	}
+}
+
+int cmd_sid_timer_stats(const struct shell *shell, int32_t argc, const char **argv)
+{
+	struct sid_timer_stats stats;
+
+	CHECK_ARGUMENT_COUNT(argc, CMD_SID_TIMER_STATS_ARG_REQUIRED,
+			     CMD_SID_TIMER_STATS_ARG_OPTIONAL);
+
+	if (argc == 2) {
+		if (strcmp(argv[1], "reset")) {
+			return -EINVAL;
+		}
+		sid_timer_stats_reset();
+#if defined(CONFIG_SIDEWALK_TIMER_COALESCING)
+		sid_timer_coalescing_reset();
+#endif
+		return 0;
+	}
+
+	sid_timer_stats_get(&stats);
+	shell_info(shell, "timer events: %u", stats.events);
+	timer_stats_hist_print(shell, "precise lateness",
+			       &stats.lateness[SID_PAL_TIMER_PRIO_CLASS_PRECISE]);
+	timer_stats_hist_print(shell, "lowpower lateness",
+			       &stats.lateness[SID_PAL_TIMER_PRIO_CLASS_LOWPOWER]);
+	timer_stats_hist_print(shell, "critical region", &stats.lock_hold);
+	timer_stats_hist_print(shell, "callback", &stats.callback);
+#if defined(CONFIG_SIDEWALK_TIMER_COALESCING)
+	shell_info(shell, "wakeups avoided: %u", sid_timer_coalescing_wakeups_avoided());
+#endif
+	return 0;
+}
+#endif
+
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_PROFILER
+int cmd_sid_crit_stats(const struct shell *shell, int32_t argc, const char **argv)
+{
+	struct sid_critical_region_profile profile;
+
+	CHECK_ARGUMENT_COUNT(argc, CMD_SID_CRIT_STATS_ARG_REQUIRED,
+			     CMD_SID_CRIT_STATS_ARG_OPTIONAL);
+
+	if (argc == 2) {
+		if (strcmp(argv[1], "reset")) {
+			return -EINVAL;
+		}
+		sid_critical_region_profiler_reset();
+		return 0;
+	}
+
+	sid_critical_region_profiler_get(&profile);
+	shell_info(shell, "critical regions: %u, call sites evicted: %u", profile.count,
+		   profile.evicted);
+	/* Resolve the callers with addr2line on zephyr.elf. */
+	for (uint32_t i = 0; i < profile.sites_num; i++) {
+		const struct sid_critical_region_site *site = &profile.sites[i];
+
+		shell_print(shell, "  0x%08lx: count %u, avg %u us, max %u us (%u cyc)",
+			    (unsigned long)site->caller, site->count,
+			    k_cyc_to_us_floor32((uint32_t)(site->sum_cycles / site->count)),
+			    k_cyc_to_us_floor32(site->max_cycles), site->max_cycles);
+	}
+	return 0;
+}
+#endif
+
+#ifdef CONFIG_SIDEWALK_CRYPTO_STATS
+int cmd_sid_crypto_stats(const struct shell *shell, int32_t argc, const char **argv)
+{
+	static struct sid_crypto_stats stats;
+
+	CHECK_ARGUMENT_COUNT(argc, CMD_SID_CRYPTO_STATS_ARG_REQUIRED,
+			     CMD_SID_CRYPTO_STATS_ARG_OPTIONAL);
+
+	if (argc == 2) {
+		if (strcmp(argv[1], "reset")) {
+			return -EINVAL;
+		}
+		sid_crypto_stats_reset();
+		return 0;
+	}
+
+	sid_crypto_stats_get(&stats);
+	for (int algo = 0; algo < SID_CRYPTO_STATS_ALGO_NUM; algo++) {
+		const struct sid_crypto_stats_algo_stats *entry = &stats.algo[algo];
+
+		if (!entry->calls) {
+			continue;
+		}
+		shell_info(shell, "%s: calls %u, failures %u, bytes %llu, avg %u us, max %u us",
+			   sid_crypto_stats_algo_name(algo), entry->calls, entry->failures,
+			   entry->bytes,
+			   k_cyc_to_us_floor32((uint32_t)(entry->latency.sum_cycles / entry->calls)),
+			   k_cyc_to_us_floor32(entry->latency.max_cycles));
+		for (int i = 0; i < SID_CRYPTO_STATS_HIST_BUCKETS; i++) {
+			if (!entry->latency.buckets[i]) {
+				continue;
+			}
+			if (i == SID_CRYPTO_STATS_HIST_BUCKETS - 1) {
+				shell_print(shell, "  >=%u cyc: %u", 1u << (i - 1),
+					    entry->latency.buckets[i]);
+			} else {
+				shell_print(shell, "  <%u cyc: %u", 1u << i, entry->latency.buckets[i]);
+			}
+		}
+	}
+	return 0;
+}
+#endif
+
+#ifdef CONFIG_SIDEWALK_STORAGE_STATS
+int cmd_sid_storage_stats(const struct shell *shell, int32_t argc, const char **argv)
+{
+	static struct sid_storage_stats stats;
+
+	CHECK_ARGUMENT_COUNT(argc, CMD_SID_STORAGE_STATS_ARG_REQUIRED,
+			     CMD_SID_STORAGE_STATS_ARG_OPTIONAL);
+
+	if (argc == 2) {
+		if (!strcmp(argv[1], "reset")) {
+			return sid_storage_stats_reset() == SID_ERROR_NONE ? 0 : -EIO;
+		}
+		if (!strcmp(argv[1], "save")) {
+			return sid_storage_stats_save() == SID_ERROR_NONE ? 0 : -EIO;
+		}
+		return -EINVAL;
+	}
+
+	sid_storage_stats_get(&stats);
+	for (int i = 0; i < SID_STORAGE_STATS_GROUPS; i++) {
+		const struct sid_storage_stats_group *entry = &stats.groups[i];
+
+		if (!entry->writes && !entry->deletes) {
+			continue;
+		}
+		shell_info(shell, "group %04x: writes %u, bytes %llu, deletes %u, commits %u",
+			   entry->group, entry->writes, entry->bytes, entry->deletes,
+			   entry->commits);
+	}
+	if (stats.other.writes || stats.other.deletes) {
+		shell_info(shell, "other groups: writes %u, bytes %llu, deletes %u, commits %u",
+			   stats.other.writes, stats.other.bytes, stats.other.deletes,
+			   stats.other.commits);
+	}
+	for (int i = 0; i < SID_STORAGE_STATS_KEYS; i++) {
+		if (stats.keys[i].writes) {
+			shell_print(shell, "  key %04x/%04x: writes %u", stats.keys[i].group,
+				    stats.keys[i].key, stats.keys[i].writes);
+		}
+	}
+	for (int src = 0; src < SID_STORAGE_STATS_SOURCE_NUM; src++) {
+		const struct sid_storage_stats_source_stats *entry = &stats.source[src];
+
+		if (!entry->writes && !entry->erases) {
+			continue;
+		}
+		shell_info(shell, "%s: writes %u, bytes %llu, erases %u, erased bytes %llu",
+			   sid_storage_stats_source_name(src), entry->writes, entry->bytes,
+			   entry->erases, entry->erased_bytes);
+	}
+	shell_info(shell, "backend: commits %u, gc erases %u, erased bytes %llu, saves %u",
+		   stats.backend.commits, stats.backend.gc_erases, stats.backend.erased_bytes,
+		   stats.saves);
+	return 0;
+}
+#endif
+
 #ifdef CONFIG_SIDEWALK_TRACE_HEAP
 int cmd_sid_print_heap_stats(const struct shell *shell, int32_t argc, const char **argv)
 {
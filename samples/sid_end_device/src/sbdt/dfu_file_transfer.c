@@ -14,10 +14,88 @@
 #include <sid_bulk_data_transfer_api.h>
 #include <zephyr/logging/log.h>
 #include <sid_pal_crypto_ifc.h>
+#include <sid_crypto_stream.h>
 #include <stdio.h>
 
 LOG_MODULE_REGISTER(file_transfer, CONFIG_SIDEWALK_LOG_LEVEL);
 
+/* SHA-256 of the whole image, updated with every received part. */
+static sid_pal_hash_ctx_t image_hash;
+static bool image_hash_active;
+static uint32_t image_hash_offset;
+
+static void log_sha256(const uint8_t *hash_out)
+{
+#define HEX_PRINTER(a, ...) "%02X"
+#define HEX_PRINTER_ARG(a, ...) hash_out[a]
+	char hex_str[32 * 2 + 1] = { 0 };
+	snprintf(hex_str, sizeof(hex_str), LISTIFY(32, HEX_PRINTER, ()),
+		 LISTIFY(32, HEX_PRINTER_ARG, (, )));
+	LOG_INF("SHA256: %s", hex_str);
+}
+
+static void image_hash_abort(void)
+{
+	if (image_hash_active) {
+		(void)sid_pal_crypto_hash_abort(&image_hash);
+		image_hash_active = false;
+	}
+}
+
+static void image_hash_update(uint32_t offset, const uint8_t *data, size_t size)
+{
+	sid_error_t e;
+
+	if (offset == 0) {
+		image_hash_abort();
+		e = sid_pal_crypto_hash_init(&image_hash, SID_PAL_HASH_SHA256);
+		if (e != SID_ERROR_NONE) {
+			LOG_ERR("Failed to start image hash with error %s", SID_ERROR_T_STR(e));
+			return;
+		}
+		image_hash_active = true;
+		image_hash_offset = 0;
+	}
+
+	if (!image_hash_active) {
+		return;
+	}
+
+	if (offset != image_hash_offset) {
+		LOG_WRN("Image hash stopped, expected offset %d, received %d", image_hash_offset,
+			offset);
+		image_hash_abort();
+		return;
+	}
+
+	e = sid_pal_crypto_hash_update(&image_hash, data, size);
+	if (e != SID_ERROR_NONE) {
+		LOG_ERR("Failed to hash received file transfer with error %s", SID_ERROR_T_STR(e));
+		image_hash_active = false;
+		return;
+	}
+	image_hash_offset += size;
+}
+
+static void sidewalk_event_image_hash_finish(sidewalk_ctx_t *sid, void *ctx)
+{
+	uint8_t hash_out[32];
+
+	if (!image_hash_active) {
+		LOG_WRN("No hash of the received image");
+		return;
+	}
+	image_hash_active = false;
+
+	sid_error_t e = sid_pal_crypto_hash_finish(&image_hash, hash_out, sizeof(hash_out));
+	if (e != SID_ERROR_NONE) {
+		LOG_ERR("Failed to hash received image with error %s", SID_ERROR_T_STR(e));
+		return;
+	}
+	LOG_INF("Received image size %d", image_hash_offset);
+	log_sha256(hash_out);
+}
+
 void sidewalk_event_file_transfer(sidewalk_ctx_t *sid, void *ctx)
 {
 	sidewalk_transfer_t *transfer = (sidewalk_transfer_t *)ctx;
@@ -29,30 +107,14 @@ void sidewalk_event_file_transfer(sidewalk_ctx_t *sid, void *ctx)
 	LOG_INF("Received file Id %d; buffer size %d; file offset %d", transfer->file_id,
 		transfer->data_size, transfer->file_offset);
 
-	// print data hash
-	uint8_t hash_out[32];
-	sid_pal_hash_params_t params = { .algo = SID_PAL_HASH_SHA256,
-					 .data = transfer->data,
-					 .data_size = transfer->data_size,
-					 .digest = hash_out,
-					 .digest_size = sizeof(hash_out) };
-
-	sid_error_t e = sid_pal_crypto_hash(&params);
-	if (e != SID_ERROR_NONE) {
-		LOG_ERR("Failed to hash received file transfer with error %s", SID_ERROR_T_STR(e));
-	} else {
-#define HEX_PRINTER(a, ...) "%02X"
-#define HEX_PRINTER_ARG(a, ...) hash_out[a]
-		char hex_str[sizeof(hash_out) * 2 + 1] = { 0 };
-		snprintf(hex_str, sizeof(hex_str), LISTIFY(32, HEX_PRINTER, ()),
-			 LISTIFY(32, HEX_PRINTER_ARG, (, )));
-		LOG_INF("SHA256: %s", hex_str);
-	}
+	image_hash_update(transfer->file_offset, transfer->data, transfer->data_size);
 
+	sid_error_t e;
 	int err = nordic_dfu_img_write(transfer->file_offset, transfer->data, transfer->data_size);
 
 	if (err) {
 		LOG_ERR("Fail to write img %d", err);
+		image_hash_abort();
 		err = nordic_dfu_img_cancel();
 		if (err) {
 			LOG_ERR("Fail to complete dfu %d", err);
@@ -160,8 +222,13 @@ static void on_finalize_request(uint32_t file_id, void *context)
 		LOG_ERR("sid_bulk_data_transfer_finalize returned %s", SID_ERROR_T_STR(ret));
 	}
 
+	// print image hash, after all received parts are hashed
+	int err = sidewalk_event_send(sidewalk_event_image_hash_finish, NULL, NULL);
+	if (err) {
+		LOG_ERR("image hash event send ret %d", err);
+	}
+
 	// request upgrade and reboot
-	int err = 0;
 	err = nordic_dfu_img_finalize();
 	if (err) {
 		LOG_ERR("dfu image finalize fail %d", err);
@@ -178,6 +245,7 @@ static void on_cancel_request(uint32_t file_id, void *context)
 	printk(JSON_NEW_LINE(JSON_OBJ(JSON_NAME(
 		"on_cancel_request", JSON_OBJ(JSON_NAME("file_id", JSON_INT(file_id)))))));
 
+	image_hash_abort();
 	int err = nordic_dfu_img_cancel();
 	if (err) {
 		LOG_ERR("Fail to complete dfu %d", err);
@@ -189,6 +257,7 @@ static void on_error(uint32_t file_id, void *context)
 	printk(JSON_NEW_LINE(JSON_OBJ(
 		JSON_NAME("on_error", JSON_OBJ(JSON_NAME("file_id", JSON_INT(file_id)))))));
 
+	image_hash_abort();
 	int err = nordic_dfu_img_cancel();
 	if (err) {
 		LOG_ERR("Fail to complete dfu %d", err);
@@ -22,6 +22,12 @@
 #ifdef CONFIG_SID_END_DEVICE_PERSISTENT_LINK_MASK
 #include <settings_utils.h>
 #endif /* CONFIG_SID_END_DEVICE_PERSISTENT_LINK_MASK */
+#ifdef CONFIG_SIDEWALK_STORAGE_CACHE
+#include <sid_storage_cache.h>
+#endif /* CONFIG_SIDEWALK_STORAGE_CACHE */
+#ifdef CONFIG_SIDEWALK_STORAGE_STATS
+#include <sid_storage_stats.h>
+#endif /* CONFIG_SIDEWALK_STORAGE_STATS */
 
 #ifdef CONFIG_SIDEWALK_FILE_TRANSFER_DFU
 #include <sbdt/dfu_file_transfer.h>
@@ -368,6 +374,12 @@ void sidewalk_event_exit(sidewalk_ctx_t *sid, void *ctx)
 void sidewalk_event_reboot(sidewalk_ctx_t *sid, void *ctx)
 {
 	LOG_INF("Rebooting...");
+#ifdef CONFIG_SIDEWALK_STORAGE_CACHE
+	(void)sid_storage_cache_sync();
+#endif /* CONFIG_SIDEWALK_STORAGE_CACHE */
+#ifdef CONFIG_SIDEWALK_STORAGE_STATS
+	(void)sid_storage_stats_save();
+#endif /* CONFIG_SIDEWALK_STORAGE_STATS */
 	LOG_PANIC();
 	sys_reboot(SYS_REBOOT_WARM);
 }
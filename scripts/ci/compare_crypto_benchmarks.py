@@ -0,0 +1,88 @@
+# Copyright (c) 2024 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+import argparse
+import json
+import pathlib
+import sys
+
+
+def get_arguments():
+    parser = argparse.ArgumentParser(
+        prog="Compare Sidewalk crypto benchmark logs for performance differences")
+    parser.add_argument("-o", "--old", required=True, type=str, nargs="+",
+                        help="logs of the reference run, e.g. twister handler.log files")
+    parser.add_argument("-n", "--new", required=True, type=str, nargs="+",
+                        help="logs of the compared run")
+    parser.add_argument("-t", "--threshold", default=10.0, type=float,
+                        help="slowdown in percent reported as a regression")
+    parser.add_argument("--md_output", action='store_true')
+    parser.add_argument("-d", "--show_only_diff", action='store_true')
+    return parser
+
+
+def read_results(files) -> dict:
+    results = {}
+    for file in files:
+        with open(pathlib.Path(file), errors="replace") as f:
+            for line in f:
+                start = line.find("{")
+                if start < 0:
+                    continue
+                try:
+                    result = json.loads(line[start:])
+                except json.JSONDecodeError:
+                    continue
+                if result.get("suite") != "sid_crypto" or result.get("type") != "result":
+                    continue
+                key = (result.get("board", ""), result.get("backend", ""),
+                       result.get("primitive", ""), result.get("size", 0))
+                results[key] = result
+    return results
+
+
+def get_diff(old_results, new_results) -> list:
+    diff_result = []
+    for key in sorted(set(old_results) | set(new_results), key=str):
+        old = old_results.get(key, {}).get("cycles_per_op")
+        new = new_results.get(key, {}).get("cycles_per_op")
+        change = None
+        if old and new is not None:
+            change = (new - old) * 100.0 / old
+        diff_result.append((key, old, new, change))
+    return diff_result
+
+
+def get_output_string(options, diff_result) -> str:
+    output = ""
+    if options.md_output:
+        output += "| Board | Backend | Primitive | Size | old cycles/op | new cycles/op | diff |\n"
+        output += "|---|---|---|---|---|---|---|\n"
+    for (board, backend, primitive, size), old, new, change in diff_result:
+        if options.show_only_diff and change is not None and abs(change) < options.threshold:
+            continue
+        change_str = "n/a" if change is None else f"{change:+.1f}%"
+        if options.md_output:
+            output += f"|{board}|{backend}|{primitive}|{size}|{old}|{new}|{change_str}|\n"
+        else:
+            output += f"{board} {backend} {primitive} {size} B: {old} -> {new} cycles/op " \
+                f"({change_str})\n"
+    return output
+
+
+def main():
+    options = get_arguments().parse_args()
+
+    diff_result = get_diff(read_results(options.old), read_results(options.new))
+    print(get_output_string(options, diff_result))
+
+    regressions = [element for element in diff_result
+                   if element[3] is not None and element[3] >= options.threshold]
+    if regressions:
+        print(f"{len(regressions)} results slower by {options.threshold}% or more.")
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,111 @@
+# Copyright (c) 2024 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+import argparse
+import json
+import pathlib
+import sys
+
+PERCENTILES = ("p50_ns", "p99_ns")
+
+
+def get_arguments():
+    parser = argparse.ArgumentParser(
+        prog="Compare Sidewalk key-value storage benchmark logs for performance differences")
+    parser.add_argument("-o", "--old", required=True, type=str, nargs="+",
+                        help="logs of the reference run, e.g. twister handler.log files")
+    parser.add_argument("-n", "--new", required=True, type=str, nargs="+",
+                        help="logs of the compared run")
+    parser.add_argument("-t", "--threshold", default=10.0, type=float,
+                        help="slowdown of p50 or p99 in percent reported as a regression")
+    parser.add_argument("--md_output", action='store_true')
+    parser.add_argument("-d", "--show_only_diff", action='store_true')
+    return parser
+
+
+def read_results(files) -> dict:
+    results = {}
+    for file in files:
+        with open(pathlib.Path(file), errors="replace") as f:
+            for line in f:
+                start = line.find("{")
+                if start < 0:
+                    continue
+                try:
+                    result = json.loads(line[start:])
+                except json.JSONDecodeError:
+                    continue
+                if result.get("suite") != "sid_storage" or result.get("type") != "result":
+                    continue
+                config = result.get("lookups", "")
+                if result.get("cache"):
+                    config += "+cache"
+                key = (result.get("board", ""), result.get("backend", ""), config,
+                       result.get("op", ""), result.get("dist", ""))
+                results[key] = result
+    return results
+
+
+def get_change(old, new):
+    if old and new is not None:
+        return (new - old) * 100.0 / old
+    return None
+
+
+def get_diff(old_results, new_results) -> list:
+    diff_result = []
+    for key in sorted(set(old_results) | set(new_results), key=str):
+        changes = []
+        for percentile in PERCENTILES:
+            old = old_results.get(key, {}).get(percentile)
+            new = new_results.get(key, {}).get(percentile)
+            changes.append((old, new, get_change(old, new)))
+        diff_result.append((key, changes))
+    return diff_result
+
+
+def is_regression(changes, threshold) -> bool:
+    return any(change is not None and change >= threshold for _, _, change in changes)
+
+
+def get_output_string(options, diff_result) -> str:
+    output = ""
+    if options.md_output:
+        output += "| Board | Backend | Config | Op | Dist |"
+        output += "".join(f" old {p} | new {p} | diff |" for p in PERCENTILES) + "\n"
+        output += "|---" * (5 + 3 * len(PERCENTILES)) + "|\n"
+    for (board, backend, config, op, dist), changes in diff_result:
+        if options.show_only_diff and all(
+                change is None or abs(change) < options.threshold for _, _, change in changes):
+            continue
+        if options.md_output:
+            output += f"|{board}|{backend}|{config}|{op}|{dist}|"
+            for old, new, change in changes:
+                change_str = "n/a" if change is None else f"{change:+.1f}%"
+                output += f"{old}|{new}|{change_str}|"
+            output += "\n"
+        else:
+            output += f"{board} {backend} {config} {op} {dist}:"
+            for percentile, (old, new, change) in zip(PERCENTILES, changes):
+                change_str = "n/a" if change is None else f"{change:+.1f}%"
+                output += f" {percentile} {old} -> {new} ({change_str})"
+            output += "\n"
+    return output
+
+
+def main():
+    options = get_arguments().parse_args()
+
+    diff_result = get_diff(read_results(options.old), read_results(options.new))
+    print(get_output_string(options, diff_result))
+
+    regressions = [element for element in diff_result
+                   if is_regression(element[1], options.threshold)]
+    if regressions:
+        print(f"{len(regressions)} results slower by {options.threshold}% or more.")
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -11,10 +11,22 @@
 #include <sid_hal_reset_ifc.h>
 #include <zephyr/sys/reboot.h>
 #include <zephyr/kernel.h>
+#ifdef CONFIG_SIDEWALK_STORAGE_CACHE
+#include <sid_storage_cache.h>
+#endif /* CONFIG_SIDEWALK_STORAGE_CACHE */
+#ifdef CONFIG_SIDEWALK_STORAGE_STATS
+#include <sid_storage_stats.h>
+#endif /* CONFIG_SIDEWALK_STORAGE_STATS */
 
 sid_error_t sid_hal_reset(sid_hal_reset_type_t type)
 {
 	if (SID_HAL_RESET_NORMAL == type) {
+#ifdef CONFIG_SIDEWALK_STORAGE_CACHE
+		(void)sid_storage_cache_sync();
+#endif /* CONFIG_SIDEWALK_STORAGE_CACHE */
+#ifdef CONFIG_SIDEWALK_STORAGE_STATS
+		(void)sid_storage_stats_save();
+#endif /* CONFIG_SIDEWALK_STORAGE_STATS */
 		sys_reboot(SYS_REBOOT_WARM);
 	} else {
 		return SID_ERROR_NOSUPPORT;
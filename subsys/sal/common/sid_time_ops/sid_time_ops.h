@@ -95,4 +95,8 @@ void sid_add_ms_to_timespec(struct sid_timespec *ts, uint32_t ms);
 }
 #endif
 
+#ifdef CONFIG_SIDEWALK_TIME_OPS_INLINE
+#include <sid_time_ops_inline.h>
+#endif /* CONFIG_SIDEWALK_TIME_OPS_INLINE */
+
 #endif
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_time_ops_inline.h
+ *  @brief Inline implementation of the Sidewalk time operations.
+ *
+ *  The functions give the same results as the out-of-line implementation
+ *  from the Sidewalk library, including not normalized input, infinity and
+ *  32-bit wrap around. Timespecs are compared as a 64-bit key
+ *  (seconds in the upper word), nanosecond carries are counted without loops
+ *  and 32-bit divisions by constants are replaced with multiply-shift reciprocals.
+ *
+ *  With CONFIG_SIDEWALK_TIME_OPS_INLINE the header is included by sid_time_ops.h
+ *  and every call to a time operation uses the inline variant. The library
+ *  symbols stay available, e.g. for function pointers or with (sid_time_add)(a, b).
+ */
+
+#ifndef SID_TIME_OPS_INLINE_H
+#define SID_TIME_OPS_INLINE_H
+
+#include <sid_time_ops.h>
+#include <sid_pal_assert_ifc.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exact for every 32-bit dividend. */
+static inline uint32_t sid_time_div_1000_inline(uint32_t value)
+{
+	return (uint32_t)(((uint64_t)value * 0x10624DD3ULL) >> 38);
+}
+
+static inline uint32_t sid_time_div_1000000_inline(uint32_t value)
+{
+	return (uint32_t)(((uint64_t)value * 0x431BDE83ULL) >> 50);
+}
+
+/* A 32-bit value holds at most 4 seconds of nanoseconds. */
+static inline uint32_t sid_time_div_nsec_per_sec_inline(uint32_t nsec)
+{
+	return (uint32_t)(nsec >= 1000000000UL) + (uint32_t)(nsec >= 2000000000UL) +
+	       (uint32_t)(nsec >= 3000000000UL) + (uint32_t)(nsec >= 4000000000UL);
+}
+
+static inline uint64_t sid_time_key_inline(const struct sid_timespec *tm)
+{
+	return ((uint64_t)tm->tv_sec << 32) | tm->tv_nsec;
+}
+
+static inline void sid_time_normalize_inline(struct sid_timespec *tm)
+{
+	uint32_t carry = sid_time_div_nsec_per_sec_inline(tm->tv_nsec);
+
+	tm->tv_sec += carry;
+	tm->tv_nsec -= carry * SID_TIME_NSEC_PER_SEC;
+}
+
+static inline bool sid_time_gt_inline(const struct sid_timespec *tm1,
+				      const struct sid_timespec *tm2)
+{
+	return sid_time_key_inline(tm1) > sid_time_key_inline(tm2);
+}
+
+static inline bool sid_time_lt_inline(const struct sid_timespec *tm1,
+				      const struct sid_timespec *tm2)
+{
+	return sid_time_key_inline(tm1) < sid_time_key_inline(tm2);
+}
+
+static inline bool sid_time_eq_inline(const struct sid_timespec *tm1,
+				      const struct sid_timespec *tm2)
+{
+	return sid_time_key_inline(tm1) == sid_time_key_inline(tm2);
+}
+
+static inline bool sid_time_is_infinity_inline(const struct sid_timespec *tm)
+{
+	return sid_time_key_inline(tm) == UINT64_MAX;
+}
+
+static inline bool sid_time_is_zero_inline(const struct sid_timespec *tm)
+{
+	return sid_time_key_inline(tm) == 0;
+}
+
+static inline void sid_time_add_inline(struct sid_timespec *tm1, const struct sid_timespec *tm2)
+{
+	struct sid_timespec tmp = *tm2;
+
+	sid_time_normalize_inline(&tmp);
+	sid_time_normalize_inline(tm1);
+	SID_PAL_ASSERT(tm1->tv_sec <= (UINT32_MAX - tmp.tv_sec));
+	tm1->tv_sec += tmp.tv_sec;
+	/* Both parts are normalized, so there is at most one carry. */
+	tm1->tv_nsec += tmp.tv_nsec;
+	tm1->tv_sec += (uint32_t)(tm1->tv_nsec >= SID_TIME_NSEC_PER_SEC);
+	tm1->tv_nsec -= (tm1->tv_nsec >= SID_TIME_NSEC_PER_SEC) ? SID_TIME_NSEC_PER_SEC : 0;
+}
+
+static inline void sid_time_sub_inline(struct sid_timespec *tm1, const struct sid_timespec *tm2)
+{
+	struct sid_timespec tmp = *tm2;
+
+	SID_PAL_ASSERT(!sid_time_gt_inline(tm2, tm1));
+	sid_time_normalize_inline(&tmp);
+	if (tm1->tv_nsec < tmp.tv_nsec) {
+		tm1->tv_sec -= 1;
+		tm1->tv_nsec += SID_TIME_NSEC_PER_SEC;
+	}
+	tm1->tv_sec -= tmp.tv_sec;
+	tm1->tv_nsec -= tmp.tv_nsec;
+	sid_time_normalize_inline(tm1);
+}
+
+static inline void sid_time_delta_inline(struct sid_timespec *delta,
+					 const struct sid_timespec *tm1,
+					 const struct sid_timespec *tm2)
+{
+	*delta = *tm1;
+	sid_time_sub_inline(delta, tm2);
+}
+
+static inline uint32_t sid_timespec_to_ms_inline(const struct sid_timespec *tm)
+{
+	return tm->tv_sec * SID_TIME_MSEC_PER_SEC + sid_time_div_1000000_inline(tm->tv_nsec);
+}
+
+static inline uint64_t sid_timespec_to_ms_64_inline(const struct sid_timespec *tm)
+{
+	return (uint64_t)tm->tv_sec * SID_TIME_MSEC_PER_SEC +
+	       sid_time_div_1000000_inline(tm->tv_nsec);
+}
+
+static inline uint32_t sid_timespec_to_us_inline(const struct sid_timespec *tm)
+{
+	return tm->tv_sec * SID_TIME_USEC_PER_SEC + sid_time_div_1000_inline(tm->tv_nsec);
+}
+
+static inline uint64_t sid_timespec_to_us_64_inline(const struct sid_timespec *tm)
+{
+	return (uint64_t)tm->tv_sec * SID_TIME_USEC_PER_SEC + sid_time_div_1000_inline(tm->tv_nsec);
+}
+
+static inline void sid_ms_to_timespec_inline(uint32_t msec, struct sid_timespec *tm)
+{
+	uint32_t sec = sid_time_div_1000_inline(msec);
+
+	tm->tv_sec = sec;
+	tm->tv_nsec = (msec - sec * SID_TIME_MSEC_PER_SEC) * SID_TIME_NSEC_PER_MSEC;
+}
+
+static inline struct sid_timespec sid_ms_to_timespec_ret_inline(uint32_t msec)
+{
+	struct sid_timespec tm;
+
+	sid_ms_to_timespec_inline(msec, &tm);
+	return tm;
+}
+
+static inline void sid_us_to_timespec_inline(uint32_t usec, struct sid_timespec *tm)
+{
+	uint32_t sec = sid_time_div_1000000_inline(usec);
+
+	tm->tv_sec = sec;
+	tm->tv_nsec = (usec - sec * SID_TIME_USEC_PER_SEC) * SID_TIME_NSEC_PER_USEC;
+}
+
+/* 64-bit dividends have no cheap reciprocal on 32-bit cores, these keep the division. */
+static inline void sid_ms_to_timespec_64_inline(uint64_t msec, struct sid_timespec *tm)
+{
+	tm->tv_sec = (sid_time_t)(msec / SID_TIME_MSEC_PER_SEC);
+	tm->tv_nsec = (uint32_t)(msec % SID_TIME_MSEC_PER_SEC) * SID_TIME_NSEC_PER_MSEC;
+}
+
+static inline void sid_us_to_timespec_64_inline(uint64_t usec, struct sid_timespec *tm)
+{
+	tm->tv_sec = (sid_time_t)(usec / SID_TIME_USEC_PER_SEC);
+	tm->tv_nsec = (uint32_t)(usec % SID_TIME_USEC_PER_SEC) * SID_TIME_NSEC_PER_USEC;
+}
+
+static inline struct sid_timespec sid_add_ms_to_timespec_ret_inline(struct sid_timespec ts,
+								   uint32_t ms)
+{
+	uint32_t sec = sid_time_div_1000_inline(ms);
+	uint32_t nsec = (ms - sec * SID_TIME_MSEC_PER_SEC) * SID_TIME_NSEC_PER_MSEC + ts.tv_nsec;
+	uint32_t carry = sid_time_div_nsec_per_sec_inline(nsec);
+
+	ts.tv_sec += sec + carry;
+	ts.tv_nsec = nsec - carry * SID_TIME_NSEC_PER_SEC;
+	return ts;
+}
+
+static inline void sid_add_ms_to_timespec_inline(struct sid_timespec *ts, uint32_t ms)
+{
+	struct sid_timespec tm;
+
+	sid_ms_to_timespec_inline(ms, &tm);
+	sid_time_add_inline(ts, &tm);
+}
+
+static inline void sid_sub_ms_from_timespec_inline(struct sid_timespec *ts, uint32_t ms)
+{
+	struct sid_timespec tm;
+
+	sid_ms_to_timespec_inline(ms, &tm);
+	sid_time_sub_inline(ts, &tm);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef CONFIG_SIDEWALK_TIME_OPS_INLINE
+#define sid_time_add(tm1, tm2) sid_time_add_inline(tm1, tm2)
+#define sid_time_sub(tm1, tm2) sid_time_sub_inline(tm1, tm2)
+#define sid_time_delta(delta, tm1, tm2) sid_time_delta_inline(delta, tm1, tm2)
+#define sid_time_gt(tm1, tm2) sid_time_gt_inline(tm1, tm2)
+#define sid_time_lt(tm1, tm2) sid_time_lt_inline(tm1, tm2)
+#define sid_time_eq(tm1, tm2) sid_time_eq_inline(tm1, tm2)
+#define sid_time_normalize(tm) sid_time_normalize_inline(tm)
+#define sid_time_is_infinity(tm) sid_time_is_infinity_inline(tm)
+#define sid_time_is_zero(tm) sid_time_is_zero_inline(tm)
+#define sid_timespec_to_ms(tm) sid_timespec_to_ms_inline(tm)
+#define sid_ms_to_timespec(msec, tm) sid_ms_to_timespec_inline(msec, tm)
+#define sid_ms_to_timespec_ret(msec) sid_ms_to_timespec_ret_inline(msec)
+#define sid_timespec_to_ms_64(tm) sid_timespec_to_ms_64_inline(tm)
+#define sid_ms_to_timespec_64(msec, tm) sid_ms_to_timespec_64_inline(msec, tm)
+#define sid_us_to_timespec(usec, tm) sid_us_to_timespec_inline(usec, tm)
+#define sid_us_to_timespec_64(usec, tm) sid_us_to_timespec_64_inline(usec, tm)
+#define sid_timespec_to_us(tm) sid_timespec_to_us_inline(tm)
+#define sid_timespec_to_us_64(tm) sid_timespec_to_us_64_inline(tm)
+#define sid_add_ms_to_timespec_ret(ts, ms) sid_add_ms_to_timespec_ret_inline(ts, ms)
+#define sid_sub_ms_from_timespec(ts, ms) sid_sub_ms_from_timespec_inline(ts, ms)
+#define sid_add_ms_to_timespec(ts, ms) sid_add_ms_to_timespec_inline(ts, ms)
+#endif /* CONFIG_SIDEWALK_TIME_OPS_INLINE */
+
+#endif /* SID_TIME_OPS_INLINE_H */
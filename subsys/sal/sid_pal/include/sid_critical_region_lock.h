@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_critical_region_lock.h
+ *  @brief Sidewalk scoped critical region locks.
+ *
+ *  A lock protects the data of a single subsystem, instead of the global Sidewalk
+ *  critical region. It uses the backend selected with CONFIG_SIDEWALK_CRITICAL_REGION_BACKEND:
+ *  - irq_lock: every lock masks all interrupts, the lock instance is not used.
+ *  - spinlock: every lock instance is a separate k_spinlock, subsystems do not
+ *    contend with each other on SMP.
+ *  - priority threshold: interrupts with priority higher than
+ *    CONFIG_SIDEWALK_CRITICAL_REGION_PRIORITY_THRESHOLD stay unmasked.
+ *
+ *  The locks are not reentrant. They can be taken inside of the global critical region,
+ *  but the global critical region must not be entered with a lock held.
+ */
+
+#ifndef SID_CRITICAL_REGION_LOCK_H
+#define SID_CRITICAL_REGION_LOCK_H
+
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+
+#include <stdbool.h>
+
+#if defined(CONFIG_SIDEWALK_CRITICAL_REGION_PRIORITY_THRESHOLD)
+#include <cmsis_core.h>
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_PRIORITY_THRESHOLD */
+
+#if defined(CONFIG_SIDEWALK_CRITICAL_REGION_SPINLOCK)
+struct sid_region_lock {
+	struct k_spinlock spinlock;
+};
+
+typedef k_spinlock_key_t sid_region_key_t;
+#else
+struct sid_region_lock {
+	uint8_t unused;
+};
+
+typedef unsigned int sid_region_key_t;
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_SPINLOCK */
+
+/**
+ * @brief Define a lock of a subsystem.
+ *
+ * @param name name of the lock.
+ */
+#define SID_REGION_LOCK_DEFINE(name) static struct sid_region_lock name
+
+/**
+ * @brief Take the lock.
+ *
+ * @param lock lock to take.
+ * @return key to be passed to @ref sid_region_unlock.
+ */
+static inline sid_region_key_t sid_region_lock(struct sid_region_lock *lock)
+{
+#if defined(CONFIG_SIDEWALK_CRITICAL_REGION_SPINLOCK)
+	return k_spin_lock(&lock->spinlock);
+#elif defined(CONFIG_SIDEWALK_CRITICAL_REGION_PRIORITY_THRESHOLD)
+	const sid_region_key_t key = __get_BASEPRI();
+
+	ARG_UNUSED(lock);
+	/* Only raises the masked priority, so the nested use keeps the stronger mask. */
+	__set_BASEPRI_MAX(
+		_EXC_PRIO(CONFIG_SIDEWALK_CRITICAL_REGION_PRIORITY_THRESHOLD_LEVEL + _IRQ_PRIO_OFFSET));
+	__ISB();
+	return key;
+#else
+	ARG_UNUSED(lock);
+	return irq_lock();
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_SPINLOCK */
+}
+
+/**
+ * @brief Release the lock.
+ *
+ * @param lock lock to release.
+ * @param key key returned by @ref sid_region_lock.
+ */
+static inline void sid_region_unlock(struct sid_region_lock *lock, sid_region_key_t key)
+{
+#if defined(CONFIG_SIDEWALK_CRITICAL_REGION_SPINLOCK)
+	k_spin_unlock(&lock->spinlock, key);
+#elif defined(CONFIG_SIDEWALK_CRITICAL_REGION_PRIORITY_THRESHOLD)
+	ARG_UNUSED(lock);
+	__set_BASEPRI(key);
+	__ISB();
+#else
+	ARG_UNUSED(lock);
+	irq_unlock(key);
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_SPINLOCK */
+}
+
+/**
+ * @brief Run the following statement or block with the lock held.
+ *
+ * The lock is released at the end of the block, leaving the block with
+ * return, break or goto leaves the lock held.
+ *
+ * @param lock lock to take.
+ */
+#define SID_REGION_LOCKED(lock)                                                                    \
+	for (struct {                                                                              \
+		     bool done;                                                                    \
+		     sid_region_key_t key;                                                         \
+	     } _sid_region_scope = { .done = false, .key = sid_region_lock(lock) };                \
+	     !_sid_region_scope.done;                                                              \
+	     sid_region_unlock(lock, _sid_region_scope.key), _sid_region_scope.done = true)
+
+#endif /* SID_CRITICAL_REGION_LOCK_H */
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_critical_region_profiler.h
+ *  @brief Sidewalk critical region hold time profiler.
+ *
+ *  The outermost enter/exit pair of the critical region is timed with the cycle counter
+ *  and attributed to the caller of sid_pal_enter_critical_region().
+ */
+
+#ifndef SID_CRITICAL_REGION_PROFILER_H
+#define SID_CRITICAL_REGION_PROFILER_H
+
+#include <stdint.h>
+
+struct sid_critical_region_site {
+	/* Return address of the sid_pal_enter_critical_region() call. */
+	uintptr_t caller;
+	uint32_t count;
+	uint32_t max_cycles;
+	uint64_t sum_cycles;
+};
+
+struct sid_critical_region_profile {
+	/* Call sites with the longest hold time, sorted by max_cycles, the worst first. */
+	struct sid_critical_region_site sites[CONFIG_SIDEWALK_CRITICAL_REGION_PROFILER_SITES];
+	uint32_t sites_num;
+	/* Number of holds of every call site, also the ones not kept in the table. */
+	uint32_t count;
+	/* Number of call sites removed from a full table by a longer hold. */
+	uint32_t evicted;
+};
+
+/**
+ * @brief Get a consistent copy of the critical region profile.
+ *
+ * @param profile buffer for the profile.
+ */
+void sid_critical_region_profiler_get(struct sid_critical_region_profile *profile);
+
+/**
+ * @brief Clear the critical region profile.
+ */
+void sid_critical_region_profiler_reset(void);
+
+#endif /* SID_CRITICAL_REGION_PROFILER_H */
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_crypto_async.h
+ *  @brief Sidewalk asynchronous ECC operations.
+ *
+ *  The operations are queued to a low priority crypto worker thread, so the
+ *  calling thread keeps processing its events while the ECC operation runs.
+ *  The parameters and all buffers they point to are owned by the caller and
+ *  have to stay valid until the completion callback is called.
+ */
+
+#ifndef SID_CRYPTO_ASYNC_H
+#define SID_CRYPTO_ASYNC_H
+
+#include <sid_pal_crypto_ifc.h>
+
+/**
+ * @brief Completion callback of an asynchronous operation.
+ *
+ * @note Called from the crypto worker thread. Forward the result to the own
+ *  thread of the caller (e.g. with sidewalk_event_send()) instead of doing
+ *  any long processing in the callback.
+ *
+ * @param result result of the operation, the same as of the synchronous variant.
+ * @param ctx user context given with the request.
+ */
+typedef void (*sid_pal_crypto_async_cb_t)(sid_error_t result, void *ctx);
+
+/**
+ * @brief Queue sid_pal_crypto_ecc_dsa().
+ *
+ * @param params ECDSA/EdDSA parameters.
+ * @param callback completion callback.
+ * @param ctx user context passed to the callback.
+ * @return SID_ERROR_NONE when queued, SID_ERROR_BUSY when the queue is full.
+ */
+sid_error_t sid_pal_crypto_ecc_dsa_async(sid_pal_dsa_params_t *params,
+					 sid_pal_crypto_async_cb_t callback, void *ctx);
+
+/**
+ * @brief Queue sid_pal_crypto_ecc_ecdh().
+ *
+ * @param params ECDH parameters.
+ * @param callback completion callback.
+ * @param ctx user context passed to the callback.
+ * @return SID_ERROR_NONE when queued, SID_ERROR_BUSY when the queue is full.
+ */
+sid_error_t sid_pal_crypto_ecc_ecdh_async(sid_pal_ecdh_params_t *params,
+					  sid_pal_crypto_async_cb_t callback, void *ctx);
+
+/**
+ * @brief Queue sid_pal_crypto_ecc_key_gen().
+ *
+ * @param params key generation parameters.
+ * @param callback completion callback.
+ * @param ctx user context passed to the callback.
+ * @return SID_ERROR_NONE when queued, SID_ERROR_BUSY when the queue is full.
+ */
+sid_error_t sid_pal_crypto_ecc_key_gen_async(sid_pal_ecc_key_gen_params_t *params,
+					     sid_pal_crypto_async_cb_t callback, void *ctx);
+
+#endif /* SID_CRYPTO_ASYNC_H */
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_crypto_batch.h
+ *  @brief Sidewalk AES and AEAD operations on multiple frames with one key.
+ *
+ *  All frames of a batch use the same key, algorithm and mode, the key is prepared
+ *  once for the whole batch. Every frame has its own IV, AAD and MAC.
+ *  A frame can be processed in place, with the same in and out buffer.
+ *  Partially overlapping buffers are not supported.
+ */
+
+#ifndef SID_CRYPTO_BATCH_H
+#define SID_CRYPTO_BATCH_H
+
+#include <sid_pal_crypto_ifc.h>
+
+/**
+ * @brief Encrypt, decrypt or calculate the CMAC of multiple frames with one key.
+ *
+ * All parameters are checked before the first frame is processed. The processing
+ * stops at the first failed frame.
+ *
+ * @param params parameters of the frames.
+ * @param count number of frames.
+ * @param processed number of successfully processed frames.
+ * @return SID_ERROR_NONE when all frames are processed, SID_ERROR_INVALID_ARGS when
+ *         the frames do not share the key, algorithm and mode.
+ */
+sid_error_t sid_pal_crypto_aes_crypt_batch(sid_pal_aes_params_t *params, size_t count,
+					   size_t *processed);
+
+/**
+ * @brief Encrypt or decrypt multiple frames with one key.
+ *
+ * All parameters are checked before the first frame is processed. The processing
+ * stops at the first failed frame, e.g. with a MAC which does not match.
+ *
+ * @param params parameters of the frames.
+ * @param count number of frames.
+ * @param processed number of successfully processed frames.
+ * @return SID_ERROR_NONE when all frames are processed, SID_ERROR_INVALID_ARGS when
+ *         the frames do not share the key, algorithm, MAC size and mode.
+ */
+sid_error_t sid_pal_crypto_aead_crypt_batch(sid_pal_aead_params_t *params, size_t count,
+					    size_t *processed);
+
+#endif /* SID_CRYPTO_BATCH_H */
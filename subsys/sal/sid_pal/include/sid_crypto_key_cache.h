@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_crypto_key_cache.h
+ *  @brief Cache of volatile PSA keys used by the Sidewalk cryptography.
+ *
+ *  AES, AEAD and HMAC keys given as raw bytes are imported once and kept
+ *  in PSA, the cache maps the SHA-256 digest of the key bytes, the algorithm
+ *  and the usage to the imported key. The least recently used key is destroyed
+ *  when the cache is full. sid_pal_crypto_deinit() destroys all cached keys.
+ */
+
+#ifndef SID_CRYPTO_KEY_CACHE_H
+#define SID_CRYPTO_KEY_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct sid_crypto_key_cache_stats {
+	/* Number of keys found in the cache. */
+	uint32_t hits;
+	/* Number of keys imported to PSA. */
+	uint32_t misses;
+	/* Number of cached keys destroyed to make room for another one. */
+	uint32_t evictions;
+};
+
+/**
+ * @brief Destroy all cached keys.
+ *
+ * A key in use is destroyed when the operation using it ends.
+ */
+void sid_crypto_key_cache_invalidate(void);
+
+/**
+ * @brief Destroy all cached keys imported from the given key bytes, e.g. after a key rotation.
+ *
+ * @param key key bytes.
+ * @param key_size size of the key in bytes.
+ */
+void sid_crypto_key_cache_invalidate_key(const uint8_t *key, size_t key_size);
+
+/**
+ * @brief Get the cache statistics.
+ *
+ * @param stats buffer for the statistics.
+ */
+void sid_crypto_key_cache_stats_get(struct sid_crypto_key_cache_stats *stats);
+
+/**
+ * @brief Clear the cache statistics.
+ */
+void sid_crypto_key_cache_stats_reset(void);
+
+#endif /* SID_CRYPTO_KEY_CACHE_H */
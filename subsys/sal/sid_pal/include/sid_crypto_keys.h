@@ -24,6 +24,18 @@ typedef enum {
 	SID_CRYPTO_KEY_ID_LAST
 } sid_crypto_key_id_t;
 
+/**
+ * @brief Residency counters of persistent Sidewalk keys.
+ */
+struct sid_crypto_keys_stats {
+	/* Number of key uses which loaded the key from the storage. */
+	uint32_t loads;
+	/* Number of key uses which found the key loaded. */
+	uint32_t hits;
+	/* Number of keys removed from RAM. */
+	uint32_t purges;
+};
+
 /**
  * @brief Init secure key storage for Sidewalk keys.
  * 
@@ -87,8 +99,34 @@ int sid_crypto_keys_buffer_get(psa_key_id_t *id, uint8_t *buffer, size_t size);
  */
 int sid_crypto_keys_delete(psa_key_id_t id);
 
+/**
+ * @brief Notify that a persistent key was used, and apply the key residency policy.
+ *
+ * @note Depending on CONFIG_SIDEWALK_CRYPTO_KEYS_RESIDENCY the key is kept loaded,
+ *  purged from RAM (CONFIG_SIDEWALK_CRYPTO_KEYS_PURGE_AFTER_USE) or purged when it is
+ *  the least recently used one above the limit.
+ *  Ids other than the Sidewalk key ids are ignored.
+ *
+ * @param id [in] psa key id of the used key.
+ */
+void sid_crypto_keys_used(psa_key_id_t id);
+
+/**
+ * @brief Get the key residency counters.
+ *
+ * @param stats [out] buffer for the counters.
+ */
+void sid_crypto_keys_stats_get(struct sid_crypto_keys_stats *stats);
+
+/**
+ * @brief Clear the key residency counters.
+ */
+void sid_crypto_keys_stats_reset(void);
+
 /**
  * @brief Deinit sidewalk key storage.
+ *
+ * @note All loaded keys are purged from RAM.
  * 
  * @return 0 on success, or -errno on failure. 
  */
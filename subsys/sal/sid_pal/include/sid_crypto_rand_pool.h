@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_crypto_rand_pool.h
+ *  @brief Pool of random bytes for sid_pal_crypto_rand().
+ *
+ *  A low priority thread fills the pool from the PSA random generator, and
+ *  small requests are copied from RAM. Every pooled byte is given out only once
+ *  and cleared afterwards. Requests which the pool cannot serve use the PSA
+ *  random generator directly.
+ */
+
+#ifndef SID_CRYPTO_RAND_POOL_H
+#define SID_CRYPTO_RAND_POOL_H
+
+#include <psa/crypto.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct sid_crypto_rand_pool_stats {
+	/* Number of requests served from the pool. */
+	uint32_t hits;
+	/* Number of requests served by the PSA random generator. */
+	uint32_t misses;
+	/* Number of bytes added to the pool. */
+	uint32_t refill_bytes;
+	/* Number of refilled bytes discarded by a flush. */
+	uint32_t discarded_bytes;
+	/* Longest request served from the pool. */
+	uint32_t hit_latency_max_ns;
+	/* Longest request served by the PSA random generator. */
+	uint32_t miss_latency_max_ns;
+	uint64_t hit_latency_sum_ns;
+	uint64_t miss_latency_sum_ns;
+};
+
+/**
+ * @brief Start filling the pool. Called by sid_pal_crypto_init() after PSA is initialized.
+ */
+void sid_crypto_rand_pool_init(void);
+
+/**
+ * @brief Stop filling the pool and clear it. Called by sid_pal_crypto_deinit().
+ */
+void sid_crypto_rand_pool_deinit(void);
+
+/**
+ * @brief Get random bytes, from the pool if possible.
+ *
+ * @param rand buffer for the random bytes.
+ * @param size number of random bytes.
+ * @return PSA_SUCCESS on success, otherwise the error of psa_generate_random().
+ */
+psa_status_t sid_crypto_rand_pool_generate(uint8_t *rand, size_t size);
+
+/**
+ * @brief Clear the pool, e.g. after the random generator is reseeded.
+ *
+ * Bytes generated before the flush are never given out, also when a refill is in progress.
+ */
+void sid_crypto_rand_pool_flush(void);
+
+/**
+ * @brief Get the pool statistics.
+ *
+ * @param stats buffer for the statistics.
+ */
+void sid_crypto_rand_pool_stats_get(struct sid_crypto_rand_pool_stats *stats);
+
+/**
+ * @brief Clear the pool statistics.
+ */
+void sid_crypto_rand_pool_stats_reset(void);
+
+#endif /* SID_CRYPTO_RAND_POOL_H */
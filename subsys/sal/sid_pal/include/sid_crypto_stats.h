@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_crypto_stats.h
+ *  @brief Sidewalk cryptography instrumentation.
+ *
+ *  Calls, processed bytes, failures and the latency of every call are recorded
+ *  per algorithm. Calls rejected before the algorithm is known, e.g. with
+ *  a NULL pointer, are not recorded.
+ */
+
+#ifndef SID_CRYPTO_STATS_H
+#define SID_CRYPTO_STATS_H
+
+#include <stdint.h>
+
+/* Bucket 0 counts 0 cycles, bucket n counts [2^(n-1), 2^n) cycles, the last bucket counts the rest. */
+#define SID_CRYPTO_STATS_HIST_BUCKETS (28)
+
+enum sid_crypto_stats_algo {
+	SID_CRYPTO_STATS_AES_CTR,
+	SID_CRYPTO_STATS_AES_CMAC,
+	SID_CRYPTO_STATS_AES_GCM,
+	/* CCM and CCM*. */
+	SID_CRYPTO_STATS_AES_CCM,
+	SID_CRYPTO_STATS_SHA256,
+	SID_CRYPTO_STATS_SHA512,
+	SID_CRYPTO_STATS_HMAC_SHA256,
+	SID_CRYPTO_STATS_HMAC_SHA512,
+	/* Sign, verify and key generation. */
+	SID_CRYPTO_STATS_ED25519,
+	/* ECDSA, ECDH and key generation. */
+	SID_CRYPTO_STATS_P256,
+	/* ECDH and key generation. */
+	SID_CRYPTO_STATS_X25519,
+	SID_CRYPTO_STATS_RAND,
+	SID_CRYPTO_STATS_ALGO_NUM,
+};
+
+struct sid_crypto_stats_hist {
+	uint32_t buckets[SID_CRYPTO_STATS_HIST_BUCKETS];
+	uint32_t max_cycles;
+	uint64_t sum_cycles;
+};
+
+struct sid_crypto_stats_algo_stats {
+	uint32_t calls;
+	uint32_t failures;
+	/* Input bytes of the successful calls. */
+	uint64_t bytes;
+	struct sid_crypto_stats_hist latency;
+};
+
+struct sid_crypto_stats {
+	struct sid_crypto_stats_algo_stats algo[SID_CRYPTO_STATS_ALGO_NUM];
+};
+
+/**
+ * @brief Get the histogram bucket for a value.
+ *
+ * @param cycles value in cycles.
+ * @return bucket index.
+ */
+static inline uint32_t sid_crypto_stats_bucket(uint32_t cycles)
+{
+	uint32_t bucket = cycles ? (32 - __builtin_clz(cycles)) : 0;
+
+	return (bucket < SID_CRYPTO_STATS_HIST_BUCKETS) ? bucket :
+							  (SID_CRYPTO_STATS_HIST_BUCKETS - 1);
+}
+
+/**
+ * @brief Get the name of the algorithm.
+ *
+ * @param algo algorithm.
+ * @return name of the algorithm, "unknown" for an invalid value.
+ */
+const char *sid_crypto_stats_algo_name(enum sid_crypto_stats_algo algo);
+
+/**
+ * @brief Get a consistent copy of the cryptography statistics.
+ *
+ * @param stats buffer for the statistics.
+ */
+void sid_crypto_stats_get(struct sid_crypto_stats *stats);
+
+/**
+ * @brief Clear the cryptography statistics.
+ */
+void sid_crypto_stats_reset(void);
+
+#endif /* SID_CRYPTO_STATS_H */
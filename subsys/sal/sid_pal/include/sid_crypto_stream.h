@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_crypto_stream.h
+ *  @brief Sidewalk multi-part hash and HMAC.
+ *
+ *  The data is given in parts of any size, e.g. a DFU image as it is received.
+ *  The context is owned by the caller and has to stay valid until the operation
+ *  is finished, verified or aborted.
+ */
+
+#ifndef SID_CRYPTO_STREAM_H
+#define SID_CRYPTO_STREAM_H
+
+#include <sid_pal_crypto_ifc.h>
+#include <psa/crypto.h>
+
+typedef struct {
+	psa_hash_operation_t operation;
+} sid_pal_hash_ctx_t;
+
+typedef struct {
+	psa_mac_operation_t operation;
+	psa_key_handle_t key_handle;
+} sid_pal_hmac_ctx_t;
+
+/**
+ * @brief Start a multi-part hash.
+ *
+ * @param ctx context of the operation.
+ * @param algo hash algorithm.
+ * @return SID_ERROR_NONE on success.
+ */
+sid_error_t sid_pal_crypto_hash_init(sid_pal_hash_ctx_t *ctx, sid_pal_hash_algo_t algo);
+
+/**
+ * @brief Add the next part of the data to the hash.
+ *
+ * @param ctx context of the operation.
+ * @param data data part.
+ * @param data_size size of the data part, can be 0.
+ * @return SID_ERROR_NONE on success. On failure the operation is aborted.
+ */
+sid_error_t sid_pal_crypto_hash_update(sid_pal_hash_ctx_t *ctx, const uint8_t *data,
+				       size_t data_size);
+
+/**
+ * @brief Finish the hash and get the digest.
+ *
+ * @param ctx context of the operation.
+ * @param digest buffer for the digest.
+ * @param digest_size size of the buffer.
+ * @return SID_ERROR_NONE on success. The operation ends also on failure.
+ */
+sid_error_t sid_pal_crypto_hash_finish(sid_pal_hash_ctx_t *ctx, uint8_t *digest,
+				       size_t digest_size);
+
+/**
+ * @brief Finish the hash and compare it with the expected digest.
+ *
+ * @param ctx context of the operation.
+ * @param digest expected digest.
+ * @param digest_size size of the expected digest.
+ * @return SID_ERROR_NONE when the digest matches. The operation ends also on failure.
+ */
+sid_error_t sid_pal_crypto_hash_verify(sid_pal_hash_ctx_t *ctx, const uint8_t *digest,
+				       size_t digest_size);
+
+/**
+ * @brief Abort the hash, the context can be used again.
+ *
+ * @param ctx context of the operation.
+ * @return SID_ERROR_NONE on success.
+ */
+sid_error_t sid_pal_crypto_hash_abort(sid_pal_hash_ctx_t *ctx);
+
+/**
+ * @brief Start a multi-part HMAC.
+ *
+ * @param ctx context of the operation.
+ * @param algo hash algorithm of the HMAC.
+ * @param key HMAC key.
+ * @param key_size size of the key in bytes.
+ * @return SID_ERROR_NONE on success.
+ */
+sid_error_t sid_pal_crypto_hmac_init(sid_pal_hmac_ctx_t *ctx, sid_pal_hash_algo_t algo,
+				     const uint8_t *key, size_t key_size);
+
+/**
+ * @brief Add the next part of the data to the HMAC.
+ *
+ * @param ctx context of the operation.
+ * @param data data part.
+ * @param data_size size of the data part, can be 0.
+ * @return SID_ERROR_NONE on success. On failure the operation is aborted.
+ */
+sid_error_t sid_pal_crypto_hmac_update(sid_pal_hmac_ctx_t *ctx, const uint8_t *data,
+				       size_t data_size);
+
+/**
+ * @brief Finish the HMAC and get the MAC.
+ *
+ * @param ctx context of the operation.
+ * @param digest buffer for the MAC.
+ * @param digest_size size of the buffer.
+ * @return SID_ERROR_NONE on success. The operation ends also on failure.
+ */
+sid_error_t sid_pal_crypto_hmac_finish(sid_pal_hmac_ctx_t *ctx, uint8_t *digest,
+				       size_t digest_size);
+
+/**
+ * @brief Finish the HMAC and compare it with the expected MAC in constant time.
+ *
+ * @param ctx context of the operation.
+ * @param digest expected MAC.
+ * @param digest_size size of the expected MAC.
+ * @return SID_ERROR_NONE when the MAC matches. The operation ends also on failure.
+ */
+sid_error_t sid_pal_crypto_hmac_verify(sid_pal_hmac_ctx_t *ctx, const uint8_t *digest,
+				       size_t digest_size);
+
+/**
+ * @brief Abort the HMAC, the context can be used again.
+ *
+ * @param ctx context of the operation.
+ * @return SID_ERROR_NONE on success.
+ */
+sid_error_t sid_pal_crypto_hmac_abort(sid_pal_hmac_ctx_t *ctx);
+
+#endif /* SID_CRYPTO_STREAM_H */
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_storage_cache.h
+ *  @brief Write-back RAM cache of the Sidewalk key-value storage.
+ *
+ *  Records written with sid_pal_storage_kv_record_set() are kept in RAM and
+ *  written to the storage backend later, with a single commit for all of them.
+ *  Repeated writes of a record are coalesced, and a write with the value
+ *  already stored is skipped. The cache is flushed when the flush delay
+ *  expires, when all entries hold unwritten records, on sid_storage_cache_sync()
+ *  and before sid_hal_reset().
+ *
+ *  Records marked as critical, and records larger than an entry, are written
+ *  through to the backend. The internal protocol group is cached like any other
+ *  group, unless CONFIG_SIDEWALK_STORAGE_CACHE_CRITICAL_PROTOCOL marks it critical
+ *  in sid_pal_storage_kv_init().
+ */
+
+#ifndef SID_STORAGE_CACHE_H
+#define SID_STORAGE_CACHE_H
+
+#include <sid_error.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Key matching every key of the group in sid_storage_cache_critical_add(). */
+#define SID_STORAGE_CACHE_KEY_ANY (0xFFFF)
+
+struct sid_storage_cache_backend {
+	/* Write the record without commit, returns 0 on success. */
+	int (*write)(uint16_t group, uint16_t key, const void *data, uint32_t len);
+	/* Commit the written records, returns 0 on success. */
+	int (*commit)(void);
+};
+
+struct sid_storage_cache_stats {
+	/* Number of writes kept in the cache. */
+	uint32_t writes;
+	/* Number of writes replacing a record not written to the backend yet. */
+	uint32_t coalesced;
+	/* Number of writes skipped, the record already had the value. */
+	uint32_t unchanged;
+	/* Number of writes given directly to the backend. */
+	uint32_t write_through;
+	/* Number of reads served from the cache. */
+	uint32_t read_hits;
+	/* Number of flushes with at least one record written. */
+	uint32_t flushes;
+	/* Number of records written to the backend by the flushes. */
+	uint32_t flushed_records;
+};
+
+/**
+ * @brief Start the cache. Called by sid_pal_storage_kv_init().
+ *
+ * @param backend functions writing the records to the storage backend.
+ */
+void sid_storage_cache_init(const struct sid_storage_cache_backend *backend);
+
+/**
+ * @brief Store the record in the cache.
+ *
+ * @param group group of the record.
+ * @param key key of the record.
+ * @param data value of the record.
+ * @param len size of the value.
+ * @return SID_ERROR_NONE when the record is cached, SID_ERROR_NOSUPPORT when it has to be
+ *         written through, otherwise the error of the flush making room for it.
+ */
+sid_error_t sid_storage_cache_set(uint16_t group, uint16_t key, const void *data, uint32_t len);
+
+/**
+ * @brief Read the record from the cache.
+ *
+ * @param group group of the record.
+ * @param key key of the record.
+ * @param data buffer for the value, NULL to get only the size.
+ * @param len size of the buffer.
+ * @param stored_len size of the cached value, can be NULL.
+ * @return true when the record is cached.
+ */
+bool sid_storage_cache_get(uint16_t group, uint16_t key, void *data, uint32_t len,
+			   uint32_t *stored_len);
+
+/**
+ * @brief Drop the record from the cache, also when it is not written yet.
+ *
+ * Called before the record is written through or deleted in the backend.
+ *
+ * @param group group of the record.
+ * @param key key of the record.
+ */
+void sid_storage_cache_invalidate(uint16_t group, uint16_t key);
+
+/**
+ * @brief Drop all records of the group from the cache.
+ *
+ * @param group group of the records.
+ */
+void sid_storage_cache_invalidate_group(uint16_t group);
+
+/**
+ * @brief Mark a record as critical, it is always written through.
+ *
+ * @param group group of the record.
+ * @param key key of the record, SID_STORAGE_CACHE_KEY_ANY for every key of the group.
+ * @return SID_ERROR_NONE on success, SID_ERROR_OOM when the table of critical records is full.
+ */
+sid_error_t sid_storage_cache_critical_add(uint16_t group, uint16_t key);
+
+/**
+ * @brief Check if the record is critical.
+ *
+ * @param group group of the record.
+ * @param key key of the record.
+ * @return true when the record is written through.
+ */
+bool sid_storage_cache_is_critical(uint16_t group, uint16_t key);
+
+/**
+ * @brief Write all cached records to the backend and commit them.
+ *
+ * @return SID_ERROR_NONE on success, SID_ERROR_STORAGE_WRITE_FAIL when a record was not written.
+ */
+sid_error_t sid_storage_cache_sync(void);
+
+/**
+ * @brief Get the cache statistics.
+ *
+ * @param stats buffer for the statistics.
+ */
+void sid_storage_cache_stats_get(struct sid_storage_cache_stats *stats);
+
+/**
+ * @brief Clear the cache statistics.
+ */
+void sid_storage_cache_stats_reset(void);
+
+#endif /* SID_STORAGE_CACHE_H */
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_storage_id.h
+ *  @brief Sidewalk key-value storage with numeric IDs.
+ *
+ *  Records are stored in the NVS or ZMS file system mounted by the settings
+ *  subsystem, in the IDs below the ranges used by the settings backend.
+ *  Every record takes a slot with two IDs: the directory ID holds the group
+ *  and key of the record, the value ID holds its value. A RAM map from the
+ *  group and key to the slot is built from the directory at init, so reads
+ *  are a single file system read, without string names. The layout record
+ *  keeps the number of slots in use, so init reads only their directory IDs.
+ *
+ *  Records stored by the settings layout of the key-value storage are moved
+ *  to the slots once, by the first sid_storage_id_init().
+ */
+
+#ifndef SID_STORAGE_ID_H
+#define SID_STORAGE_ID_H
+
+#include <stdint.h>
+
+/**
+ * @brief Build the RAM map and migrate the records from the settings layout.
+ *
+ * Has to be called after settings_subsys_init(). A failed migration is
+ * continued by the next call, the records not migrated stay in the settings.
+ *
+ * @return 0 on success, -EFBIG when a record is larger than SETTINGS_MAX_VAL_LEN,
+ *         negative errno otherwise.
+ */
+int sid_storage_id_init(void);
+
+/**
+ * @brief Read the record.
+ *
+ * @param group group of the record.
+ * @param key key of the record.
+ * @param data buffer for the value, NULL to get only the size.
+ * @param len size of the buffer.
+ * @param stored_len size of the stored value, can be NULL.
+ * @return 0 on success, -ENOENT when the record is not stored, negative errno otherwise.
+ */
+int sid_storage_id_read(uint16_t group, uint16_t key, void *data, uint32_t len,
+			uint32_t *stored_len);
+
+/**
+ * @brief Write the record.
+ *
+ * @param group group of the record.
+ * @param key key of the record.
+ * @param data value of the record.
+ * @param len size of the value.
+ * @return 0 on success, -ENOSPC when all slots are used, negative errno otherwise.
+ */
+int sid_storage_id_write(uint16_t group, uint16_t key, const void *data, uint32_t len);
+
+/**
+ * @brief Delete the record. Deleting a record which is not stored succeeds.
+ *
+ * @param group group of the record.
+ * @param key key of the record.
+ * @return 0 on success, negative errno otherwise.
+ */
+int sid_storage_id_delete(uint16_t group, uint16_t key);
+
+/**
+ * @brief Delete all records of the group.
+ *
+ * @param group group of the records.
+ * @return 0 on success, negative errno otherwise.
+ */
+int sid_storage_id_group_delete(uint16_t group);
+
+/**
+ * @brief Count the records of the group.
+ *
+ * @param group group of the records.
+ * @return number of records of the group.
+ */
+int sid_storage_id_group_records(uint16_t group);
+
+#endif /* SID_STORAGE_ID_H */
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_storage_index.h
+ *  @brief RAM index of the Sidewalk key-value storage records.
+ *
+ *  The index maps the group and key of every record stored in the settings
+ *  NVS backend to the NVS ID of the record and the size of its value. It is
+ *  built once by sid_pal_storage_kv_init() and updated on every write and
+ *  delete, so reads go to the NVS entry of the record directly, instead of
+ *  loading the settings subtree and comparing the names of all records.
+ *
+ *  When the index does not fit in its table, the lookups are not answered and
+ *  the storage falls back to the settings API.
+ */
+
+#ifndef SID_STORAGE_INDEX_H
+#define SID_STORAGE_INDEX_H
+
+#include <sid_error.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Build the index from the records stored in the settings NVS backend.
+ *
+ * @return SID_ERROR_NONE on success, SID_ERROR_STORAGE_READ_FAIL when the backend can not be read.
+ */
+sid_error_t sid_storage_index_build(void);
+
+/**
+ * @brief Read the record using the index.
+ *
+ * @param group group of the record.
+ * @param key key of the record.
+ * @param data buffer for the value, NULL to get only the size.
+ * @param len size of the buffer.
+ * @param stored_len size of the stored value, can be NULL.
+ * @return 0 when the record was read, -ENOENT when the record is not stored,
+ *         -EAGAIN when the index can not answer and the settings API has to be used.
+ */
+int sid_storage_index_read(uint16_t group, uint16_t key, void *data, uint32_t len,
+			   uint32_t *stored_len);
+
+/**
+ * @brief Update the index after the record was written with settings_save_one().
+ *
+ * @param group group of the record.
+ * @param key key of the record.
+ * @param len size of the written value.
+ */
+void sid_storage_index_update(uint16_t group, uint16_t key, uint32_t len);
+
+/**
+ * @brief Remove the record from the index after it was deleted.
+ *
+ * @param group group of the record.
+ * @param key key of the record.
+ */
+void sid_storage_index_remove(uint16_t group, uint16_t key);
+
+/**
+ * @brief Remove all records of the group from the index after the group was deleted.
+ *
+ * @param group group of the records.
+ */
+void sid_storage_index_remove_group(uint16_t group);
+
+/**
+ * @brief Check if the index answers the lookups.
+ *
+ * @return true when the index holds every record of the storage.
+ */
+bool sid_storage_index_is_complete(void);
+
+/**
+ * @brief Get the number of indexed records.
+ *
+ * @return number of records.
+ */
+uint32_t sid_storage_index_records(void);
+
+#endif /* SID_STORAGE_INDEX_H */
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_storage_map.h
+ *  @brief Hash table mapping the group and key of a Sidewalk record to its backend ID.
+ *
+ *  Open addressing with linear probing, a quarter of the slots stays free to
+ *  keep the probe sequences short. The table is not locked, the users hold
+ *  their own mutex.
+ */
+
+#ifndef SID_STORAGE_MAP_H
+#define SID_STORAGE_MAP_H
+
+#include <zephyr/sys/util.h>
+#include <zephyr/toolchain.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct sid_storage_map_entry {
+	uint16_t group;
+	uint16_t key;
+	/* Backend ID of the record, 0 marks an unused slot. */
+	uint16_t id;
+	uint16_t len;
+};
+
+struct sid_storage_map {
+	struct sid_storage_map_entry *entries;
+	/* Number of slots, a power of two. */
+	uint32_t slots;
+	uint32_t count;
+};
+
+/**
+ * @brief Define a static map.
+ *
+ * @param name name of the map.
+ * @param num_slots number of slots, a power of two.
+ */
+#define SID_STORAGE_MAP_DEFINE(name, num_slots)                                                    \
+	BUILD_ASSERT(IS_POWER_OF_TWO(num_slots), "Number of map slots must be a power of two");   \
+	static struct sid_storage_map_entry name##_entries[num_slots];                             \
+	static struct sid_storage_map name = { .entries = name##_entries, .slots = (num_slots) }
+
+/**
+ * @brief Remove all records from the map.
+ *
+ * @param map the map.
+ */
+void sid_storage_map_clear(struct sid_storage_map *map);
+
+/**
+ * @brief Find the record.
+ *
+ * @param map the map.
+ * @param group group of the record.
+ * @param key key of the record.
+ * @return entry of the record, NULL when it is not in the map.
+ */
+struct sid_storage_map_entry *sid_storage_map_find(struct sid_storage_map *map, uint16_t group,
+						   uint16_t key);
+
+/**
+ * @brief Add a record, which is not in the map yet.
+ *
+ * @param map the map.
+ * @param group group of the record.
+ * @param key key of the record.
+ * @param id backend ID of the record, not 0.
+ * @param len size of the record value.
+ * @return entry of the record, NULL when the map is full.
+ */
+struct sid_storage_map_entry *sid_storage_map_insert(struct sid_storage_map *map, uint16_t group,
+						     uint16_t key, uint16_t id, uint32_t len);
+
+/**
+ * @brief Remove the record. Other entries of the map can move.
+ *
+ * @param map the map.
+ * @param entry entry returned by sid_storage_map_find().
+ */
+void sid_storage_map_remove(struct sid_storage_map *map, struct sid_storage_map_entry *entry);
+
+/**
+ * @brief Remove all records of the group.
+ *
+ * @param map the map.
+ * @param group group of the records.
+ */
+void sid_storage_map_remove_group(struct sid_storage_map *map, uint16_t group);
+
+#endif /* SID_STORAGE_MAP_H */
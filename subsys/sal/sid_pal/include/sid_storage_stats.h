@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_storage_stats.h
+ *  @brief Flash wear statistics of the Sidewalk storage.
+ *
+ *  Records written to and deleted from the storage backend, and commits, are
+ *  counted per key-value group, and the most written records are tracked.
+ *  The sector erases of the settings NVS or ZMS file system, which follow
+ *  a garbage collection, and the flash writes of the other Sidewalk storage
+ *  users are counted as well.
+ *
+ *  The statistics are kept in RAM and saved to settings at most once per
+ *  save interval, on sid_storage_stats_save() and before sid_hal_reset().
+ *  Counts since the last save are lost on a power loss.
+ */
+
+#ifndef SID_STORAGE_STATS_H
+#define SID_STORAGE_STATS_H
+
+#include <sid_error.h>
+
+#include <stdint.h>
+
+#define SID_STORAGE_STATS_GROUPS CONFIG_SIDEWALK_STORAGE_STATS_GROUPS
+#define SID_STORAGE_STATS_KEYS CONFIG_SIDEWALK_STORAGE_STATS_KEYS
+
+enum sid_storage_stats_source {
+	/* TLV flash backend of the manufacturing storage. */
+	SID_STORAGE_STATS_MFG,
+	/* Settings written by settings_utils, outside of the key-value storage. */
+	SID_STORAGE_STATS_SETTINGS_UTILS,
+	/* Image received with a bulk data transfer. */
+	SID_STORAGE_STATS_DFU_IMAGE,
+	SID_STORAGE_STATS_SOURCE_NUM,
+};
+
+struct sid_storage_stats_group {
+	uint16_t group;
+	/* Records written to the backend, after the cache and the transactions. */
+	uint32_t writes;
+	uint32_t deletes;
+	/* Commits following a write or delete of the group. */
+	uint32_t commits;
+	uint64_t bytes;
+};
+
+struct sid_storage_stats_key {
+	uint16_t group;
+	uint16_t key;
+	/* Approximate when the table was full, may include writes of the replaced record. */
+	uint32_t writes;
+};
+
+struct sid_storage_stats_source_stats {
+	uint32_t writes;
+	uint32_t erases;
+	uint64_t bytes;
+	uint64_t erased_bytes;
+};
+
+struct sid_storage_stats_backend {
+	/* Sectors erased after garbage collection. */
+	uint32_t gc_erases;
+	uint32_t commits;
+	uint64_t erased_bytes;
+};
+
+struct sid_storage_stats {
+	/* Groups in the order of their first write, unused entries have no writes and deletes. */
+	struct sid_storage_stats_group groups[SID_STORAGE_STATS_GROUPS];
+	/* Groups which do not fit the table, the group field is not used. */
+	struct sid_storage_stats_group other;
+	/* The most written records. */
+	struct sid_storage_stats_key keys[SID_STORAGE_STATS_KEYS];
+	struct sid_storage_stats_source_stats source[SID_STORAGE_STATS_SOURCE_NUM];
+	struct sid_storage_stats_backend backend;
+	/* Saves of the statistics to settings. */
+	uint32_t saves;
+};
+
+/**
+ * @brief Load the saved statistics and start counting the backend erases.
+ *        Called by sid_pal_storage_kv_init().
+ *
+ * Counts recorded before the first call are added to the saved ones.
+ */
+void sid_storage_stats_init(void);
+
+/**
+ * @brief Count a record written to the storage backend.
+ *
+ * @param group group of the record.
+ * @param key key of the record.
+ * @param len size of the value.
+ */
+void sid_storage_stats_record_write(uint16_t group, uint16_t key, uint32_t len);
+
+/**
+ * @brief Count a record or group deleted from the storage backend.
+ *
+ * @param group group of the record.
+ */
+void sid_storage_stats_record_delete(uint16_t group);
+
+/**
+ * @brief Count a commit of the storage backend.
+ */
+void sid_storage_stats_commit(void);
+
+/**
+ * @brief Count a flash write of another Sidewalk storage user.
+ *
+ * @param source user of the flash.
+ * @param len number of bytes written.
+ */
+void sid_storage_stats_source_write(enum sid_storage_stats_source source, uint32_t len);
+
+/**
+ * @brief Count a flash erase, or a deleted record, of another Sidewalk storage user.
+ *
+ * @param source user of the flash.
+ * @param len number of bytes erased or deleted.
+ */
+void sid_storage_stats_source_erase(enum sid_storage_stats_source source, uint32_t len);
+
+/**
+ * @brief Get the name of the source.
+ *
+ * @param source user of the flash.
+ * @return name of the source, "unknown" for an invalid value.
+ */
+const char *sid_storage_stats_source_name(enum sid_storage_stats_source source);
+
+/**
+ * @brief Get a consistent copy of the statistics.
+ *
+ * @param stats buffer for the statistics.
+ */
+void sid_storage_stats_get(struct sid_storage_stats *stats);
+
+/**
+ * @brief Clear the statistics, in RAM and in settings.
+ *
+ * @return SID_ERROR_NONE on success.
+ */
+sid_error_t sid_storage_stats_reset(void);
+
+/**
+ * @brief Save the statistics to settings, when they changed since the last save.
+ *
+ * @return SID_ERROR_NONE on success.
+ */
+sid_error_t sid_storage_stats_save(void);
+
+#endif /* SID_STORAGE_STATS_H */
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_storage_txn.h
+ *  @brief Transactions of the Sidewalk key-value storage.
+ *
+ *  Between sid_pal_storage_kv_txn_begin() and sid_pal_storage_kv_txn_commit(),
+ *  the records written and deleted by the thread that began the transaction
+ *  are staged in RAM, and reads of that thread return the staged values.
+ *  The commit stores the staged operations as one journal record, applies
+ *  them to the records, commits once and deletes the journal. A journal left
+ *  by a reset is applied again by sid_pal_storage_kv_init(), so either all
+ *  operations of a transaction are stored or none of them.
+ *
+ *  sid_pal_storage_kv_group_delete() is a journaled operation as well, staged
+ *  in the open transaction of the thread or committed on its own. A group of
+ *  at most one record is deleted without the journal, a single delete is atomic.
+ */
+
+#ifndef SID_STORAGE_TXN_H
+#define SID_STORAGE_TXN_H
+
+#include <sid_error.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Group of the journal record, not available for other records. */
+#define SID_STORAGE_TXN_JOURNAL_GROUP (0xFFFF)
+#define SID_STORAGE_TXN_JOURNAL_KEY (0)
+
+struct sid_storage_txn_backend {
+	/* Write the record without commit, returns 0 on success. */
+	int (*write)(uint16_t group, uint16_t key, const void *data, uint32_t len);
+	/* Read the record, returns the size of the value or a negative errno. */
+	int (*read)(uint16_t group, uint16_t key, void *data, uint32_t len);
+	/* Delete the record without commit, returns 0 also when the record is not stored. */
+	int (*erase)(uint16_t group, uint16_t key);
+	/* Delete all records of the group without commit, returns 0 on success. */
+	int (*group_erase)(uint16_t group);
+	/* Count the stored records of the group, returns the count or a negative errno. */
+	int (*group_records)(uint16_t group);
+	/* Commit the written and deleted records, returns 0 on success. */
+	int (*commit)(void);
+};
+
+/**
+ * @brief Start a transaction for the calling thread.
+ *
+ * @return SID_ERROR_NONE on success, SID_ERROR_BUSY when a transaction is open already,
+ *         SID_ERROR_UNINITIALIZED before sid_pal_storage_kv_init().
+ */
+sid_error_t sid_pal_storage_kv_txn_begin(void);
+
+/**
+ * @brief Store all operations of the transaction and close it.
+ *
+ * @return SID_ERROR_NONE on success, SID_ERROR_INVALID_STATE when the thread has no open transaction,
+ *         SID_ERROR_STORAGE_WRITE_FAIL when the journal was not written, and nothing was stored.
+ *         Other errors happen after the journal was written, the operations are applied
+ *         again by the next sid_pal_storage_kv_init().
+ */
+sid_error_t sid_pal_storage_kv_txn_commit(void);
+
+/**
+ * @brief Drop the staged operations and close the transaction.
+ *
+ * @return SID_ERROR_NONE on success, SID_ERROR_INVALID_STATE when the thread has no open transaction.
+ */
+sid_error_t sid_pal_storage_kv_txn_abort(void);
+
+/**
+ * @brief Start the transactions and apply a journal left by a reset.
+ *        Called by sid_pal_storage_kv_init().
+ *
+ * @param backend functions accessing the records.
+ * @return SID_ERROR_NONE on success, otherwise the error of the journal replay.
+ */
+sid_error_t sid_storage_txn_init(const struct sid_storage_txn_backend *backend);
+
+/**
+ * @brief Stage a record write in the transaction of the calling thread.
+ *
+ * @return SID_ERROR_NONE when staged, SID_ERROR_NOSUPPORT when the thread has no open transaction,
+ *         SID_ERROR_BUFFER_OVERFLOW when the journal is full, the transaction stays open.
+ */
+sid_error_t sid_storage_txn_set(uint16_t group, uint16_t key, const void *data, uint32_t len);
+
+/**
+ * @brief Stage a record delete in the transaction of the calling thread.
+ *
+ * @return same as sid_storage_txn_set().
+ */
+sid_error_t sid_storage_txn_delete(uint16_t group, uint16_t key);
+
+/**
+ * @brief Delete all records of the group with a journaled batch.
+ *
+ * Staged in the transaction of the calling thread, otherwise committed at once.
+ * Outside a transaction the journal is used only for a group of more than one record.
+ *
+ * @param group group of the records.
+ * @return SID_ERROR_NONE on success.
+ */
+sid_error_t sid_storage_txn_group_delete(uint16_t group);
+
+/**
+ * @brief Read the record from the transaction of the calling thread.
+ *
+ * @param group group of the record.
+ * @param key key of the record.
+ * @param data buffer for the value, NULL to get only the size.
+ * @param len size of the buffer.
+ * @param stored_len size of the staged value, can be NULL.
+ * @param erc SID_ERROR_NONE when the value is staged, SID_ERROR_NOT_FOUND when the record
+ *            is deleted by the transaction.
+ * @return true when the transaction changes the record.
+ */
+bool sid_storage_txn_get(uint16_t group, uint16_t key, void *data, uint32_t len,
+			 uint32_t *stored_len, sid_error_t *erc);
+
+#endif /* SID_STORAGE_TXN_H */
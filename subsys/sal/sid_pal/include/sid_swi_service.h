@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_swi_service.h
+ *  @brief Sidewalk multi-channel software interrupt service.
+ *
+ *  Every channel has a callback, a priority and a pending bit. A single thread
+ *  runs the pending callbacks, always the one with the highest priority first.
+ *  The Sidewalk stack SWI from sid_pal_swi_ifc.h is one of the channels.
+ */
+
+#ifndef SID_SWI_SERVICE_H
+#define SID_SWI_SERVICE_H
+
+#include <sid_error.h>
+
+#include <stdint.h>
+
+/**
+ * @brief Channel callback.
+ *
+ * @param arg argument given when the channel was registered.
+ */
+typedef void (*sid_swi_service_cb_t)(void *arg);
+
+struct sid_swi_channel_stats {
+	/* Number of triggers, including the coalesced ones. */
+	uint32_t triggers;
+	/* Number of triggers of an already pending channel. */
+	uint32_t coalesced;
+	/* Number of callback runs. */
+	uint32_t runs;
+	/* Time from the first trigger of a pending channel to the callback run. */
+	uint32_t latency_max_us;
+	uint64_t latency_sum_us;
+};
+
+/**
+ * @brief Register a channel.
+ *
+ * @param callback callback of the channel.
+ * @param arg argument of the callback.
+ * @param priority priority of the channel, 0 is the highest. Channels with the same
+ *        priority run in the registration order.
+ * @param channel registered channel.
+ * @return SID_ERROR_NONE on success, SID_ERROR_NULL_POINTER when a pointer is NULL,
+ *         SID_ERROR_OOM when all CONFIG_SIDEWALK_SWI_CHANNELS channels are registered.
+ */
+sid_error_t sid_swi_service_register(sid_swi_service_cb_t callback, void *arg, uint8_t priority,
+				     uint8_t *channel);
+
+/**
+ * @brief Unregister a channel, a pending callback does not run.
+ *
+ * @param channel channel to unregister.
+ * @return SID_ERROR_NONE on success, SID_ERROR_INVALID_ARGS when the channel is not registered.
+ */
+sid_error_t sid_swi_service_unregister(uint8_t channel);
+
+/**
+ * @brief Mark a channel pending. Can be called from an interrupt.
+ *
+ * A channel triggered again before its callback started runs once.
+ *
+ * @param channel channel to trigger.
+ * @return SID_ERROR_NONE on success, SID_ERROR_INVALID_ARGS when the channel is not registered.
+ */
+sid_error_t sid_swi_service_trigger(uint8_t channel);
+
+/**
+ * @brief Get the statistics of a channel.
+ *
+ * @param channel channel.
+ * @param stats buffer for the statistics.
+ * @return SID_ERROR_NONE on success, SID_ERROR_INVALID_ARGS when the channel is not registered,
+ *         SID_ERROR_NULL_POINTER when @p stats is NULL.
+ */
+sid_error_t sid_swi_service_stats_get(uint8_t channel, struct sid_swi_channel_stats *stats);
+
+/**
+ * @brief Clear the statistics of every channel.
+ */
+void sid_swi_service_stats_reset(void);
+
+#endif /* SID_SWI_SERVICE_H */
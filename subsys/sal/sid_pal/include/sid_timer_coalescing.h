@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_timer_coalescing.h
+ *  @brief Sidewalk timer wakeup coalescing.
+ */
+
+#ifndef SID_TIMER_COALESCING_H
+#define SID_TIMER_COALESCING_H
+
+#include <sid_pal_timer_ifc.h>
+
+#include <stdint.h>
+
+/**
+ * @brief Arm a low power timer with a custom tolerance.
+ *
+ * Works like @ref sid_pal_timer_arm with SID_PAL_TIMER_PRIO_CLASS_LOWPOWER,
+ * but the timer can be handled anywhere in [when, when + tolerance]
+ * (and in the same window for every period).
+ *
+ * @param timer_storage timer to arm.
+ * @param when absolute time of the first expiry.
+ * @param period period of the timer, NULL for a one shot timer.
+ * @param tolerance maximum delay of the timer, zero for a precise timer.
+ *                  Not copied, it has to stay valid until the timer expires or is canceled
+ *                  (for a periodic timer until it is canceled).
+ * @return SID_ERROR_NONE on success, SID_ERROR_INVALID_ARGS when a parameter is invalid
+ *         (also a tolerance which is not normalized) or the timer is already armed.
+ */
+sid_error_t sid_pal_timer_arm_with_tolerance(sid_pal_timer_t *timer_storage,
+					     const struct sid_timespec *when,
+					     const struct sid_timespec *period,
+					     const struct sid_timespec *tolerance);
+
+/**
+ * @brief Get the number of hardware wakeups avoided by coalescing.
+ *
+ * Every timer alarm handled by a wakeup scheduled for an earlier alarm
+ * counts as one avoided wakeup.
+ *
+ * @return number of avoided wakeups since boot or the last reset.
+ */
+uint32_t sid_timer_coalescing_wakeups_avoided(void);
+
+/**
+ * @brief Clear the avoided wakeups counter.
+ */
+void sid_timer_coalescing_reset(void);
+
+#endif /* SID_TIMER_COALESCING_H */
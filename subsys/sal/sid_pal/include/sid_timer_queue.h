@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_timer_queue.h
+ *  @brief Sidewalk timer queue backend API.
+ *
+ *  The queue keeps armed timers ordered by alarm. It is not thread safe,
+ *  the caller has to hold the timer critical region for every call.
+ */
+
+#ifndef SID_TIMER_QUEUE_H
+#define SID_TIMER_QUEUE_H
+
+#include <sid_pal_timer_types.h>
+#include <sid_time_ops.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef CONFIG_SIDEWALK_TIMER_TICKS
+/** Point in time used to order the queue, absolute kernel ticks. */
+typedef uint64_t sid_timer_queue_time_t;
+
+#define SID_TIMER_QUEUE_TIME_INFINITY (UINT64_MAX)
+#else
+/** Point in time used to order the queue. */
+typedef struct sid_timespec sid_timer_queue_time_t;
+
+#define SID_TIMER_QUEUE_TIME_INFINITY                                                              \
+	((struct sid_timespec){ .tv_sec = UINT32_MAX, .tv_nsec = UINT32_MAX })
+#endif /* CONFIG_SIDEWALK_TIMER_TICKS */
+
+/**
+ * @brief Check if @p a is later than @p b.
+ *
+ * @param a first point in time.
+ * @param b second point in time.
+ * @return true when @p a is later than @p b.
+ */
+static inline bool sid_timer_queue_time_gt(const sid_timer_queue_time_t *a,
+					   const sid_timer_queue_time_t *b)
+{
+#ifdef CONFIG_SIDEWALK_TIMER_TICKS
+	return *a > *b;
+#else
+	return sid_time_gt(a, b);
+#endif /* CONFIG_SIDEWALK_TIMER_TICKS */
+}
+
+#ifdef CONFIG_SIDEWALK_TIMER_TICKS
+/**
+ * @brief Get the alarm of a timer in the queue time.
+ *
+ * The alarm is rounded up to kernel ticks. Recent conversions are cached,
+ * so ordering the queue does not convert the same alarm again.
+ *
+ * @param timer armed timer.
+ * @return alarm of the timer.
+ */
+sid_timer_queue_time_t sid_timer_queue_alarm(const sid_pal_timer_t *timer);
+
+/**
+ * @brief Get the tolerance of a timer in the queue time.
+ *
+ * @param timer armed timer.
+ * @return tolerance of the timer, rounded down to kernel ticks.
+ */
+sid_timer_queue_time_t sid_timer_queue_tolerance(const sid_pal_timer_t *timer);
+#else
+/**
+ * @brief Get the alarm of a timer in the queue time.
+ *
+ * @param timer armed timer.
+ * @return alarm of the timer.
+ */
+static inline sid_timer_queue_time_t sid_timer_queue_alarm(const sid_pal_timer_t *timer)
+{
+	return timer->alarm;
+}
+#endif /* CONFIG_SIDEWALK_TIMER_TICKS */
+
+/**
+ * @brief Check if timer @p a expires before timer @p b.
+ *
+ * @param a first timer.
+ * @param b second timer.
+ * @return true when alarm of @p a is earlier than alarm of @p b.
+ */
+static inline bool sid_timer_queue_is_before(const sid_pal_timer_t *a, const sid_pal_timer_t *b)
+{
+	sid_timer_queue_time_t alarm_a = sid_timer_queue_alarm(a);
+	sid_timer_queue_time_t alarm_b = sid_timer_queue_alarm(b);
+
+	return sid_timer_queue_time_gt(&alarm_b, &alarm_a);
+}
+
+/**
+ * @brief Check if the alarm of a timer is not later than @p time.
+ *
+ * @param timer armed timer.
+ * @param time point in time.
+ * @return true when the timer is due at @p time.
+ */
+static inline bool sid_timer_queue_is_due(const sid_pal_timer_t *timer,
+					  const sid_timer_queue_time_t *time)
+{
+	sid_timer_queue_time_t alarm = sid_timer_queue_alarm(timer);
+
+	return !sid_timer_queue_time_gt(&alarm, time);
+}
+
+/**
+ * @brief Move the alarm of a timer to the alarm of a later timer.
+ *
+ * The alarm is moved only when it stays in the tolerance of @p timer.
+ *
+ * @param timer timer to move.
+ * @param to timer with a later alarm.
+ */
+static inline void sid_timer_queue_snap(sid_pal_timer_t *timer, const sid_pal_timer_t *to)
+{
+#ifdef CONFIG_SIDEWALK_TIMER_TICKS
+	if ((sid_timer_queue_alarm(to) - sid_timer_queue_alarm(timer)) <=
+	    sid_timer_queue_tolerance(timer)) {
+		timer->alarm = to->alarm;
+	}
+#else
+	struct sid_timespec diff = to->alarm;
+
+	sid_time_sub(&diff, &timer->alarm);
+	if (!sid_time_gt(&diff, timer->tolerance)) {
+		timer->alarm = to->alarm;
+	}
+#endif /* CONFIG_SIDEWALK_TIMER_TICKS */
+}
+
+/**
+ * @brief Initialize queue links of a timer.
+ *
+ * @param timer timer to initialize.
+ */
+void sid_timer_queue_node_init(sid_pal_timer_t *timer);
+
+/**
+ * @brief Insert timer into the queue.
+ *
+ * The alarm of a timer may be moved forward to an alarm of an already queued timer,
+ * when it fits in the tolerance of the inserted timer. With CONFIG_SIDEWALK_TIMER_COALESCING
+ * the alarm is kept, the tolerance is taken into account by @ref sid_timer_queue_deadline.
+ *
+ * @param timer timer to insert, must not be queued.
+ */
+void sid_timer_queue_insert(sid_pal_timer_t *timer);
+
+/**
+ * @brief Remove timer from the queue, from the expired list or from another list
+ *        linked through the timer node.
+ *
+ * @param timer timer to remove, not queued timer is ignored.
+ */
+void sid_timer_queue_remove(sid_pal_timer_t *timer);
+
+/**
+ * @brief Check if timer is in the queue or in another list linked through the timer node.
+ *
+ * @param timer timer to check.
+ * @return true when timer is queued.
+ */
+bool sid_timer_queue_is_queued(const sid_pal_timer_t *timer);
+
+/**
+ * @brief Get the earliest timer without removing it.
+ *
+ * @return the earliest timer or NULL when the queue is empty.
+ */
+sid_pal_timer_t *sid_timer_queue_peek(void);
+
+/**
+ * @brief Remove and return the earliest timer.
+ *
+ * @return the earliest timer or NULL when the queue is empty.
+ */
+sid_pal_timer_t *sid_timer_queue_pop(void);
+
+/**
+ * @brief Move all timers with alarm not later than @p now to the expired list.
+ *
+ * Expired timers keep the alarm order and stay queued until taken
+ * with @ref sid_timer_queue_pop_expired.
+ *
+ * @param now current time.
+ */
+void sid_timer_queue_expire(const sid_timer_queue_time_t *now);
+
+/**
+ * @brief Remove and return the earliest expired timer.
+ *
+ * @return the earliest expired timer or NULL when the expired list is empty.
+ */
+sid_pal_timer_t *sid_timer_queue_pop_expired(void);
+
+#ifdef CONFIG_SIDEWALK_TIMER_COALESCING
+/**
+ * @brief Get the end of the window in which timer can be handled.
+ *
+ * @param timer queued timer.
+ * @param latest alarm of the timer increased by its tolerance.
+ */
+static inline void sid_timer_queue_latest(const sid_pal_timer_t *timer,
+					  sid_timer_queue_time_t *latest)
+{
+#ifdef CONFIG_SIDEWALK_TIMER_TICKS
+	sid_timer_queue_time_t alarm = sid_timer_queue_alarm(timer);
+	sid_timer_queue_time_t tolerance = sid_timer_queue_tolerance(timer);
+
+	/* Saturated, so the window of a timer armed for infinity never ends. */
+	*latest = (tolerance > SID_TIMER_QUEUE_TIME_INFINITY - alarm) ?
+			  SID_TIMER_QUEUE_TIME_INFINITY :
+			  (alarm + tolerance);
+#else
+	*latest = timer->alarm;
+	/* The window of a timer armed for infinity never ends. */
+	if (!sid_time_is_infinity(latest)) {
+		sid_time_add(latest, timer->tolerance);
+	}
+#endif /* CONFIG_SIDEWALK_TIMER_TICKS */
+}
+
+/**
+ * @brief Get the wakeup time which handles the most queued timers.
+ *
+ * The end of the earliest window is the latest wakeup which handles every
+ * timer in time, any later wakeup would miss that window. Every window started
+ * by then is covered too, so no other wakeup covers more windows.
+ *
+ * @param deadline wakeup time, SID_TIMER_QUEUE_TIME_INFINITY when the queue is empty.
+ */
+void sid_timer_queue_deadline(sid_timer_queue_time_t *deadline);
+#endif /* CONFIG_SIDEWALK_TIMER_COALESCING */
+
+#endif /* SID_TIMER_QUEUE_H */
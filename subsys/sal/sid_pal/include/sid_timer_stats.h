@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_timer_stats.h
+ *  @brief Sidewalk timer instrumentation.
+ */
+
+#ifndef SID_TIMER_STATS_H
+#define SID_TIMER_STATS_H
+
+#include <sid_pal_timer_ifc.h>
+
+#include <stdint.h>
+
+/* Bucket 0 counts 0 us, bucket n counts [2^(n-1), 2^n) us, the last bucket counts the rest. */
+#define SID_TIMER_STATS_HIST_BUCKETS (24)
+
+#define SID_TIMER_STATS_PRIO_CLASS_NUM (SID_PAL_TIMER_PRIO_CLASS_LOWPOWER + 1)
+
+struct sid_timer_stats_hist {
+	uint32_t buckets[SID_TIMER_STATS_HIST_BUCKETS];
+	uint32_t count;
+	uint32_t max_us;
+	uint64_t sum_us;
+};
+
+struct sid_timer_stats {
+	/* Time between the timer alarm and the moment it has been handled, per priority class. */
+	struct sid_timer_stats_hist lateness[SID_TIMER_STATS_PRIO_CLASS_NUM];
+	/* Time of every critical region taken while handling the timer event. */
+	struct sid_timer_stats_hist lock_hold;
+	/* Time spent in the timer callbacks. */
+	struct sid_timer_stats_hist callback;
+	/* Number of handled timer events. */
+	uint32_t events;
+};
+
+/**
+ * @brief Get the histogram bucket for a value.
+ *
+ * @param value_us value in microseconds.
+ * @return bucket index.
+ */
+static inline uint32_t sid_timer_stats_bucket(uint32_t value_us)
+{
+	uint32_t bucket = value_us ? (32 - __builtin_clz(value_us)) : 0;
+
+	return (bucket < SID_TIMER_STATS_HIST_BUCKETS) ? bucket : (SID_TIMER_STATS_HIST_BUCKETS - 1);
+}
+
+/**
+ * @brief Get a consistent copy of the timer statistics.
+ *
+ * @param stats buffer for the statistics.
+ */
+void sid_timer_stats_get(struct sid_timer_stats *stats);
+
+/**
+ * @brief Clear the timer statistics.
+ */
+void sid_timer_stats_reset(void);
+
+#endif /* SID_TIMER_STATS_H */
@@ -9,19 +9,144 @@
  */
 
 #include <sid_pal_critical_region_ifc.h>
+#include <sid_critical_region_lock.h>
 #include <assert.h>
 
 #include <zephyr/kernel.h>
 
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_PROFILER
+#include <sid_critical_region_profiler.h>
+#include <string.h>
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_PROFILER */
+
+SID_REGION_LOCK_DEFINE(region);
+
 static atomic_t count = ATOMIC_INIT(0);
-static unsigned int key = 0;
+static sid_region_key_t key;
+
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_SPINLOCK
+/*
+ * With the spinlock the nesting counter is not enough, another CPU would see it set.
+ * Only the CPU holding the spinlock (with its interrupts locked) skips the locking.
+ */
+static atomic_t owner = ATOMIC_INIT(-1);
+
+static bool region_owned(void)
+{
+	const unsigned int irq_key = arch_irq_lock();
+	const bool owned = (atomic_get(&owner) == arch_curr_cpu()->id);
+
+	arch_irq_unlock(irq_key);
+	return owned;
+}
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_SPINLOCK */
+
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_PROFILER
+static struct sid_critical_region_profile profile;
+static uintptr_t hold_caller;
+static uint32_t hold_begin;
+
+/* Has to be called with the region locked. */
+static void profiler_record(uintptr_t caller, uint32_t cycles)
+{
+	struct sid_critical_region_site *site = NULL;
+	struct sid_critical_region_site *shortest = NULL;
+
+	profile.count++;
+	for (uint32_t i = 0; i < profile.sites_num; i++) {
+		if (profile.sites[i].caller == caller) {
+			site = &profile.sites[i];
+			break;
+		}
+		if (!shortest || profile.sites[i].max_cycles < shortest->max_cycles) {
+			shortest = &profile.sites[i];
+		}
+	}
+
+	if (!site) {
+		if (profile.sites_num < ARRAY_SIZE(profile.sites)) {
+			site = &profile.sites[profile.sites_num++];
+		} else if (cycles > shortest->max_cycles) {
+			/* Keep the worst call sites, the shortest one makes room. */
+			site = shortest;
+			profile.evicted++;
+		} else {
+			return;
+		}
+		*site = (struct sid_critical_region_site){ .caller = caller };
+	}
+
+	site->count++;
+	site->sum_cycles += cycles;
+	site->max_cycles = MAX(site->max_cycles, cycles);
+}
+
+void sid_critical_region_profiler_get(struct sid_critical_region_profile *result)
+{
+	sid_region_key_t lock_key;
+
+	if (!result) {
+		return;
+	}
+
+	lock_key = sid_region_lock(&region);
+	*result = profile;
+	sid_region_unlock(&region, lock_key);
+
+	/* Sort the copy, so interrupts are not locked for the sorting. */
+	for (uint32_t i = 1; i < result->sites_num; i++) {
+		struct sid_critical_region_site site = result->sites[i];
+		uint32_t j = i;
+
+		for (; j > 0 && result->sites[j - 1].max_cycles < site.max_cycles; j--) {
+			result->sites[j] = result->sites[j - 1];
+		}
+		result->sites[j] = site;
+	}
+}
+
+void sid_critical_region_profiler_reset(void)
+{
+	const sid_region_key_t lock_key = sid_region_lock(&region);
+
+	memset(&profile, 0, sizeof(profile));
+	sid_region_unlock(&region, lock_key);
+}
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_PROFILER */
+
+/* Has to be called right after the region has been locked. */
+static inline void profiler_hold_begin(uintptr_t caller)
+{
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_PROFILER
+	hold_caller = caller;
+	hold_begin = k_cycle_get_32();
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_PROFILER */
+}
+
+/* Has to be called right before the region is unlocked. */
+static inline void profiler_hold_end(void)
+{
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_PROFILER
+	profiler_record(hold_caller, k_cycle_get_32() - hold_begin);
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_PROFILER */
+}
 
 void sid_pal_enter_critical_region()
 {
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_SPINLOCK
+	if (!region_owned()) {
+		key = sid_region_lock(&region);
+		atomic_set(&owner, arch_curr_cpu()->id);
+	}
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_SPINLOCK */
+
 	const unsigned int prev_val = atomic_add(&count, 1);
 
 	if (prev_val == 0) {
-		key = irq_lock();
+#ifndef CONFIG_SIDEWALK_CRITICAL_REGION_SPINLOCK
+		key = sid_region_lock(&region);
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_SPINLOCK */
+		profiler_hold_begin((uintptr_t)__builtin_return_address(0));
 	}
 
 	assert(prev_val <= CONFIG_SIDEWALK_CRITICAL_REGION_RE_ENTRY_MAX);
@@ -34,6 +159,10 @@ void sid_pal_exit_critical_region()
 	assert(prev_val > 0);
 
 	if (prev_val == 1) {
-		irq_unlock(key);
+		profiler_hold_end();
+#ifdef CONFIG_SIDEWALK_CRITICAL_REGION_SPINLOCK
+		atomic_set(&owner, -1);
+#endif /* CONFIG_SIDEWALK_CRITICAL_REGION_SPINLOCK */
+		sid_region_unlock(&region, key);
 	}
 }
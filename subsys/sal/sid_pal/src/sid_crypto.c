@@ -12,6 +12,18 @@
 #ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
 #include <sid_crypto_keys.h>
 #endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
+#ifdef CONFIG_SIDEWALK_CRYPTO_KEY_CACHE
+#include <sid_crypto_key_cache.h>
+#endif /* CONFIG_SIDEWALK_CRYPTO_KEY_CACHE */
+#ifdef CONFIG_SIDEWALK_CRYPTO_RAND_POOL
+#include <sid_crypto_rand_pool.h>
+#endif /* CONFIG_SIDEWALK_CRYPTO_RAND_POOL */
+#include <sid_crypto_stream.h>
+#include <sid_crypto_stats.h>
+#include <sid_crypto_batch.h>
+#ifdef CONFIG_SIDEWALK_CRYPTO_STATS
+#include <sid_critical_region_lock.h>
+#endif /* CONFIG_SIDEWALK_CRYPTO_STATS */
 
 #include <zephyr/device.h>
 #include <zephyr/kernel.h>
@@ -33,8 +45,12 @@ LOG_MODULE_REGISTER(sid_crypto, CONFIG_SIDEWALK_CRYPTO_LOG_LEVEL);
 #define SECP256R1_KEY_LEN_BITS (256)
 #define ED25519_KEY_LEN_BITS (255)
 
-/* Data chunk used in cryptographic algorithm. */
-#define ALGO_DATA_CHUNK (32)
+/* Largest part of the hash and HMAC input given to PSA in one call. */
+#if CONFIG_SIDEWALK_CRYPTO_DATA_CHUNK_SIZE > 0
+#define ALGO_DATA_CHUNK (CONFIG_SIDEWALK_CRYPTO_DATA_CHUNK_SIZE)
+#else
+#define ALGO_DATA_CHUNK (SIZE_MAX)
+#endif /* CONFIG_SIDEWALK_CRYPTO_DATA_CHUNK_SIZE */
 
 /* Max. EC key buffer length in bytes. */
 #define EC_MAX_KEY_LENGTH (65)
@@ -66,16 +82,127 @@ LOG_MODULE_REGISTER(sid_crypto, CONFIG_SIDEWALK_CRYPTO_LOG_LEVEL);
 	((SID_PAL_CRYPTO_VERIFY == _mode) ? PSA_KEY_TYPE_ECC_PUBLIC_KEY(_type) :                   \
 					    PSA_KEY_TYPE_ECC_KEY_PAIR(_type))
 
+/* Sid algorithms to the algorithms of the statistics. */
+#define AES_STATS_ALGO(_algo)                                                                      \
+	((SID_PAL_AES_CTR_128 == _algo) ? SID_CRYPTO_STATS_AES_CTR : SID_CRYPTO_STATS_AES_CMAC)
+#define AEAD_STATS_ALGO(_algo)                                                                     \
+	((SID_PAL_AEAD_GCM_128 == _algo) ? SID_CRYPTO_STATS_AES_GCM : SID_CRYPTO_STATS_AES_CCM)
+#define HASH_STATS_ALGO(_algo)                                                                     \
+	((SID_PAL_HASH_SHA512 == _algo) ? SID_CRYPTO_STATS_SHA512 : SID_CRYPTO_STATS_SHA256)
+#define HMAC_STATS_ALGO(_algo)                                                                     \
+	((SID_PAL_HASH_SHA512 == _algo) ? SID_CRYPTO_STATS_HMAC_SHA512 :                           \
+					  SID_CRYPTO_STATS_HMAC_SHA256)
+#define ECC_STATS_ALGO(_algo)                                                                      \
+	((SID_PAL_ECDH_CURVE25519 == _algo) ?                                                      \
+		 SID_CRYPTO_STATS_X25519 :                                                         \
+		 ((SID_PAL_EDDSA_ED25519 == _algo) ? SID_CRYPTO_STATS_ED25519 :                    \
+						     SID_CRYPTO_STATS_P256))
+
 /* Crypto initialization global flag. */
 static bool is_initialized = false;
 
+#ifdef CONFIG_SIDEWALK_CRYPTO_STATS
+SID_REGION_LOCK_DEFINE(crypto_stats_lock);
+static struct sid_crypto_stats crypto_stats;
+
+static const char *const crypto_stats_names[SID_CRYPTO_STATS_ALGO_NUM] = {
+	[SID_CRYPTO_STATS_AES_CTR] = "AES-CTR",
+	[SID_CRYPTO_STATS_AES_CMAC] = "AES-CMAC",
+	[SID_CRYPTO_STATS_AES_GCM] = "AES-GCM",
+	[SID_CRYPTO_STATS_AES_CCM] = "AES-CCM",
+	[SID_CRYPTO_STATS_SHA256] = "SHA-256",
+	[SID_CRYPTO_STATS_SHA512] = "SHA-512",
+	[SID_CRYPTO_STATS_HMAC_SHA256] = "HMAC-SHA256",
+	[SID_CRYPTO_STATS_HMAC_SHA512] = "HMAC-SHA512",
+	[SID_CRYPTO_STATS_ED25519] = "Ed25519",
+	[SID_CRYPTO_STATS_P256] = "P-256",
+	[SID_CRYPTO_STATS_X25519] = "X25519",
+	[SID_CRYPTO_STATS_RAND] = "RNG",
+};
+
+const char *sid_crypto_stats_algo_name(enum sid_crypto_stats_algo algo)
+{
+	return (algo < SID_CRYPTO_STATS_ALGO_NUM) ? crypto_stats_names[algo] : "unknown";
+}
+
+void sid_crypto_stats_get(struct sid_crypto_stats *stats)
+{
+	if (!stats) {
+		return;
+	}
+
+	SID_REGION_LOCKED(&crypto_stats_lock)
+	{
+		*stats = crypto_stats;
+	}
+}
+
+void sid_crypto_stats_reset(void)
+{
+	SID_REGION_LOCKED(&crypto_stats_lock)
+	{
+		memset(&crypto_stats, 0, sizeof(crypto_stats));
+	}
+}
+#endif /* CONFIG_SIDEWALK_CRYPTO_STATS */
+
+/* Has to be called right before the measured operation. */
+static inline uint32_t crypto_stats_begin(void)
+{
+#ifdef CONFIG_SIDEWALK_CRYPTO_STATS
+	return k_cycle_get_32();
+#else
+	return 0;
+#endif /* CONFIG_SIDEWALK_CRYPTO_STATS */
+}
+
+/*
+ * Record the calls of the measured operation, every call with the average latency.
+ * The bytes are recorded only for a successful operation.
+ */
+static inline void crypto_stats_end(enum sid_crypto_stats_algo algo, uint32_t calls, size_t bytes,
+				    uint32_t begin, sid_error_t erc)
+{
+#ifdef CONFIG_SIDEWALK_CRYPTO_STATS
+	const uint32_t cycles = k_cycle_get_32() - begin;
+	const uint32_t call_cycles = calls ? (cycles / calls) : cycles;
+	struct sid_crypto_stats_algo_stats *entry = &crypto_stats.algo[algo];
+
+	SID_REGION_LOCKED(&crypto_stats_lock)
+	{
+		entry->calls += calls;
+		if (SID_ERROR_NONE == erc) {
+			entry->bytes += bytes;
+		} else {
+			entry->failures++;
+		}
+		entry->latency.buckets[sid_crypto_stats_bucket(call_cycles)] += calls;
+		entry->latency.max_cycles = MAX(entry->latency.max_cycles, call_cycles);
+		entry->latency.sum_cycles += cycles;
+	}
+#else
+	ARG_UNUSED(algo);
+	ARG_UNUSED(calls);
+	ARG_UNUSED(bytes);
+	ARG_UNUSED(begin);
+	ARG_UNUSED(erc);
+#endif /* CONFIG_SIDEWALK_CRYPTO_STATS */
+}
+
 /* Prefix for uncompressed public key */
 static const uint8_t secpxxx_key_prefix[SECPxxx_KEY_PREFIX_LEN] = { 0x04 };
 
 static sid_error_t get_error(psa_status_t psa_erc, const char *func_name);
+static psa_status_t import_key(const uint8_t *key, size_t key_length, size_t key_bits,
+			       psa_key_usage_t usage_flags, psa_algorithm_t alg, psa_key_type_t type,
+			       psa_key_handle_t *key_handle);
 static psa_status_t prepare_key(const uint8_t *key, size_t key_length, size_t key_bits,
 				psa_key_usage_t usage_flags, psa_algorithm_t alg,
 				psa_key_type_t type, psa_key_handle_t *key_handle);
+static psa_status_t prepare_cached_key(const uint8_t *key, size_t key_length, size_t key_bits,
+				       psa_key_usage_t usage_flags, psa_algorithm_t alg,
+				       psa_key_type_t type, psa_key_handle_t *key_handle);
+static void release_key(psa_key_handle_t key_handle);
 static psa_status_t aes_execute(psa_cipher_operation_t *operation, sid_pal_aes_params_t *params);
 static psa_status_t aes_encrypt(psa_key_handle_t key_handle, sid_pal_aes_params_t *params);
 static psa_status_t aes_decrypt(psa_key_handle_t key_handle, sid_pal_aes_params_t *params);
@@ -130,6 +257,62 @@ static sid_error_t get_error(psa_status_t psa_erc, const char *func_name)
 	return sid_erc;
 }
 
+/**
+ * @brief The function imports binaries key as a volatile key.
+ *
+ * @param key - binary key buffer.
+ * @param key_length - key length in bytes.
+ * @param key_bits - key length in bits.
+ * @param usage_flags - define which opeartions are permitted with te key.
+ * @param alg - key permitted-algorithm policy.
+ * @param type - key type.
+ * @param key_handle - handle to imported key.
+ *
+ * @return PSA_SUCCESS when success, otherwise error code.
+ */
+static psa_status_t import_key(const uint8_t *key, size_t key_length, size_t key_bits,
+			       psa_key_usage_t usage_flags, psa_algorithm_t alg, psa_key_type_t type,
+			       psa_key_handle_t *key_handle)
+{
+	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+	psa_status_t status;
+
+	psa_set_key_usage_flags(&attributes, usage_flags);
+	psa_set_key_lifetime(&attributes, PSA_KEY_LIFETIME_VOLATILE);
+	psa_set_key_algorithm(&attributes, alg);
+	psa_set_key_type(&attributes, type);
+	psa_set_key_bits(&attributes, key_bits);
+
+	status = psa_import_key(&attributes, key, key_length, key_handle);
+	if (PSA_SUCCESS == status) {
+		psa_reset_key_attributes(&attributes);
+	}
+
+	return status;
+}
+
+/**
+ * @brief Check if the key buffer holds an id of a persistent Sidewalk key.
+ *
+ * @param key - binary key buffer.
+ * @param key_length - key length in bytes.
+ * @param key_handle - handle to the persistent key.
+ *
+ * @return true when the key buffer holds a persistent key id.
+ */
+static bool storage_key_get(const uint8_t *key, size_t key_length, psa_key_handle_t *key_handle)
+{
+#ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
+	int err = sid_crypto_keys_buffer_get(key_handle, (uint8_t *)key, key_length);
+	return (!err && SID_CRYPTO_KEYS_ID_IS_SIDEWALK_KEY(*key_handle));
+#else
+	ARG_UNUSED(key);
+	ARG_UNUSED(key_length);
+	ARG_UNUSED(key_handle);
+	return false;
+#endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
+}
+
 /**
  * @brief The function prepares binaries key for use in cryptographic algorithms.
  *
@@ -147,32 +330,288 @@ static psa_status_t prepare_key(const uint8_t *key, size_t key_length, size_t ke
 				psa_key_usage_t usage_flags, psa_algorithm_t alg,
 				psa_key_type_t type, psa_key_handle_t *key_handle)
 {
-	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+	if (!key_handle) {
+		return PSA_ERROR_DATA_INVALID;
+	}
+
+	if (storage_key_get(key, key_length, key_handle)) {
+		return PSA_SUCCESS;
+	}
+
+	return import_key(key, key_length, key_bits, usage_flags, alg, type, key_handle);
+}
+
+#ifdef CONFIG_SIDEWALK_CRYPTO_KEY_CACHE
+#define KEY_CACHE_DIGEST_SIZE PSA_HASH_LENGTH(PSA_ALG_SHA_256)
+
+struct key_cache_entry {
+	psa_key_handle_t handle;
+	psa_key_usage_t usage;
+	psa_algorithm_t alg;
+	psa_key_type_t type;
+	size_t bits;
+	/* Value of key_cache_clock at the last use. */
+	uint32_t last_use;
+	/* Number of operations using the key. */
+	uint8_t refs;
+	bool valid;
+	/* Invalidated while in use, destroyed when released. */
+	bool stale;
+	uint8_t digest[KEY_CACHE_DIGEST_SIZE];
+};
+
+static K_MUTEX_DEFINE(key_cache_mutex);
+static struct key_cache_entry key_cache[CONFIG_SIDEWALK_CRYPTO_KEY_CACHE_SIZE];
+static uint32_t key_cache_clock;
+static struct sid_crypto_key_cache_stats key_cache_stats;
+
+static bool key_cache_digest_equal(const uint8_t *a, const uint8_t *b)
+{
+	uint8_t diff = 0;
+
+	/* Constant time, the digest is derived from a secret key. */
+	for (size_t i = 0; i < KEY_CACHE_DIGEST_SIZE; i++) {
+		diff |= a[i] ^ b[i];
+	}
+	return diff == 0;
+}
+
+/* Has to be called with the mutex locked. */
+static void key_cache_entry_destroy(struct key_cache_entry *entry)
+{
+	if (PSA_SUCCESS != psa_destroy_key(entry->handle)) {
+		LOG_WRN("Destroy key failed!");
+	}
+	memset(entry, 0, sizeof(*entry));
+}
+
+/* Has to be called with the mutex locked. */
+static struct key_cache_entry *key_cache_find(const uint8_t *digest, size_t key_bits,
+					      psa_key_usage_t usage_flags, psa_algorithm_t alg,
+					      psa_key_type_t type)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(key_cache); i++) {
+		struct key_cache_entry *entry = &key_cache[i];
+
+		if (entry->valid && !entry->stale && entry->usage == usage_flags &&
+		    entry->alg == alg && entry->type == type && entry->bits == key_bits &&
+		    key_cache_digest_equal(entry->digest, digest)) {
+			return entry;
+		}
+	}
+	return NULL;
+}
+
+/* Has to be called with the mutex locked. Returns NULL when all keys are in use. */
+static struct key_cache_entry *key_cache_victim(void)
+{
+	struct key_cache_entry *victim = NULL;
+
+	for (size_t i = 0; i < ARRAY_SIZE(key_cache); i++) {
+		struct key_cache_entry *entry = &key_cache[i];
+
+		if (!entry->valid) {
+			return entry;
+		}
+		if (!entry->refs && (!victim || (int32_t)(entry->last_use - victim->last_use) < 0)) {
+			victim = entry;
+		}
+	}
+	return victim;
+}
+
+static psa_status_t key_cache_acquire(const uint8_t *key, size_t key_length, size_t key_bits,
+				      psa_key_usage_t usage_flags, psa_algorithm_t alg,
+				      psa_key_type_t type, psa_key_handle_t *key_handle)
+{
+	uint8_t digest[KEY_CACHE_DIGEST_SIZE];
+	struct key_cache_entry *entry;
+	size_t digest_length;
 	psa_status_t status;
 
+	status = psa_hash_compute(PSA_ALG_SHA_256, key, key_length, digest, sizeof(digest),
+				  &digest_length);
+	if (PSA_SUCCESS != status) {
+		return status;
+	}
+
+	k_mutex_lock(&key_cache_mutex, K_FOREVER);
+	entry = key_cache_find(digest, key_bits, usage_flags, alg, type);
+	if (entry) {
+		key_cache_stats.hits++;
+	} else {
+		key_cache_stats.misses++;
+		entry = key_cache_victim();
+		if (entry && entry->valid) {
+			key_cache_stats.evictions++;
+			key_cache_entry_destroy(entry);
+		}
+
+		status = import_key(key, key_length, key_bits, usage_flags, alg, type, key_handle);
+		if (PSA_SUCCESS == status && entry) {
+			*entry = (struct key_cache_entry){
+				.handle = *key_handle,
+				.usage = usage_flags,
+				.alg = alg,
+				.type = type,
+				.bits = key_bits,
+				.valid = true,
+			};
+			memcpy(entry->digest, digest, sizeof(digest));
+		} else {
+			/* Not cached, release_key() destroys it. */
+			entry = NULL;
+		}
+	}
+
+	if (entry) {
+		entry->refs++;
+		entry->last_use = ++key_cache_clock;
+		*key_handle = entry->handle;
+	}
+	k_mutex_unlock(&key_cache_mutex);
+
+	return status;
+}
+
+/* Returns false when the key is not cached. */
+static bool key_cache_release(psa_key_handle_t key_handle)
+{
+	bool cached = false;
+
+	k_mutex_lock(&key_cache_mutex, K_FOREVER);
+	for (size_t i = 0; i < ARRAY_SIZE(key_cache); i++) {
+		struct key_cache_entry *entry = &key_cache[i];
+
+		if (entry->valid && entry->handle == key_handle) {
+			entry->refs--;
+			if (entry->stale && !entry->refs) {
+				key_cache_entry_destroy(entry);
+			}
+			cached = true;
+			break;
+		}
+	}
+	k_mutex_unlock(&key_cache_mutex);
+
+	return cached;
+}
+
+/* Has to be called with the mutex locked. */
+static void key_cache_entry_invalidate(struct key_cache_entry *entry)
+{
+	if (entry->refs) {
+		entry->stale = true;
+	} else {
+		key_cache_entry_destroy(entry);
+	}
+}
+
+void sid_crypto_key_cache_invalidate(void)
+{
+	k_mutex_lock(&key_cache_mutex, K_FOREVER);
+	for (size_t i = 0; i < ARRAY_SIZE(key_cache); i++) {
+		if (key_cache[i].valid) {
+			key_cache_entry_invalidate(&key_cache[i]);
+		}
+	}
+	k_mutex_unlock(&key_cache_mutex);
+}
+
+void sid_crypto_key_cache_invalidate_key(const uint8_t *key, size_t key_size)
+{
+	uint8_t digest[KEY_CACHE_DIGEST_SIZE];
+	size_t digest_length;
+
+	if (!key || PSA_SUCCESS != psa_hash_compute(PSA_ALG_SHA_256, key, key_size, digest,
+						    sizeof(digest), &digest_length)) {
+		return;
+	}
+
+	k_mutex_lock(&key_cache_mutex, K_FOREVER);
+	for (size_t i = 0; i < ARRAY_SIZE(key_cache); i++) {
+		if (key_cache[i].valid && key_cache_digest_equal(key_cache[i].digest, digest)) {
+			key_cache_entry_invalidate(&key_cache[i]);
+		}
+	}
+	k_mutex_unlock(&key_cache_mutex);
+}
+
+void sid_crypto_key_cache_stats_get(struct sid_crypto_key_cache_stats *stats)
+{
+	if (!stats) {
+		return;
+	}
+
+	k_mutex_lock(&key_cache_mutex, K_FOREVER);
+	*stats = key_cache_stats;
+	k_mutex_unlock(&key_cache_mutex);
+}
+
+void sid_crypto_key_cache_stats_reset(void)
+{
+	k_mutex_lock(&key_cache_mutex, K_FOREVER);
+	memset(&key_cache_stats, 0, sizeof(key_cache_stats));
+	k_mutex_unlock(&key_cache_mutex);
+}
+#endif /* CONFIG_SIDEWALK_CRYPTO_KEY_CACHE */
+
+/**
+ * @brief The function prepares binaries key for use in cryptographic algorithms,
+ * the key is taken from the key cache when enabled. The key must be released with release_key().
+ *
+ * @param key - binary key buffer.
+ * @param key_length - key length in bytes.
+ * @param key_bits - key length in bits.
+ * @param usage_flags - define which opeartions are permitted with te key.
+ * @param alg - key permitted-algorithm policy.
+ * @param type - key type.
+ * @param key_handle - handle to key (null when key cannot be set).
+ *
+ * @return PSA_SUCCESS when success, otherwise error code.
+ */
+static psa_status_t prepare_cached_key(const uint8_t *key, size_t key_length, size_t key_bits,
+				       psa_key_usage_t usage_flags, psa_algorithm_t alg,
+				       psa_key_type_t type, psa_key_handle_t *key_handle)
+{
+#ifdef CONFIG_SIDEWALK_CRYPTO_KEY_CACHE
 	if (!key_handle) {
 		return PSA_ERROR_DATA_INVALID;
 	}
 
-#ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
-	int err = sid_crypto_keys_buffer_get(key_handle, (uint8_t *)key, key_length);
-	if (!err && SID_CRYPTO_KEYS_ID_IS_SIDEWALK_KEY(*key_handle)) {
+	if (storage_key_get(key, key_length, key_handle)) {
 		return PSA_SUCCESS;
 	}
-#endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
 
-	psa_set_key_usage_flags(&attributes, usage_flags);
-	psa_set_key_lifetime(&attributes, PSA_KEY_LIFETIME_VOLATILE);
-	psa_set_key_algorithm(&attributes, alg);
-	psa_set_key_type(&attributes, type);
-	psa_set_key_bits(&attributes, key_bits);
+	return key_cache_acquire(key, key_length, key_bits, usage_flags, alg, type, key_handle);
+#else
+	return prepare_key(key, key_length, key_bits, usage_flags, alg, type, key_handle);
+#endif /* CONFIG_SIDEWALK_CRYPTO_KEY_CACHE */
+}
 
-	status = psa_import_key(&attributes, key, key_length, key_handle);
-	if (PSA_SUCCESS == status) {
-		psa_reset_key_attributes(&attributes);
+/**
+ * @brief Release the key prepared with prepare_key() or prepare_cached_key().
+ *
+ * @param key_handle - handle to key.
+ */
+static void release_key(psa_key_handle_t key_handle)
+{
+#ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
+	if (SID_CRYPTO_KEYS_ID_IS_SIDEWALK_KEY(key_handle)) {
+		sid_crypto_keys_used(key_handle);
+		return;
+	}
+#endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
+
+#ifdef CONFIG_SIDEWALK_CRYPTO_KEY_CACHE
+	if (key_cache_release(key_handle)) {
+		return;
 	}
+#endif /* CONFIG_SIDEWALK_CRYPTO_KEY_CACHE */
 
-	return status;
+	if (PSA_SUCCESS != psa_destroy_key(key_handle)) {
+		LOG_WRN("Destroy key failed!");
+	}
 }
 
 /**
@@ -379,6 +818,9 @@ sid_error_t sid_pal_crypto_init(void)
 
 	if (PSA_SUCCESS == status) {
 		is_initialized = true;
+#ifdef CONFIG_SIDEWALK_CRYPTO_RAND_POOL
+		sid_crypto_rand_pool_init();
+#endif /* CONFIG_SIDEWALK_CRYPTO_RAND_POOL */
 		LOG_DBG("Init success!");
 	} else {
 		LOG_ERR("Init failed! (sts: %d)", status);
@@ -389,6 +831,14 @@ sid_error_t sid_pal_crypto_init(void)
 
 sid_error_t sid_pal_crypto_deinit(void)
 {
+#ifdef CONFIG_SIDEWALK_CRYPTO_RAND_POOL
+	sid_crypto_rand_pool_deinit();
+#endif /* CONFIG_SIDEWALK_CRYPTO_RAND_POOL */
+
+#ifdef CONFIG_SIDEWALK_CRYPTO_KEY_CACHE
+	sid_crypto_key_cache_invalidate();
+#endif /* CONFIG_SIDEWALK_CRYPTO_KEY_CACHE */
+
 #ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
 	int err = sid_crypto_keys_deinit();
 	if (err) {
@@ -415,13 +865,107 @@ sid_error_t sid_pal_crypto_rand(uint8_t *rand, size_t size)
 		return SID_ERROR_INVALID_ARGS;
 	}
 
-	return get_error(psa_generate_random(rand, size), __func__);
+	const uint32_t stats_begin = crypto_stats_begin();
+#ifdef CONFIG_SIDEWALK_CRYPTO_RAND_POOL
+	sid_error_t erc = get_error(sid_crypto_rand_pool_generate(rand, size), __func__);
+#else
+	sid_error_t erc = get_error(psa_generate_random(rand, size), __func__);
+#endif /* CONFIG_SIDEWALK_CRYPTO_RAND_POOL */
+	crypto_stats_end(SID_CRYPTO_STATS_RAND, 1, size, stats_begin, erc);
+	return erc;
+}
+
+/**
+ * @brief Add the data to the hash, in parts of at most ALGO_DATA_CHUNK bytes.
+ *
+ * @param operation - hash operation.
+ * @param data - data to add.
+ * @param data_size - size of the data, can be 0.
+ *
+ * @return PSA_SUCCESS when success, otherwise error code.
+ */
+static psa_status_t hash_update(psa_hash_operation_t *operation, const uint8_t *data,
+				size_t data_size)
+{
+	psa_status_t status;
+	size_t offset = 0;
+
+	do {
+		size_t data_chunk = MIN(data_size - offset, ALGO_DATA_CHUNK);
+
+		status = psa_hash_update(operation, &data[offset], data_chunk);
+		offset += data_chunk;
+	} while ((PSA_SUCCESS == status) && (offset < data_size));
+
+	return status;
+}
+
+/**
+ * @brief Add the data to the MAC, in parts of at most ALGO_DATA_CHUNK bytes.
+ *
+ * @param operation - MAC operation.
+ * @param data - data to add.
+ * @param data_size - size of the data, can be 0.
+ *
+ * @return PSA_SUCCESS when success, otherwise error code.
+ */
+static psa_status_t mac_update(psa_mac_operation_t *operation, const uint8_t *data,
+			       size_t data_size)
+{
+	psa_status_t status;
+	size_t offset = 0;
+
+	do {
+		size_t data_chunk = MIN(data_size - offset, ALGO_DATA_CHUNK);
+
+		status = psa_mac_update(operation, &data[offset], data_chunk);
+		offset += data_chunk;
+	} while ((PSA_SUCCESS == status) && (offset < data_size));
+
+	return status;
+}
+
+/**
+ * @brief Calculate the hash, in one call when the data fits in ALGO_DATA_CHUNK.
+ *
+ * @param alg - PSA hash algorithm.
+ * @param data - data to hash.
+ * @param data_size - size of the data.
+ * @param digest - buffer for the digest.
+ * @param digest_size - size of the buffer.
+ * @param hash_length - size of the calculated digest.
+ *
+ * @return PSA_SUCCESS when success, otherwise error code.
+ */
+static psa_status_t hash_compute(psa_algorithm_t alg, const uint8_t *data, size_t data_size,
+				 uint8_t *digest, size_t digest_size, size_t *hash_length)
+{
+	psa_hash_operation_t operation = PSA_HASH_OPERATION_INIT;
+	psa_status_t status;
+
+	if (data_size <= ALGO_DATA_CHUNK) {
+		return psa_hash_compute(alg, data, data_size, digest, digest_size, hash_length);
+	}
+
+	status = psa_hash_setup(&operation, alg);
+	if (PSA_SUCCESS == status) {
+		status = hash_update(&operation, data, data_size);
+	}
+	if (PSA_SUCCESS == status) {
+		status = psa_hash_finish(&operation, digest, digest_size, hash_length);
+	}
+	if (PSA_SUCCESS != status) {
+		(void)psa_hash_abort(&operation);
+	}
+
+	return status;
 }
 
 sid_error_t sid_pal_crypto_hash(sid_pal_hash_params_t *params)
 {
 	psa_algorithm_t alg_sha;
 	size_t hash_length;
+	sid_error_t erc;
 
 	if (!is_initialized) {
 		return SID_ERROR_UNINITIALIZED;
@@ -446,9 +990,12 @@ sid_error_t sid_pal_crypto_hash(sid_pal_hash_params_t *params)
 		return SID_ERROR_NOSUPPORT;
 	}
 
-	return get_error(psa_hash_compute(alg_sha, params->data, params->data_size, params->digest,
-					  params->digest_size, &hash_length),
-			 __func__);
+	const uint32_t stats_begin = crypto_stats_begin();
+	erc = get_error(hash_compute(alg_sha, params->data, params->data_size, params->digest,
+				     params->digest_size, &hash_length),
+			__func__);
+	crypto_stats_end(HASH_STATS_ALGO(params->algo), 1, params->data_size, stats_begin, erc);
+	return erc;
 }
 
 sid_error_t sid_pal_crypto_hmac(sid_pal_hmac_params_t *params)
@@ -457,6 +1004,7 @@ sid_error_t sid_pal_crypto_hmac(sid_pal_hmac_params_t *params)
 	psa_mac_operation_t operation = PSA_MAC_OPERATION_INIT;
 	psa_algorithm_t alg_sha;
 	psa_key_handle_t key_handle;
+	sid_error_t erc;
 
 	if (!is_initialized) {
 		return SID_ERROR_UNINITIALIZED;
@@ -481,10 +1029,11 @@ sid_error_t sid_pal_crypto_hmac(sid_pal_hmac_params_t *params)
 		return SID_ERROR_NOSUPPORT;
 	}
 
+	const uint32_t stats_begin = crypto_stats_begin();
 	// NOTE: key_size is in bytes.
-	status = prepare_key(params->key, params->key_size, BYTE_TO_BITS(params->key_size),
-			     PSA_KEY_USAGE_SIGN_HASH, PSA_ALG_HMAC(alg_sha), PSA_KEY_TYPE_HMAC,
-			     &key_handle);
+	status = prepare_cached_key(params->key, params->key_size, BYTE_TO_BITS(params->key_size),
+				    PSA_KEY_USAGE_SIGN_HASH, PSA_ALG_HMAC(alg_sha),
+				    PSA_KEY_TYPE_HMAC, &key_handle);
 
 	if (PSA_SUCCESS == status) {
 		size_t hmac_length;
@@ -492,20 +1041,8 @@ sid_error_t sid_pal_crypto_hmac(sid_pal_hmac_params_t *params)
 		status = psa_mac_sign_setup(&operation, key_handle, PSA_ALG_HMAC(alg_sha));
 
 		if (PSA_SUCCESS == status) {
-			size_t offset = 0;
-			size_t data_chunk = ALGO_DATA_CHUNK;
-			size_t s_left = params->data_size;
-
 			LOG_DBG("psa_mac_sign_setup success.");
-			do {
-				data_chunk = MIN(s_left, data_chunk);
-
-				status = psa_mac_update(&operation, &params->data[offset],
-							data_chunk);
-
-				offset += data_chunk;
-				s_left -= data_chunk;
-			} while ((PSA_SUCCESS == status) && (0 != s_left));
+			status = mac_update(&operation, params->data, params->data_size);
 
 			if (PSA_SUCCESS == status) {
 				LOG_DBG("psa_mac_update success.");
@@ -517,33 +1054,264 @@ sid_error_t sid_pal_crypto_hmac(sid_pal_hmac_params_t *params)
 			}
 		}
 
-#ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
-		if (!SID_CRYPTO_KEYS_ID_IS_SIDEWALK_KEY(key_handle)) {
-			if (PSA_SUCCESS != psa_destroy_key(key_handle)) {
-				LOG_WRN("Destroy key failed!");
-			}
-		}
-#else
-		if (PSA_SUCCESS != psa_destroy_key(key_handle)) {
-			LOG_WRN("Destroy key failed!");
-		}
-#endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
+		release_key(key_handle);
 	}
 
-	return get_error(status, __func__);
+	erc = get_error(status, __func__);
+	crypto_stats_end(HMAC_STATS_ALGO(params->algo), 1, params->data_size, stats_begin, erc);
+	return erc;
 }
 
-sid_error_t sid_pal_crypto_aes_crypt(sid_pal_aes_params_t *params)
-{
-	psa_status_t status = PSA_ERROR_NOT_SUPPORTED;
-	psa_algorithm_t alg;
-	size_t key_len = BYTE_TO_BITS(AES_128_KEY_LENGTH);
-	psa_key_handle_t key_handle;
+/**
+ * @brief Get the PSA algorithm of the Sidewalk hash algorithm.
+ *
+ * @param algo - Sidewalk hash algorithm.
+ * @param alg_sha - PSA hash algorithm.
+ *
+ * @return true when the algorithm is supported.
+ */
+static bool get_hash_alg(sid_pal_hash_algo_t algo, psa_algorithm_t *alg_sha)
+{
+	switch (algo) {
+	case SID_PAL_HASH_SHA256:
+		*alg_sha = PSA_ALG_SHA_256;
+		return true;
+	case SID_PAL_HASH_SHA512:
+		*alg_sha = PSA_ALG_SHA_512;
+		return true;
+	default:
+		return false;
+	}
+}
+
+sid_error_t sid_pal_crypto_hash_init(sid_pal_hash_ctx_t *ctx, sid_pal_hash_algo_t algo)
+{
+	psa_algorithm_t alg_sha;
+
+	if (!is_initialized) {
+		return SID_ERROR_UNINITIALIZED;
+	}
+
+	if (!ctx) {
+		return SID_ERROR_NULL_POINTER;
+	}
+
+	if (!get_hash_alg(algo, &alg_sha)) {
+		return SID_ERROR_NOSUPPORT;
+	}
+
+	ctx->operation = psa_hash_operation_init();
+	return get_error(psa_hash_setup(&ctx->operation, alg_sha), __func__);
+}
+
+sid_error_t sid_pal_crypto_hash_update(sid_pal_hash_ctx_t *ctx, const uint8_t *data,
+				       size_t data_size)
+{
+	psa_status_t status;
+
+	if (!ctx || (!data && data_size)) {
+		return SID_ERROR_NULL_POINTER;
+	}
+
+	status = hash_update(&ctx->operation, data, data_size);
+	if (PSA_SUCCESS != status) {
+		(void)psa_hash_abort(&ctx->operation);
+	}
+
+	return get_error(status, __func__);
+}
+
+sid_error_t sid_pal_crypto_hash_finish(sid_pal_hash_ctx_t *ctx, uint8_t *digest,
+				       size_t digest_size)
+{
+	psa_status_t status;
+	size_t hash_length;
+
+	if (!ctx || !digest) {
+		return SID_ERROR_NULL_POINTER;
+	}
+
+	status = psa_hash_finish(&ctx->operation, digest, digest_size, &hash_length);
+	if (PSA_SUCCESS != status) {
+		(void)psa_hash_abort(&ctx->operation);
+	}
+
+	return get_error(status, __func__);
+}
+
+sid_error_t sid_pal_crypto_hash_verify(sid_pal_hash_ctx_t *ctx, const uint8_t *digest,
+				       size_t digest_size)
+{
+	psa_status_t status;
+
+	if (!ctx || !digest) {
+		return SID_ERROR_NULL_POINTER;
+	}
+
+	status = psa_hash_verify(&ctx->operation, digest, digest_size);
+	if (PSA_SUCCESS != status) {
+		(void)psa_hash_abort(&ctx->operation);
+	}
+
+	return get_error(status, __func__);
+}
+
+sid_error_t sid_pal_crypto_hash_abort(sid_pal_hash_ctx_t *ctx)
+{
+	if (!ctx) {
+		return SID_ERROR_NULL_POINTER;
+	}
+
+	return get_error(psa_hash_abort(&ctx->operation), __func__);
+}
+
+/**
+ * @brief End the multi-part HMAC and release its key.
+ *
+ * @param ctx - HMAC context.
+ * @param status - status of the last operation, the HMAC is aborted on failure.
+ * @param func_name - name of the caller.
+ *
+ * @return sidewalk error code of the status.
+ */
+static sid_error_t hmac_end(sid_pal_hmac_ctx_t *ctx, psa_status_t status, const char *func_name)
+{
+	if (PSA_SUCCESS != status) {
+		(void)psa_mac_abort(&ctx->operation);
+	}
+
+	if (PSA_KEY_ID_NULL != ctx->key_handle) {
+		release_key(ctx->key_handle);
+		ctx->key_handle = PSA_KEY_ID_NULL;
+	}
+
+	return get_error(status, func_name);
+}
+
+sid_error_t sid_pal_crypto_hmac_init(sid_pal_hmac_ctx_t *ctx, sid_pal_hash_algo_t algo,
+				     const uint8_t *key, size_t key_size)
+{
+	psa_algorithm_t alg_sha;
+	psa_status_t status;
 
 	if (!is_initialized) {
 		return SID_ERROR_UNINITIALIZED;
 	}
 
+	if (!ctx || !key) {
+		return SID_ERROR_NULL_POINTER;
+	}
+
+	if (!key_size) {
+		return SID_ERROR_INVALID_ARGS;
+	}
+
+	if (!get_hash_alg(algo, &alg_sha)) {
+		return SID_ERROR_NOSUPPORT;
+	}
+
+	ctx->operation = psa_mac_operation_init();
+	ctx->key_handle = PSA_KEY_ID_NULL;
+
+	// NOTE: key_size is in bytes.
+	status = prepare_cached_key(key, key_size, BYTE_TO_BITS(key_size), PSA_KEY_USAGE_SIGN_HASH,
+				    PSA_ALG_HMAC(alg_sha), PSA_KEY_TYPE_HMAC, &ctx->key_handle);
+	if (PSA_SUCCESS != status) {
+		ctx->key_handle = PSA_KEY_ID_NULL;
+		return get_error(status, __func__);
+	}
+
+	/* The operation is set up for signing, verification compares the MAC on finish. */
+	status = psa_mac_sign_setup(&ctx->operation, ctx->key_handle, PSA_ALG_HMAC(alg_sha));
+	if (PSA_SUCCESS != status) {
+		return hmac_end(ctx, status, __func__);
+	}
+
+	return SID_ERROR_NONE;
+}
+
+sid_error_t sid_pal_crypto_hmac_update(sid_pal_hmac_ctx_t *ctx, const uint8_t *data,
+				       size_t data_size)
+{
+	psa_status_t status;
+
+	if (!ctx || (!data && data_size)) {
+		return SID_ERROR_NULL_POINTER;
+	}
+
+	status = mac_update(&ctx->operation, data, data_size);
+	if (PSA_SUCCESS != status) {
+		return hmac_end(ctx, status, __func__);
+	}
+
+	return SID_ERROR_NONE;
+}
+
+sid_error_t sid_pal_crypto_hmac_finish(sid_pal_hmac_ctx_t *ctx, uint8_t *digest,
+				       size_t digest_size)
+{
+	size_t hmac_length;
+
+	if (!ctx || !digest) {
+		return SID_ERROR_NULL_POINTER;
+	}
+
+	return hmac_end(ctx,
+			psa_mac_sign_finish(&ctx->operation, digest, digest_size, &hmac_length),
+			__func__);
+}
+
+sid_error_t sid_pal_crypto_hmac_verify(sid_pal_hmac_ctx_t *ctx, const uint8_t *digest,
+				       size_t digest_size)
+{
+	uint8_t mac[PSA_MAC_MAX_SIZE];
+	size_t mac_length;
+	psa_status_t status;
+	uint8_t diff = 0;
+
+	if (!ctx || !digest) {
+		return SID_ERROR_NULL_POINTER;
+	}
+
+	status = psa_mac_sign_finish(&ctx->operation, mac, sizeof(mac), &mac_length);
+	if (PSA_SUCCESS == status) {
+		if (digest_size != mac_length) {
+			status = PSA_ERROR_INVALID_SIGNATURE;
+		} else {
+			/* Constant time comparison. */
+			for (size_t i = 0; i < mac_length; i++) {
+				diff |= mac[i] ^ digest[i];
+			}
+			if (diff) {
+				status = PSA_ERROR_INVALID_SIGNATURE;
+			}
+		}
+	}
+
+	return hmac_end(ctx, status, __func__);
+}
+
+sid_error_t sid_pal_crypto_hmac_abort(sid_pal_hmac_ctx_t *ctx)
+{
+	if (!ctx) {
+		return SID_ERROR_NULL_POINTER;
+	}
+
+	return hmac_end(ctx, psa_mac_abort(&ctx->operation), __func__);
+}
+
+/**
+ * @brief Check the AES parameters.
+ *
+ * @param params - AES parameters.
+ * @param alg - PSA algorithm of the parameters.
+ *
+ * @return SID_ERROR_NONE when the parameters are valid.
+ */
+static sid_error_t aes_params_check(sid_pal_aes_params_t *params, psa_algorithm_t *alg)
+{
+	size_t key_len = BYTE_TO_BITS(AES_128_KEY_LENGTH);
+
 	if (!params || !params->key || !params->in || !params->out ||
 	    ((SID_PAL_AES_CTR_128 == params->algo) && !params->iv)) {
 		return SID_ERROR_NULL_POINTER;
@@ -555,11 +1323,11 @@ sid_error_t sid_pal_crypto_aes_crypt(sid_pal_aes_params_t *params)
 
 	switch (params->algo) {
 	case SID_PAL_AES_CMAC_128:
-		alg = PSA_ALG_CMAC;
+		*alg = PSA_ALG_CMAC;
 		key_len = BYTE_TO_BITS(AES_128_KEY_LENGTH);
 		break;
 	case SID_PAL_AES_CTR_128:
-		alg = PSA_ALG_CTR;
+		*alg = PSA_ALG_CTR;
 		key_len = BYTE_TO_BITS(AES_128_KEY_LENGTH);
 		break;
 	default:
@@ -568,67 +1336,98 @@ sid_error_t sid_pal_crypto_aes_crypt(sid_pal_aes_params_t *params)
 
 	if ((key_len != params->key_size) ||
 	    ((SID_PAL_AES_CTR_128 == params->algo) &&
-	     params->iv_size != PSA_CIPHER_IV_LENGTH(PSA_KEY_TYPE_AES, alg))) {
+	     params->iv_size != PSA_CIPHER_IV_LENGTH(PSA_KEY_TYPE_AES, *alg))) {
 		// Log is only for debug purpose, in other case use error code.
 		LOG_DBG("Incorrect %s length.", (key_len != params->key_size) ? "key" : "IV");
 		return SID_ERROR_INVALID_ARGS;
 	}
 
-	// NOTE: key_size is in bits.
-	status = prepare_key(params->key, BITS_TO_BYTE(params->key_size), params->key_size,
-			     AES_MODE_TO_USAGE(params->mode), alg, PSA_KEY_TYPE_AES, &key_handle);
-
-	if (PSA_SUCCESS == status) {
-		LOG_DBG("Key import success");
+	return SID_ERROR_NONE;
+}
 
-		switch (params->mode) {
-		case SID_PAL_CRYPTO_ENCRYPT:
-			status = aes_encrypt(key_handle, params);
-			LOG_DBG("AES encrypt %s", (PSA_SUCCESS == status) ? "success." : "failed!");
-			break;
-		case SID_PAL_CRYPTO_DECRYPT:
-			status = aes_decrypt(key_handle, params);
-			LOG_DBG("AES decrypt %s", (PSA_SUCCESS == status) ? "success." : "failed!");
-			break;
-		case SID_PAL_CRYPTO_MAC_CALCULATE: {
-			size_t out_len;
+/**
+ * @brief Run the AES operation with the prepared key.
+ *
+ * @param key_handle - key to use for the operation.
+ * @param params - AES parameters.
+ * @param alg - PSA algorithm of the parameters.
+ *
+ * @return PSA_SUCCESS when success, otherwise error code.
+ */
+static psa_status_t aes_run(psa_key_handle_t key_handle, sid_pal_aes_params_t *params,
+			    psa_algorithm_t alg)
+{
+	psa_status_t status;
 
-			status = psa_mac_compute(key_handle, alg, params->in, params->in_size,
-						 params->out, params->out_size, &out_len);
-			LOG_DBG("Mac calculate %s",
-				(PSA_SUCCESS == status) ? "success." : "failed!");
-		} break;
-		default:
-			return SID_ERROR_INVALID_ARGS;
-		}
+	switch (params->mode) {
+	case SID_PAL_CRYPTO_ENCRYPT:
+		status = aes_encrypt(key_handle, params);
+		LOG_DBG("AES encrypt %s", (PSA_SUCCESS == status) ? "success." : "failed!");
+		break;
+	case SID_PAL_CRYPTO_DECRYPT:
+		status = aes_decrypt(key_handle, params);
+		LOG_DBG("AES decrypt %s", (PSA_SUCCESS == status) ? "success." : "failed!");
+		break;
+	case SID_PAL_CRYPTO_MAC_CALCULATE: {
+		size_t out_len;
 
-#ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
-		if (!SID_CRYPTO_KEYS_ID_IS_SIDEWALK_KEY(key_handle)) {
-			if (PSA_SUCCESS != psa_destroy_key(key_handle)) {
-				LOG_WRN("Destroy key failed!");
-			}
-		}
-#else
-		if (PSA_SUCCESS != psa_destroy_key(key_handle)) {
-			LOG_WRN("Destroy key failed!");
-		}
-#endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
+		status = psa_mac_compute(key_handle, alg, params->in, params->in_size, params->out,
+					 params->out_size, &out_len);
+		LOG_DBG("Mac calculate %s", (PSA_SUCCESS == status) ? "success." : "failed!");
+	} break;
+	default:
+		status = PSA_ERROR_INVALID_ARGUMENT;
+		break;
 	}
 
-	return get_error(status, __func__);
+	return status;
 }
 
-sid_error_t sid_pal_crypto_aead_crypt(sid_pal_aead_params_t *params)
+sid_error_t sid_pal_crypto_aes_crypt(sid_pal_aes_params_t *params)
 {
 	psa_status_t status = PSA_ERROR_NOT_SUPPORTED;
 	psa_algorithm_t alg;
 	psa_key_handle_t key_handle;
-	size_t key_len = BYTE_TO_BITS(AES_128_KEY_LENGTH);
+	sid_error_t erc;
 
 	if (!is_initialized) {
 		return SID_ERROR_UNINITIALIZED;
 	}
 
+	erc = aes_params_check(params, &alg);
+	if (SID_ERROR_NONE != erc) {
+		return erc;
+	}
+
+	const uint32_t stats_begin = crypto_stats_begin();
+	// NOTE: key_size is in bits.
+	status = prepare_cached_key(params->key, BITS_TO_BYTE(params->key_size), params->key_size,
+				    AES_MODE_TO_USAGE(params->mode), alg, PSA_KEY_TYPE_AES,
+				    &key_handle);
+
+	if (PSA_SUCCESS == status) {
+		LOG_DBG("Key import success");
+		status = aes_run(key_handle, params, alg);
+		release_key(key_handle);
+	}
+
+	erc = get_error(status, __func__);
+	crypto_stats_end(AES_STATS_ALGO(params->algo), 1, params->in_size, stats_begin, erc);
+	return erc;
+}
+
+/**
+ * @brief Check the AEAD parameters.
+ *
+ * @param params - AEAD parameters.
+ * @param alg - PSA algorithm of the parameters.
+ *
+ * @return SID_ERROR_NONE when the parameters are valid.
+ */
+static sid_error_t aead_params_check(sid_pal_aead_params_t *params, psa_algorithm_t *alg)
+{
+	size_t key_len = BYTE_TO_BITS(AES_128_KEY_LENGTH);
+
 	if (!params || !params->key || !params->in || !params->out || !params->aad ||
 	    !params->mac) {
 		return SID_ERROR_NULL_POINTER;
@@ -640,11 +1439,11 @@ sid_error_t sid_pal_crypto_aead_crypt(sid_pal_aead_params_t *params)
 
 	switch (params->algo) {
 	case SID_PAL_AEAD_GCM_128:
-		alg = PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_GCM, params->mac_size);
+		*alg = PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_GCM, params->mac_size);
 		key_len = BYTE_TO_BITS(AES_128_KEY_LENGTH);
 		break;
 	case SID_PAL_AEAD_CCM_128:
-		alg = PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, params->mac_size);
+		*alg = PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, params->mac_size);
 		key_len = BYTE_TO_BITS(AES_128_KEY_LENGTH);
 		break;
 	case SID_PAL_AEAD_CCM_STAR_128:
@@ -657,46 +1456,207 @@ sid_error_t sid_pal_crypto_aead_crypt(sid_pal_aead_params_t *params)
 	}
 
 	if ((NULL != params->iv) &&
-	    (params->iv_size != PSA_AEAD_NONCE_LENGTH(PSA_KEY_TYPE_AES, alg))) {
+	    (params->iv_size != PSA_AEAD_NONCE_LENGTH(PSA_KEY_TYPE_AES, *alg))) {
 		return SID_ERROR_INVALID_ARGS;
 	}
 
+	return SID_ERROR_NONE;
+}
+
+/**
+ * @brief Run the AEAD operation with the prepared key.
+ *
+ * @param key_handle - key to use for the operation.
+ * @param params - AEAD parameters.
+ * @param alg - PSA algorithm of the parameters.
+ *
+ * @return PSA_SUCCESS when success, otherwise error code.
+ */
+static psa_status_t aead_run(psa_key_handle_t key_handle, sid_pal_aead_params_t *params,
+			     psa_algorithm_t alg)
+{
+	psa_status_t status;
+
+	switch (params->mode) {
+	case SID_PAL_CRYPTO_ENCRYPT:
+		status = aead_encrypt(key_handle, params, alg);
+		LOG_DBG("AEAD encrypt %s", (PSA_SUCCESS == status) ? "success." : "failed!");
+		break;
+	case SID_PAL_CRYPTO_DECRYPT:
+		status = aead_decrypt(key_handle, params, alg);
+		LOG_DBG("AEAD decrypt %s", (PSA_SUCCESS == status) ? "success." : "failed!");
+		break;
+	default:
+		status = PSA_ERROR_INVALID_ARGUMENT;
+		break;
+	}
+
+	return status;
+}
+
+sid_error_t sid_pal_crypto_aead_crypt(sid_pal_aead_params_t *params)
+{
+	psa_status_t status = PSA_ERROR_NOT_SUPPORTED;
+	psa_algorithm_t alg;
+	psa_key_handle_t key_handle;
+	sid_error_t erc;
+
+	if (!is_initialized) {
+		return SID_ERROR_UNINITIALIZED;
+	}
+
+	erc = aead_params_check(params, &alg);
+	if (SID_ERROR_NONE != erc) {
+		return erc;
+	}
+
+	const uint32_t stats_begin = crypto_stats_begin();
 	// NOTE: key_size is in bits.
-	status = prepare_key(params->key, BITS_TO_BYTE(params->key_size), params->key_size,
-			     AES_MODE_TO_USAGE(params->mode), alg, PSA_KEY_TYPE_AES, &key_handle);
+	status = prepare_cached_key(params->key, BITS_TO_BYTE(params->key_size), params->key_size,
+				    AES_MODE_TO_USAGE(params->mode), alg, PSA_KEY_TYPE_AES,
+				    &key_handle);
 
 	if (PSA_SUCCESS == status) {
 		LOG_DBG("Key import success.");
+		status = aead_run(key_handle, params, alg);
+		release_key(key_handle);
+	}
 
-		switch (params->mode) {
-		case SID_PAL_CRYPTO_ENCRYPT:
-			status = aead_encrypt(key_handle, params, alg);
-			LOG_DBG("AEAD encrypt %s",
-				(PSA_SUCCESS == status) ? "success." : "failed!");
-			break;
-		case SID_PAL_CRYPTO_DECRYPT:
-			status = aead_decrypt(key_handle, params, alg);
-			LOG_DBG("AEAD decrypt %s",
-				(PSA_SUCCESS == status) ? "success." : "failed!");
-			break;
-		default:
+	erc = get_error(status, __func__);
+	crypto_stats_end(AEAD_STATS_ALGO(params->algo), 1, params->in_size, stats_begin, erc);
+	return erc;
+}
+
+/**
+ * @brief Check that a batch frame uses the key and the operation of the first frame.
+ *
+ * @return true when the frame can be processed with the key of the first frame.
+ */
+static bool batch_key_shared(const uint8_t *key, const uint8_t *first_key, size_t key_bits)
+{
+	return key == first_key || !memcmp(key, first_key, BITS_TO_BYTE(key_bits));
+}
+
+sid_error_t sid_pal_crypto_aes_crypt_batch(sid_pal_aes_params_t *params, size_t count,
+					   size_t *processed)
+{
+	psa_status_t status;
+	psa_algorithm_t alg = PSA_ALG_NONE;
+	psa_key_handle_t key_handle;
+	sid_error_t erc;
+	size_t bytes = 0;
+
+	if (!is_initialized) {
+		return SID_ERROR_UNINITIALIZED;
+	}
+
+	if (!params || !processed) {
+		return SID_ERROR_NULL_POINTER;
+	}
+
+	*processed = 0;
+	if (!count) {
+		return SID_ERROR_INVALID_ARGS;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		psa_algorithm_t frame_alg;
+
+		erc = aes_params_check(&params[i], &frame_alg);
+		if (SID_ERROR_NONE != erc) {
+			return erc;
+		}
+		if (i == 0) {
+			alg = frame_alg;
+		} else if (frame_alg != alg || params[i].mode != params[0].mode ||
+			   !batch_key_shared(params[i].key, params[0].key, params[0].key_size)) {
 			return SID_ERROR_INVALID_ARGS;
 		}
+	}
 
-#ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
-		if (!SID_CRYPTO_KEYS_ID_IS_SIDEWALK_KEY(key_handle)) {
-			if (PSA_SUCCESS != psa_destroy_key(key_handle)) {
-				LOG_WRN("Destroy key failed!");
+	const uint32_t stats_begin = crypto_stats_begin();
+	// NOTE: key_size is in bits.
+	status = prepare_cached_key(params[0].key, BITS_TO_BYTE(params[0].key_size),
+				    params[0].key_size, AES_MODE_TO_USAGE(params[0].mode), alg,
+				    PSA_KEY_TYPE_AES, &key_handle);
+
+	if (PSA_SUCCESS == status) {
+		for (size_t i = 0; i < count && PSA_SUCCESS == status; i++) {
+			status = aes_run(key_handle, &params[i], alg);
+			if (PSA_SUCCESS == status) {
+				bytes += params[i].in_size;
+				(*processed)++;
 			}
 		}
-#else
-		if (PSA_SUCCESS != psa_destroy_key(key_handle)) {
-			LOG_WRN("Destroy key failed!");
+		release_key(key_handle);
+	}
+
+	erc = get_error(status, __func__);
+	/* The failed frame is counted as a call. */
+	crypto_stats_end(AES_STATS_ALGO(params[0].algo), *processed + (erc ? 1 : 0), bytes,
+			 stats_begin, erc);
+	return erc;
+}
+
+sid_error_t sid_pal_crypto_aead_crypt_batch(sid_pal_aead_params_t *params, size_t count,
+					    size_t *processed)
+{
+	psa_status_t status;
+	psa_algorithm_t alg = PSA_ALG_NONE;
+	psa_key_handle_t key_handle;
+	sid_error_t erc;
+	size_t bytes = 0;
+
+	if (!is_initialized) {
+		return SID_ERROR_UNINITIALIZED;
+	}
+
+	if (!params || !processed) {
+		return SID_ERROR_NULL_POINTER;
+	}
+
+	*processed = 0;
+	if (!count) {
+		return SID_ERROR_INVALID_ARGS;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		psa_algorithm_t frame_alg;
+
+		erc = aead_params_check(&params[i], &frame_alg);
+		if (SID_ERROR_NONE != erc) {
+			return erc;
+		}
+		if (i == 0) {
+			alg = frame_alg;
+		} else if (frame_alg != alg || params[i].mode != params[0].mode ||
+			   !batch_key_shared(params[i].key, params[0].key, params[0].key_size)) {
+			return SID_ERROR_INVALID_ARGS;
 		}
-#endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
 	}
 
-	return get_error(status, __func__);
+	const uint32_t stats_begin = crypto_stats_begin();
+	// NOTE: key_size is in bits.
+	status = prepare_cached_key(params[0].key, BITS_TO_BYTE(params[0].key_size),
+				    params[0].key_size, AES_MODE_TO_USAGE(params[0].mode), alg,
+				    PSA_KEY_TYPE_AES, &key_handle);
+
+	if (PSA_SUCCESS == status) {
+		for (size_t i = 0; i < count && PSA_SUCCESS == status; i++) {
+			status = aead_run(key_handle, &params[i], alg);
+			if (PSA_SUCCESS == status) {
+				bytes += params[i].in_size;
+				(*processed)++;
+			}
+		}
+		release_key(key_handle);
+	}
+
+	erc = get_error(status, __func__);
+	/* The failed frame is counted as a call. */
+	crypto_stats_end(AEAD_STATS_ALGO(params[0].algo), *processed + (erc ? 1 : 0), bytes,
+			 stats_begin, erc);
+	return erc;
 }
 
 sid_error_t sid_pal_crypto_ecc_dsa(sid_pal_dsa_params_t *params)
@@ -709,6 +1669,7 @@ sid_error_t sid_pal_crypto_ecc_dsa(sid_pal_dsa_params_t *params)
 	uint8_t key[EC_MAX_KEY_LENGTH];
 	uint8_t key_offset = 0;
 	size_t key_size = 0;
+	sid_error_t erc;
 
 	if (!is_initialized) {
 		return SID_ERROR_UNINITIALIZED;
@@ -752,6 +1713,7 @@ sid_error_t sid_pal_crypto_ecc_dsa(sid_pal_dsa_params_t *params)
 	key_size = MIN(sizeof(key), key_size);
 	memcpy(&key[key_offset], params->key, key_size - key_offset);
 
+	const uint32_t stats_begin = crypto_stats_begin();
 	// NOTE: key_size is in bytes.
 	status = prepare_key(key, key_size, key_len, ECDSA_MODE_TO_USAGE(params->mode), alg,
 			     ECC_FAMILY_TYPE(params->mode, type), &key_handle);
@@ -777,20 +1739,12 @@ sid_error_t sid_pal_crypto_ecc_dsa(sid_pal_dsa_params_t *params)
 			return SID_ERROR_INVALID_ARGS;
 		}
 
-#ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
-		if (!SID_CRYPTO_KEYS_ID_IS_SIDEWALK_KEY(key_handle)) {
-			if (PSA_SUCCESS != psa_destroy_key(key_handle)) {
-				LOG_WRN("Destroy key failed!");
-			}
-		}
-#else
-		if (PSA_SUCCESS != psa_destroy_key(key_handle)) {
-			LOG_WRN("Destroy key failed!");
-		}
-#endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
+		release_key(key_handle);
 	}
 
-	return get_error(status, __func__);
+	erc = get_error(status, __func__);
+	crypto_stats_end(ECC_STATS_ALGO(params->algo), 1, params->in_size, stats_begin, erc);
+	return erc;
 }
 
 sid_error_t sid_pal_crypto_ecc_ecdh(sid_pal_ecdh_params_t *params)
@@ -802,6 +1756,7 @@ sid_error_t sid_pal_crypto_ecc_ecdh(sid_pal_ecdh_params_t *params)
 	uint8_t pub_key[EC_MAX_KEY_LENGTH];
 	uint8_t pub_key_offset = 0;
 	size_t pub_key_size = 0;
+	sid_error_t erc;
 
 	if (!is_initialized) {
 		return SID_ERROR_UNINITIALIZED;
@@ -833,6 +1788,7 @@ sid_error_t sid_pal_crypto_ecc_ecdh(sid_pal_ecdh_params_t *params)
 		return SID_ERROR_NOSUPPORT;
 	}
 
+	const uint32_t stats_begin = crypto_stats_begin();
 	// NOTE: params->prk_size and params->puk_size are in bytes.
 	status = prepare_key(params->prk, params->prk_size, key_len, PSA_KEY_USAGE_DERIVE,
 			     PSA_ALG_ECDH, PSA_KEY_TYPE_ECC_KEY_PAIR(type), &priv_key_handle);
@@ -850,20 +1806,12 @@ sid_error_t sid_pal_crypto_ecc_ecdh(sid_pal_ecdh_params_t *params)
 					       &out_len);
 		LOG_DBG("ecdh key agreement %s", (PSA_SUCCESS == status) ? "success." : "failed!");
 
-#ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
-		if (!SID_CRYPTO_KEYS_ID_IS_SIDEWALK_KEY(priv_key_handle)) {
-			if (PSA_SUCCESS != psa_destroy_key(priv_key_handle)) {
-				LOG_WRN("Destroy key failed!");
-			}
-		}
-#else
-		if (PSA_SUCCESS != psa_destroy_key(priv_key_handle)) {
-			LOG_WRN("Destroy key failed!");
-		}
-#endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
+		release_key(priv_key_handle);
 	}
 
-	return get_error(status, __func__);
+	erc = get_error(status, __func__);
+	crypto_stats_end(ECC_STATS_ALGO(params->algo), 1, 0, stats_begin, erc);
+	return erc;
 }
 
 sid_error_t sid_pal_crypto_ecc_key_gen(sid_pal_ecc_key_gen_params_t *params)
@@ -875,6 +1823,7 @@ sid_error_t sid_pal_crypto_ecc_key_gen(sid_pal_ecc_key_gen_params_t *params)
 	psa_key_handle_t keys_handle;
 	size_t key_len;
 	uint8_t pub_key_offset = 0;
+	sid_error_t erc;
 
 	if (!is_initialized) {
 		return SID_ERROR_UNINITIALIZED;
@@ -919,6 +1868,7 @@ sid_error_t sid_pal_crypto_ecc_key_gen(sid_pal_ecc_key_gen_params_t *params)
 	psa_set_key_type(&key_attributes, type);
 	psa_set_key_bits(&key_attributes, key_len);
 
+	const uint32_t stats_begin = crypto_stats_begin();
 	status = psa_generate_key(&key_attributes, &keys_handle);
 	if (PSA_SUCCESS == status) {
 		size_t key_len;
@@ -952,5 +1902,7 @@ sid_error_t sid_pal_crypto_ecc_key_gen(sid_pal_ecc_key_gen_params_t *params)
 	}
 	psa_reset_key_attributes(&key_attributes);
 
-	return get_error(status, __func__);
+	erc = get_error(status, __func__);
+	crypto_stats_end(ECC_STATS_ALGO(params->algo), 1, 0, stats_begin, erc);
+	return erc;
 }
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_crypto_async.c
+ *  @brief Sidewalk asynchronous ECC operations on the crypto worker thread.
+ */
+
+#include <sid_crypto_async.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(sid_crypto_async, CONFIG_SIDEWALK_CRYPTO_LOG_LEVEL);
+
+enum crypto_async_op {
+	CRYPTO_ASYNC_ECC_DSA,
+	CRYPTO_ASYNC_ECC_ECDH,
+	CRYPTO_ASYNC_ECC_KEY_GEN,
+};
+
+struct crypto_async_req {
+	enum crypto_async_op op;
+	void *params;
+	sid_pal_crypto_async_cb_t callback;
+	void *ctx;
+};
+
+K_MSGQ_DEFINE(crypto_async_msgq, sizeof(struct crypto_async_req),
+	      CONFIG_SIDEWALK_CRYPTO_ASYNC_QUEUE_SIZE, 4);
+
+static sid_error_t crypto_async_submit(enum crypto_async_op op, void *params,
+				       sid_pal_crypto_async_cb_t callback, void *ctx)
+{
+	struct crypto_async_req req = {
+		.op = op,
+		.params = params,
+		.callback = callback,
+		.ctx = ctx,
+	};
+
+	if (!params || !callback) {
+		return SID_ERROR_NULL_POINTER;
+	}
+
+	if (k_msgq_put(&crypto_async_msgq, &req, K_NO_WAIT)) {
+		LOG_WRN("Crypto queue full, op %d rejected", op);
+		return SID_ERROR_BUSY;
+	}
+
+	return SID_ERROR_NONE;
+}
+
+sid_error_t sid_pal_crypto_ecc_dsa_async(sid_pal_dsa_params_t *params,
+					 sid_pal_crypto_async_cb_t callback, void *ctx)
+{
+	return crypto_async_submit(CRYPTO_ASYNC_ECC_DSA, params, callback, ctx);
+}
+
+sid_error_t sid_pal_crypto_ecc_ecdh_async(sid_pal_ecdh_params_t *params,
+					  sid_pal_crypto_async_cb_t callback, void *ctx)
+{
+	return crypto_async_submit(CRYPTO_ASYNC_ECC_ECDH, params, callback, ctx);
+}
+
+sid_error_t sid_pal_crypto_ecc_key_gen_async(sid_pal_ecc_key_gen_params_t *params,
+					     sid_pal_crypto_async_cb_t callback, void *ctx)
+{
+	return crypto_async_submit(CRYPTO_ASYNC_ECC_KEY_GEN, params, callback, ctx);
+}
+
+static sid_error_t crypto_async_execute(struct crypto_async_req *req)
+{
+	switch (req->op) {
+	case CRYPTO_ASYNC_ECC_DSA:
+		return sid_pal_crypto_ecc_dsa(req->params);
+	case CRYPTO_ASYNC_ECC_ECDH:
+		return sid_pal_crypto_ecc_ecdh(req->params);
+	case CRYPTO_ASYNC_ECC_KEY_GEN:
+		return sid_pal_crypto_ecc_key_gen(req->params);
+	default:
+		return SID_ERROR_NOSUPPORT;
+	}
+}
+
+static void crypto_async_task(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	struct crypto_async_req req;
+
+	while (1) {
+		k_msgq_get(&crypto_async_msgq, &req, K_FOREVER);
+		req.callback(crypto_async_execute(&req), req.ctx);
+	}
+}
+
+K_THREAD_DEFINE(crypto_async_thread, CONFIG_SIDEWALK_CRYPTO_ASYNC_STACK_SIZE, crypto_async_task,
+		NULL, NULL, NULL, K_PRIO_PREEMPT(CONFIG_SIDEWALK_CRYPTO_ASYNC_PRIORITY), 0, 0);
@@ -8,12 +8,111 @@
 #include <sid_pal_crypto_ifc.h>
 #include <sid_crypto_keys.h>
 #include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <json_printer/sidTypes2str.h>
 
 LOG_MODULE_REGISTER(sid_crypto_key, CONFIG_SIDEWALK_CRYPTO_LOG_LEVEL);
 #define ESUCCESS (0)
 #define MAX_PUBLIC_KEY_LENGTH (65)
+#define KEYS_NUM (SID_CRYPTO_KEY_ID_LAST - PSA_KEY_ID_USER_MIN)
+#define KEY_INDEX(_id) ((_id) - PSA_KEY_ID_USER_MIN)
+
+struct key_residency {
+	bool resident;
+	uint32_t last_use;
+};
+
+static K_MUTEX_DEFINE(keys_mutex);
+static struct key_residency keys[KEYS_NUM];
+static uint32_t keys_clock;
+static struct sid_crypto_keys_stats keys_stats;
+
+/* Has to be called with the keys mutex held. */
+static int key_purge(psa_key_id_t id)
+{
+	psa_status_t status = psa_purge_key(id);
+
+	keys[KEY_INDEX(id)].resident = false;
+	if (status != PSA_SUCCESS) {
+		LOG_ERR("psa_purge_key failed! (err %d id %d)", status, id);
+		return -EFAULT;
+	}
+	keys_stats.purges++;
+
+	return ESUCCESS;
+}
+
+#ifdef CONFIG_SIDEWALK_CRYPTO_KEYS_RESIDENT_LRU
+/* Has to be called with the keys mutex held. */
+static void keys_lru_trim(void)
+{
+	size_t resident = 0;
+	size_t victim = KEYS_NUM;
+
+	for (size_t i = 0; i < KEYS_NUM; i++) {
+		if (!keys[i].resident) {
+			continue;
+		}
+		resident++;
+		if (victim == KEYS_NUM || keys[i].last_use < keys[victim].last_use) {
+			victim = i;
+		}
+	}
+
+	if (resident > CONFIG_SIDEWALK_CRYPTO_KEYS_RESIDENT_MAX) {
+		(void)key_purge(PSA_KEY_ID_USER_MIN + victim);
+	}
+}
+#endif /* CONFIG_SIDEWALK_CRYPTO_KEYS_RESIDENT_LRU */
+
+/*
+ * Apply the residency policy to a key which is loaded in PSA,
+ * after the key is created or used.
+ */
+static int keys_policy_apply(psa_key_id_t id, bool used)
+{
+	int err = ESUCCESS;
+
+	k_mutex_lock(&keys_mutex, K_FOREVER);
+	keys[KEY_INDEX(id)].resident = true;
+	keys[KEY_INDEX(id)].last_use = ++keys_clock;
+#if defined(CONFIG_SIDEWALK_CRYPTO_KEYS_PURGE_IMMEDIATELY)
+	/* A used key stays loaded until PSA evicts it. */
+	if (!used) {
+		err = key_purge(id);
+	}
+#elif defined(CONFIG_SIDEWALK_CRYPTO_KEYS_PURGE_AFTER_USE)
+	ARG_UNUSED(used);
+	err = key_purge(id);
+#elif defined(CONFIG_SIDEWALK_CRYPTO_KEYS_RESIDENT_LRU)
+	keys_lru_trim();
+#endif /* CONFIG_SIDEWALK_CRYPTO_KEYS_PURGE_IMMEDIATELY */
+	k_mutex_unlock(&keys_mutex);
+
+	return err;
+}
+
+#ifdef CONFIG_SIDEWALK_CRYPTO_KEYS_RESIDENT_ALWAYS
+/* Load all stored Sidewalk keys, so the first use does not read the storage. */
+static void keys_preload(void)
+{
+	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+
+	for (psa_key_id_t id = PSA_KEY_ID_USER_MIN; id < SID_CRYPTO_KEY_ID_LAST; id++) {
+		if (keys[KEY_INDEX(id)].resident) {
+			continue;
+		}
+		/* Reading the attributes loads the key from the storage. */
+		if (PSA_SUCCESS == psa_get_key_attributes(id, &attributes)) {
+			keys_stats.loads++;
+			(void)keys_policy_apply(id, false);
+		}
+		psa_reset_key_attributes(&attributes);
+	}
+}
+#endif /* CONFIG_SIDEWALK_CRYPTO_KEYS_RESIDENT_ALWAYS */
 
 int sid_crypto_keys_init(void)
 {
@@ -27,7 +126,9 @@ int sid_crypto_keys_init(void)
 		}
 		initialized = true;
 	}
-	/* Nothing to do, left for stable api for future features */
+#ifdef CONFIG_SIDEWALK_CRYPTO_KEYS_RESIDENT_ALWAYS
+	keys_preload();
+#endif /* CONFIG_SIDEWALK_CRYPTO_KEYS_RESIDENT_ALWAYS */
 	return ESUCCESS;
 }
 
@@ -102,16 +203,10 @@ int sid_crypto_keys_new_import(psa_key_id_t id, uint8_t *data, size_t size)
 		return -EACCES;
 	}
 
-	/* Clear key data */
-	status = psa_purge_key(id);
-	if (status != PSA_SUCCESS) {
-		LOG_ERR("psa_purge_key failed! (err %d id %d)", status, id);
-		return -EFAULT;
-	}
-
 	psa_reset_key_attributes(&attributes);
 
-	return ESUCCESS;
+	/* Clear key data, unless the residency policy keeps the key loaded */
+	return keys_policy_apply(id, false);
 }
 
 int sid_crypto_keys_new_generate(psa_key_id_t id, uint8_t *puk, size_t puk_size)
@@ -159,16 +254,10 @@ int sid_crypto_keys_new_generate(psa_key_id_t id, uint8_t *puk, size_t puk_size)
 		return -EBADF;
 	}
 
-	/* Clear key data */
-	status = psa_purge_key(id);
-	if (status != PSA_SUCCESS) {
-		LOG_ERR("psa_purge_key failed! (err %d id %d)", status, id);
-		return -EFAULT;
-	}
-
 	psa_reset_key_attributes(&attributes);
 
-	return ESUCCESS;
+	/* Clear key data, unless the residency policy keeps the key loaded */
+	return keys_policy_apply(id, false);
 }
 
 int sid_crypto_keys_buffer_set(psa_key_id_t id, uint8_t *data, size_t size)
@@ -232,6 +321,10 @@ int sid_crypto_keys_delete(psa_key_id_t id)
 		return -ENOENT;
 	}
 
+	k_mutex_lock(&keys_mutex, K_FOREVER);
+	keys[KEY_INDEX(id)].resident = false;
+	k_mutex_unlock(&keys_mutex);
+
 	psa_status_t status = psa_destroy_key(id);
 	if (status == PSA_ERROR_INVALID_HANDLE) {
 		LOG_WRN("psa_destroy_key invalid id %d", id);
@@ -244,8 +337,54 @@ int sid_crypto_keys_delete(psa_key_id_t id)
 	return ESUCCESS;
 }
 
+void sid_crypto_keys_used(psa_key_id_t id)
+{
+	if (!SID_CRYPTO_KEYS_ID_IS_SIDEWALK_KEY(id)) {
+		return;
+	}
+
+	k_mutex_lock(&keys_mutex, K_FOREVER);
+	if (keys[KEY_INDEX(id)].resident) {
+		keys_stats.hits++;
+	} else {
+		/* PSA loaded the key from the storage for this use. */
+		keys_stats.loads++;
+	}
+	k_mutex_unlock(&keys_mutex);
+
+	(void)keys_policy_apply(id, true);
+}
+
+void sid_crypto_keys_stats_get(struct sid_crypto_keys_stats *stats)
+{
+	if (!stats) {
+		return;
+	}
+
+	k_mutex_lock(&keys_mutex, K_FOREVER);
+	*stats = keys_stats;
+	k_mutex_unlock(&keys_mutex);
+}
+
+void sid_crypto_keys_stats_reset(void)
+{
+	k_mutex_lock(&keys_mutex, K_FOREVER);
+	memset(&keys_stats, 0, sizeof(keys_stats));
+	k_mutex_unlock(&keys_mutex);
+}
+
 int sid_crypto_keys_deinit(void)
 {
-	/* Nothing to do, left for stable api for future features */
-	return ESUCCESS;
+	int err = ESUCCESS;
+
+	/* Remove all key data from RAM, regardless of the residency policy */
+	k_mutex_lock(&keys_mutex, K_FOREVER);
+	for (psa_key_id_t id = PSA_KEY_ID_USER_MIN; id < SID_CRYPTO_KEY_ID_LAST; id++) {
+		if (keys[KEY_INDEX(id)].resident && key_purge(id)) {
+			err = -EFAULT;
+		}
+	}
+	k_mutex_unlock(&keys_mutex);
+
+	return err;
 }
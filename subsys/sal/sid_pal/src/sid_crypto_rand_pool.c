@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_crypto_rand_pool.c
+ *  @brief Pool of random bytes refilled by a low priority thread.
+ */
+
+#include <sid_crypto_rand_pool.h>
+#include <sid_critical_region_lock.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <string.h>
+
+LOG_MODULE_REGISTER(sid_crypto_rand_pool, CONFIG_SIDEWALK_CRYPTO_LOG_LEVEL);
+
+#define POOL_SIZE CONFIG_SIDEWALK_CRYPTO_RAND_POOL_SIZE
+#define POOL_REQUEST_MAX CONFIG_SIDEWALK_CRYPTO_RAND_POOL_REQUEST_MAX
+/* Bytes generated at once by the refill thread. */
+#define POOL_REFILL_CHUNK 32
+
+BUILD_ASSERT(POOL_REQUEST_MAX <= POOL_SIZE, "A request has to fit in the pool");
+
+SID_REGION_LOCK_DEFINE(pool_lock);
+static K_SEM_DEFINE(pool_refill_sem, 0, 1);
+/* Serializes the refill and the direct path on the random generator. */
+static K_MUTEX_DEFINE(pool_generator_mutex);
+
+static uint8_t pool[POOL_SIZE];
+/* Index of the first unused byte and the number of unused bytes. */
+static size_t pool_head;
+static size_t pool_count;
+/* Changed by every flush, so a refill generated before the flush is discarded. */
+static uint32_t pool_epoch;
+static bool pool_enabled;
+static struct sid_crypto_rand_pool_stats pool_stats;
+
+/* Has to be called with the lock held. */
+static void pool_take(uint8_t *out, size_t size)
+{
+	size_t first = MIN(size, POOL_SIZE - pool_head);
+
+	memcpy(out, &pool[pool_head], first);
+	memset(&pool[pool_head], 0, first);
+	memcpy(&out[first], pool, size - first);
+	memset(pool, 0, size - first);
+
+	pool_head = (pool_head + size) % POOL_SIZE;
+	pool_count -= size;
+}
+
+/* Has to be called with the lock held. */
+static size_t pool_put(const uint8_t *in, size_t size)
+{
+	size_t tail = (pool_head + pool_count) % POOL_SIZE;
+	size_t first;
+
+	size = MIN(size, POOL_SIZE - pool_count);
+	first = MIN(size, POOL_SIZE - tail);
+	memcpy(&pool[tail], in, first);
+	memcpy(pool, &in[first], size - first);
+	pool_count += size;
+
+	return size;
+}
+
+/* Has to be called with the lock held. */
+static void pool_clear(void)
+{
+	memset(pool, 0, sizeof(pool));
+	pool_head = 0;
+	pool_count = 0;
+	pool_epoch++;
+}
+
+static psa_status_t generate_random(uint8_t *out, size_t size)
+{
+	psa_status_t status;
+
+	k_mutex_lock(&pool_generator_mutex, K_FOREVER);
+	status = psa_generate_random(out, size);
+	k_mutex_unlock(&pool_generator_mutex);
+
+	return status;
+}
+
+static void stats_latency_add(uint32_t *max_ns, uint64_t *sum_ns, uint32_t start_cycles)
+{
+	uint32_t ns = k_cyc_to_ns_floor32(k_cycle_get_32() - start_cycles);
+
+	*max_ns = MAX(*max_ns, ns);
+	*sum_ns += ns;
+}
+
+psa_status_t sid_crypto_rand_pool_generate(uint8_t *rand, size_t size)
+{
+	const uint32_t start_cycles = k_cycle_get_32();
+	psa_status_t status;
+	bool hit = false;
+
+	if (size <= POOL_REQUEST_MAX) {
+		SID_REGION_LOCKED(&pool_lock)
+		{
+			if (pool_enabled && pool_count >= size) {
+				pool_take(rand, size);
+				pool_stats.hits++;
+				stats_latency_add(&pool_stats.hit_latency_max_ns,
+						  &pool_stats.hit_latency_sum_ns, start_cycles);
+				hit = true;
+			}
+		}
+	}
+
+	if (hit) {
+		k_sem_give(&pool_refill_sem);
+		return PSA_SUCCESS;
+	}
+
+	status = generate_random(rand, size);
+
+	SID_REGION_LOCKED(&pool_lock)
+	{
+		pool_stats.misses++;
+		stats_latency_add(&pool_stats.miss_latency_max_ns, &pool_stats.miss_latency_sum_ns,
+				  start_cycles);
+	}
+	k_sem_give(&pool_refill_sem);
+
+	return status;
+}
+
+void sid_crypto_rand_pool_init(void)
+{
+	SID_REGION_LOCKED(&pool_lock)
+	{
+		pool_enabled = true;
+	}
+	k_sem_give(&pool_refill_sem);
+}
+
+void sid_crypto_rand_pool_deinit(void)
+{
+	SID_REGION_LOCKED(&pool_lock)
+	{
+		pool_enabled = false;
+		pool_clear();
+	}
+}
+
+void sid_crypto_rand_pool_flush(void)
+{
+	SID_REGION_LOCKED(&pool_lock)
+	{
+		pool_clear();
+	}
+	k_sem_give(&pool_refill_sem);
+}
+
+void sid_crypto_rand_pool_stats_get(struct sid_crypto_rand_pool_stats *stats)
+{
+	if (!stats) {
+		return;
+	}
+
+	SID_REGION_LOCKED(&pool_lock)
+	{
+		*stats = pool_stats;
+	}
+}
+
+void sid_crypto_rand_pool_stats_reset(void)
+{
+	SID_REGION_LOCKED(&pool_lock)
+	{
+		memset(&pool_stats, 0, sizeof(pool_stats));
+	}
+}
+
+/* Returns true when the pool is full or disabled. */
+static bool pool_refill_chunk(void)
+{
+	uint8_t chunk[POOL_REFILL_CHUNK];
+	uint32_t epoch = 0;
+	bool done = false;
+
+	SID_REGION_LOCKED(&pool_lock)
+	{
+		done = !pool_enabled || pool_count == POOL_SIZE;
+		epoch = pool_epoch;
+	}
+	if (done) {
+		return true;
+	}
+
+	/* The random generator is called without the lock, it can take a while. */
+	psa_status_t status = generate_random(chunk, sizeof(chunk));
+	if (status != PSA_SUCCESS) {
+		LOG_ERR("Refill failed! (sts: %d)", status);
+		return true;
+	}
+
+	SID_REGION_LOCKED(&pool_lock)
+	{
+		if (pool_enabled && epoch == pool_epoch) {
+			pool_stats.refill_bytes += pool_put(chunk, sizeof(chunk));
+		} else {
+			pool_stats.discarded_bytes += sizeof(chunk);
+		}
+	}
+	memset(chunk, 0, sizeof(chunk));
+
+	return false;
+}
+
+static void pool_refill_task(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	while (1) {
+		k_sem_take(&pool_refill_sem, K_FOREVER);
+		while (!pool_refill_chunk()) {
+			/* Let the threads with the same priority run between the chunks. */
+			k_yield();
+		}
+	}
+}
+
+K_THREAD_DEFINE(rand_pool_thread, CONFIG_SIDEWALK_CRYPTO_RAND_POOL_STACK_SIZE, pool_refill_task,
+		NULL, NULL, NULL, K_PRIO_PREEMPT(CONFIG_SIDEWALK_CRYPTO_RAND_POOL_PRIORITY), 0, 0);
@@ -25,6 +25,9 @@
 #include <tlv/tlv.h>
 #include <tlv/tlv_storage_impl.h>
 #include <sid_mfg_hex_parsers.h>
+#ifdef CONFIG_SIDEWALK_STORAGE_STATS
+#include <sid_storage_stats.h>
+#endif /* CONFIG_SIDEWALK_STORAGE_STATS */
 
 LOG_MODULE_REGISTER(sid_mfg, CONFIG_SIDEWALK_LOG_LEVEL);
 
@@ -55,6 +58,29 @@ static const struct device *flash_dev;
 static uint32_t sid_mfg_version = INVALID_VERSION;
 tlv_ctx tlv_flash;
 
+#ifdef CONFIG_SIDEWALK_STORAGE_STATS
+static int mfg_flash_write(void *ctx, uint32_t offset, uint8_t *data, uint32_t data_size)
+{
+	int err = tlv_storage_flash_write(ctx, offset, data, data_size);
+	if (!err) {
+		sid_storage_stats_source_write(SID_STORAGE_STATS_MFG, data_size);
+	}
+	return err;
+}
+
+static int mfg_flash_erase(void *ctx, uint32_t offset, uint32_t size)
+{
+	int err = tlv_storage_flash_erase(ctx, offset, size);
+	if (!err) {
+		sid_storage_stats_source_erase(SID_STORAGE_STATS_MFG, size);
+	}
+	return err;
+}
+#else
+#define mfg_flash_write tlv_storage_flash_write
+#define mfg_flash_erase tlv_storage_flash_erase
+#endif /* CONFIG_SIDEWALK_STORAGE_STATS */
+
 void sid_pal_mfg_store_init(sid_pal_mfg_store_region_t mfg_store_region)
 {
 	struct mfg_header header = { 0 };
@@ -67,8 +93,8 @@ void sid_pal_mfg_store_init(sid_pal_mfg_store_region_t mfg_store_region)
 		return;
 	}
 
-	tlv_flash = (tlv_ctx){ .storage_impl = { .write = tlv_storage_flash_write,
-						 .erase = tlv_storage_flash_erase,
+	tlv_flash = (tlv_ctx){ .storage_impl = { .write = mfg_flash_write,
+						 .erase = mfg_flash_erase,
 						 .read = tlv_storage_flash_read,
 						 .ctx = (void *)flash_dev },
 			       .start_offset = mfg_store_region.addr_start,
@@ -16,12 +16,26 @@
 #ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
 #include <sid_crypto_keys.h>
 
-#define STORAGE_KV_INTERNAL_PROTOCOL_GROUP_ID 0
 #define STORAGE_KV_WAN_MASTER_KEY (28)
 #define STORAGE_KV_APP_MASTER_KEY (30)
 #define STORAGE_KV_D2D_MASTER_KEY (48)
 #define STORAGE_MASTER_KEY_SIZE (16)
 #endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
+#ifdef CONFIG_SIDEWALK_STORAGE_CACHE
+#include <sid_storage_cache.h>
+#endif /* CONFIG_SIDEWALK_STORAGE_CACHE */
+#ifdef CONFIG_SIDEWALK_STORAGE_INDEX
+#include <sid_storage_index.h>
+#endif /* CONFIG_SIDEWALK_STORAGE_INDEX */
+#ifdef CONFIG_SIDEWALK_STORAGE_BACKEND_ID
+#include <sid_storage_id.h>
+#endif /* CONFIG_SIDEWALK_STORAGE_BACKEND_ID */
+#ifdef CONFIG_SIDEWALK_STORAGE_TXN
+#include <sid_storage_txn.h>
+#endif /* CONFIG_SIDEWALK_STORAGE_TXN */
+#ifdef CONFIG_SIDEWALK_STORAGE_STATS
+#include <sid_storage_stats.h>
+#endif /* CONFIG_SIDEWALK_STORAGE_STATS */
 
 #include <zephyr/logging/log.h>
 #include <settings_utils.h>
@@ -29,7 +43,9 @@
 LOG_MODULE_REGISTER(sid_storage, CONFIG_SIDEWALK_LOG_LEVEL);
 
 #define STORAGE_SERIAL_SIZE (32)
+#define STORAGE_KV_INTERNAL_PROTOCOL_GROUP_ID 0
 
+#ifndef CONFIG_SIDEWALK_STORAGE_BACKEND_ID
 static void settings_serialize_group(char *serial, size_t serial_size, uint16_t group)
 {
 	snprintf(serial, serial_size, "sidewalk/storage/%04x", group);
@@ -40,6 +56,200 @@ static void settings_serialize_group_key(char *serial, size_t serial_size, uint1
 {
 	snprintf(serial, serial_size, "sidewalk/storage/%04x/%04x", group, key);
 }
+#endif /* CONFIG_SIDEWALK_STORAGE_BACKEND_ID */
+
+static int storage_record_write(uint16_t group, uint16_t key, const void *data, uint32_t len)
+{
+#ifdef CONFIG_SIDEWALK_STORAGE_BACKEND_ID
+	int err = sid_storage_id_write(group, key, data, len);
+	if (err != 0) {
+		LOG_ERR("Failed to save record %04x/%04x. Returned errno %d", group, key, err);
+		return err;
+	}
+#ifdef CONFIG_SIDEWALK_STORAGE_STATS
+	sid_storage_stats_record_write(group, key, len);
+#endif /* CONFIG_SIDEWALK_STORAGE_STATS */
+	return err;
+#else
+	char serial[STORAGE_SERIAL_SIZE] = { 0 };
+	settings_serialize_group_key(serial, sizeof(serial), group, key);
+
+	int rc = settings_save_one(serial, data, len);
+	if (rc != 0) {
+		LOG_ERR("Failed to save record (%s). Returned errno %d", serial, rc);
+		return rc;
+	}
+#ifdef CONFIG_SIDEWALK_STORAGE_INDEX
+	sid_storage_index_update(group, key, len);
+#endif /* CONFIG_SIDEWALK_STORAGE_INDEX */
+#ifdef CONFIG_SIDEWALK_STORAGE_STATS
+	sid_storage_stats_record_write(group, key, len);
+#endif /* CONFIG_SIDEWALK_STORAGE_STATS */
+	return rc;
+#endif /* CONFIG_SIDEWALK_STORAGE_BACKEND_ID */
+}
+
+static int storage_commit(void)
+{
+#ifdef CONFIG_SIDEWALK_STORAGE_STATS
+	sid_storage_stats_commit();
+#endif /* CONFIG_SIDEWALK_STORAGE_STATS */
+#ifdef CONFIG_SIDEWALK_STORAGE_BACKEND_ID
+	/* Every write of the numeric ID backend is final. */
+	return 0;
+#else
+	return settings_commit();
+#endif /* CONFIG_SIDEWALK_STORAGE_BACKEND_ID */
+}
+
+/* Returns the number of bytes read or a negative errno. */
+static int storage_record_read(uint16_t group, uint16_t key, void *data, uint32_t len)
+{
+#ifdef CONFIG_SIDEWALK_STORAGE_BACKEND_ID
+	uint32_t stored_len = 0;
+	int err = sid_storage_id_read(group, key, data, len, &stored_len);
+	if (err) {
+		return err;
+	}
+	return MIN(stored_len, len);
+#else
+	char serial[STORAGE_SERIAL_SIZE] = { 0 };
+	settings_serialize_group_key(serial, sizeof(serial), group, key);
+	return settings_utils_load_immediate_value(serial, data, len);
+#endif /* CONFIG_SIDEWALK_STORAGE_BACKEND_ID */
+}
+
+static int storage_record_erase(uint16_t group, uint16_t key)
+{
+#ifdef CONFIG_SIDEWALK_STORAGE_CACHE
+	sid_storage_cache_invalidate(group, key);
+#endif /* CONFIG_SIDEWALK_STORAGE_CACHE */
+
+#ifdef CONFIG_SIDEWALK_STORAGE_BACKEND_ID
+	int err = sid_storage_id_delete(group, key);
+	if (err != 0) {
+		LOG_ERR("Failed to delete record %04x/%04x. Returned errno %d", group, key, err);
+		return err;
+	}
+#ifdef CONFIG_SIDEWALK_STORAGE_STATS
+	sid_storage_stats_record_delete(group);
+#endif /* CONFIG_SIDEWALK_STORAGE_STATS */
+	return err;
+#else
+	char serial[STORAGE_SERIAL_SIZE] = { 0 };
+	settings_serialize_group_key(serial, sizeof(serial), group, key);
+	int rc = settings_delete(serial);
+	if (rc != 0) {
+		LOG_ERR("Failed to delete record (%s). Returned errno %d", serial, rc);
+		return rc;
+	}
+#ifdef CONFIG_SIDEWALK_STORAGE_INDEX
+	sid_storage_index_remove(group, key);
+#endif /* CONFIG_SIDEWALK_STORAGE_INDEX */
+#ifdef CONFIG_SIDEWALK_STORAGE_STATS
+	sid_storage_stats_record_delete(group);
+#endif /* CONFIG_SIDEWALK_STORAGE_STATS */
+	return rc;
+#endif /* CONFIG_SIDEWALK_STORAGE_BACKEND_ID */
+}
+
+#ifndef CONFIG_SIDEWALK_STORAGE_BACKEND_ID
+int delete_subtree_cb(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg,
+		      void *param)
+{
+	char *subtree = (char *)param;
+	char serial[STORAGE_SERIAL_SIZE] = { 0 };
+	snprintf(serial, sizeof(serial), "%s/%s", subtree, key);
+	int rc = settings_delete(serial);
+	if (rc != 0) {
+		LOG_ERR("Failed to delete record. Returned errno %d", rc);
+		return rc;
+	}
+	return 0;
+}
+#endif /* CONFIG_SIDEWALK_STORAGE_BACKEND_ID */
+
+static int storage_group_erase(uint16_t group)
+{
+#ifdef CONFIG_SIDEWALK_STORAGE_CACHE
+	sid_storage_cache_invalidate_group(group);
+#endif /* CONFIG_SIDEWALK_STORAGE_CACHE */
+
+#ifdef CONFIG_SIDEWALK_STORAGE_BACKEND_ID
+	int rc = sid_storage_id_group_delete(group);
+#else
+	char serial[STORAGE_SERIAL_SIZE] = { 0 };
+	settings_serialize_group(serial, sizeof(serial), group);
+	int rc = settings_load_subtree_direct(serial, delete_subtree_cb, (void *)serial);
+#ifdef CONFIG_SIDEWALK_STORAGE_INDEX
+	if (rc == 0) {
+		sid_storage_index_remove_group(group);
+	} else {
+		/* Some records of the group may be deleted. */
+		(void)sid_storage_index_build();
+	}
+#endif /* CONFIG_SIDEWALK_STORAGE_INDEX */
+#endif /* CONFIG_SIDEWALK_STORAGE_BACKEND_ID */
+	if (rc != 0) {
+		LOG_ERR("Failed to delete group. Returned errno %d", rc);
+		return rc;
+	}
+#ifdef CONFIG_SIDEWALK_STORAGE_STATS
+	sid_storage_stats_record_delete(group);
+#endif /* CONFIG_SIDEWALK_STORAGE_STATS */
+	return rc;
+}
+
+#ifdef CONFIG_SIDEWALK_STORAGE_CACHE
+static const struct sid_storage_cache_backend storage_cache_backend = {
+	.write = storage_record_write,
+	.commit = storage_commit,
+};
+#endif /* CONFIG_SIDEWALK_STORAGE_CACHE */
+
+#ifdef CONFIG_SIDEWALK_STORAGE_TXN
+static int storage_txn_write(uint16_t group, uint16_t key, const void *data, uint32_t len)
+{
+#ifdef CONFIG_SIDEWALK_STORAGE_CACHE
+	/* An older cached value must not be flushed over the committed one. */
+	sid_storage_cache_invalidate(group, key);
+#endif /* CONFIG_SIDEWALK_STORAGE_CACHE */
+	return storage_record_write(group, key, data, len);
+}
+
+#ifndef CONFIG_SIDEWALK_STORAGE_BACKEND_ID
+static int count_subtree_cb(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg,
+			    void *param)
+{
+	int *records = param;
+
+	(*records)++;
+	return 0;
+}
+#endif /* CONFIG_SIDEWALK_STORAGE_BACKEND_ID */
+
+static int storage_group_records(uint16_t group)
+{
+#ifdef CONFIG_SIDEWALK_STORAGE_BACKEND_ID
+	return sid_storage_id_group_records(group);
+#else
+	char serial[STORAGE_SERIAL_SIZE] = { 0 };
+	int records = 0;
+	settings_serialize_group(serial, sizeof(serial), group);
+	int rc = settings_load_subtree_direct(serial, count_subtree_cb, &records);
+	return rc ? rc : records;
+#endif /* CONFIG_SIDEWALK_STORAGE_BACKEND_ID */
+}
+
+static const struct sid_storage_txn_backend storage_txn_backend = {
+	.write = storage_txn_write,
+	.read = storage_record_read,
+	.erase = storage_record_erase,
+	.group_erase = storage_group_erase,
+	.group_records = storage_group_records,
+	.commit = storage_commit,
+};
+#endif /* CONFIG_SIDEWALK_STORAGE_TXN */
 
 #ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
 static psa_key_id_t storage2key_id(uint16_t group, uint16_t key)
@@ -60,12 +270,10 @@ static psa_key_id_t storage2key_id(uint16_t group, uint16_t key)
 static void storage_key_save_secure(uint16_t group, uint16_t key)
 {
 	int err = 0;
-	char serial[STORAGE_SERIAL_SIZE] = { 0 };
 	uint8_t data[STORAGE_MASTER_KEY_SIZE];
 	psa_key_id_t key_id = storage2key_id(group, key);
 
-	settings_serialize_group_key(serial, sizeof(serial), group, key);
-	err = settings_utils_load_immediate_value(serial, (void *)data, STORAGE_MASTER_KEY_SIZE);
+	err = storage_record_read(group, key, (void *)data, STORAGE_MASTER_KEY_SIZE);
 	if (err == -ENOENT) {
 		LOG_DBG("not found key %04x", key);
 		return;
@@ -81,7 +289,7 @@ static void storage_key_save_secure(uint16_t group, uint16_t key)
 		return;
 	}
 
-	err = settings_delete(serial);
+	err = storage_record_erase(group, key);
 	if (err) {
 		LOG_ERR("delete key %04x err %d", key, err);
 		return;
@@ -117,8 +325,31 @@ sid_error_t sid_pal_storage_kv_init()
 		return SID_ERROR_GENERIC;
 	}
 
+#ifdef CONFIG_SIDEWALK_STORAGE_BACKEND_ID
+	rc = sid_storage_id_init();
+	if (rc != 0) {
+		LOG_ERR("numeric ID storage init failed (err %d)", rc);
+		return SID_ERROR_GENERIC;
+	}
+#endif /* CONFIG_SIDEWALK_STORAGE_BACKEND_ID */
+
 	LOG_DBG("Initialized KV storage");
 
+#ifdef CONFIG_SIDEWALK_STORAGE_STATS
+	sid_storage_stats_init();
+#endif /* CONFIG_SIDEWALK_STORAGE_STATS */
+
+#ifdef CONFIG_SIDEWALK_STORAGE_CACHE
+	sid_storage_cache_init(&storage_cache_backend);
+#ifdef CONFIG_SIDEWALK_STORAGE_CACHE_CRITICAL_PROTOCOL
+	if (sid_storage_cache_critical_add(STORAGE_KV_INTERNAL_PROTOCOL_GROUP_ID,
+					   SID_STORAGE_CACHE_KEY_ANY) != SID_ERROR_NONE) {
+		LOG_ERR("Protocol records not marked critical");
+		return SID_ERROR_GENERIC;
+	}
+#endif /* CONFIG_SIDEWALK_STORAGE_CACHE_CRITICAL_PROTOCOL */
+#endif /* CONFIG_SIDEWALK_STORAGE_CACHE */
+
 #ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
 	int ret = sid_crypto_keys_init();
 	if (ret != 0) {
@@ -130,6 +361,20 @@ sid_error_t sid_pal_storage_kv_init()
 	storage_key_save_secure(STORAGE_KV_INTERNAL_PROTOCOL_GROUP_ID, STORAGE_KV_D2D_MASTER_KEY);
 #endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
 
+#ifdef CONFIG_SIDEWALK_STORAGE_INDEX
+	/* Built after the master keys were moved out of the settings. */
+	if (sid_storage_index_build() != SID_ERROR_NONE) {
+		LOG_WRN("Storage index not built, lookups use the settings backend");
+	}
+#endif /* CONFIG_SIDEWALK_STORAGE_INDEX */
+
+#ifdef CONFIG_SIDEWALK_STORAGE_TXN
+	/* A journal which is not applied stays stored, and is applied by the next init. */
+	if (sid_storage_txn_init(&storage_txn_backend) != SID_ERROR_NONE) {
+		LOG_ERR("Failed to apply the journal of an interrupted transaction");
+	}
+#endif /* CONFIG_SIDEWALK_STORAGE_TXN */
+
 	return SID_ERROR_NONE;
 }
 
@@ -151,9 +396,27 @@ sid_error_t sid_pal_storage_kv_record_get(uint16_t group, uint16_t key, void *p_
 	}
 #endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
 
-	char serial[STORAGE_SERIAL_SIZE] = { 0 };
-	settings_serialize_group_key(serial, sizeof(serial), group, key);
-	int rc = settings_utils_load_immediate_value(serial, p_data, len);
+#ifdef CONFIG_SIDEWALK_STORAGE_TXN
+	sid_error_t erc;
+	if (sid_storage_txn_get(group, key, p_data, len, NULL, &erc)) {
+		return erc;
+	}
+#endif /* CONFIG_SIDEWALK_STORAGE_TXN */
+
+#ifdef CONFIG_SIDEWALK_STORAGE_CACHE
+	if (sid_storage_cache_get(group, key, p_data, len, NULL)) {
+		return SID_ERROR_NONE;
+	}
+#endif /* CONFIG_SIDEWALK_STORAGE_CACHE */
+
+#ifdef CONFIG_SIDEWALK_STORAGE_INDEX
+	int err = sid_storage_index_read(group, key, p_data, len, NULL);
+	if (err != -EAGAIN) {
+		return err ? SID_ERROR_NOT_FOUND : SID_ERROR_NONE;
+	}
+#endif /* CONFIG_SIDEWALK_STORAGE_INDEX */
+
+	int rc = storage_record_read(group, key, p_data, len);
 	if (rc <= 0) {
 		return SID_ERROR_NOT_FOUND;
 	} else
@@ -165,6 +428,27 @@ sid_error_t sid_pal_storage_kv_record_get_len(uint16_t group, uint16_t key, uint
 	if (!p_len) {
 		return SID_ERROR_NULL_POINTER;
 	}
+#ifdef CONFIG_SIDEWALK_STORAGE_TXN
+	sid_error_t erc;
+	if (sid_storage_txn_get(group, key, NULL, 0, p_len, &erc)) {
+		return erc;
+	}
+#endif /* CONFIG_SIDEWALK_STORAGE_TXN */
+#ifdef CONFIG_SIDEWALK_STORAGE_CACHE
+	if (sid_storage_cache_get(group, key, NULL, 0, p_len)) {
+		return SID_ERROR_NONE;
+	}
+#endif /* CONFIG_SIDEWALK_STORAGE_CACHE */
+#ifdef CONFIG_SIDEWALK_STORAGE_INDEX
+	int err = sid_storage_index_read(group, key, NULL, 0, p_len);
+	if (err != -EAGAIN) {
+		return err ? SID_ERROR_NOT_FOUND : SID_ERROR_NONE;
+	}
+#endif /* CONFIG_SIDEWALK_STORAGE_INDEX */
+#ifdef CONFIG_SIDEWALK_STORAGE_BACKEND_ID
+	return sid_storage_id_read(group, key, NULL, 0, p_len) ? SID_ERROR_NOT_FOUND :
+								 SID_ERROR_NONE;
+#else
 	char serial[STORAGE_SERIAL_SIZE] = { 0 };
 	settings_serialize_group_key(serial, sizeof(serial), group, key);
 	int rc = settings_utils_get_value_size(serial, p_len);
@@ -172,6 +456,7 @@ sid_error_t sid_pal_storage_kv_record_get_len(uint16_t group, uint16_t key, uint
 		return SID_ERROR_NOT_FOUND;
 	else
 		return SID_ERROR_NONE;
+#endif /* CONFIG_SIDEWALK_STORAGE_BACKEND_ID */
 }
 
 sid_error_t sid_pal_storage_kv_record_set(uint16_t group, uint16_t key, void const *p_data,
@@ -197,16 +482,31 @@ sid_error_t sid_pal_storage_kv_record_set(uint16_t group, uint16_t key, void con
 	}
 #endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
 
-	char serial[STORAGE_SERIAL_SIZE] = { 0 };
-	settings_serialize_group_key(serial, sizeof(serial), group, key);
+#ifdef CONFIG_SIDEWALK_STORAGE_TXN
+	if (group == SID_STORAGE_TXN_JOURNAL_GROUP) {
+		return SID_ERROR_INVALID_ARGS;
+	}
+	sid_error_t txn_erc = sid_storage_txn_set(group, key, p_data, len);
+	if (txn_erc != SID_ERROR_NOSUPPORT) {
+		return txn_erc;
+	}
+#endif /* CONFIG_SIDEWALK_STORAGE_TXN */
+
+#ifdef CONFIG_SIDEWALK_STORAGE_CACHE
+	sid_error_t erc = sid_storage_cache_set(group, key, p_data, len);
+	if (erc != SID_ERROR_NOSUPPORT) {
+		return erc;
+	}
+	/* Written through, an older cached value must not be flushed over it. */
+	sid_storage_cache_invalidate(group, key);
+#endif /* CONFIG_SIDEWALK_STORAGE_CACHE */
 
-	int rc = settings_save_one(serial, (const void *)p_data, len);
+	int rc = storage_record_write(group, key, p_data, len);
 	if (rc != 0) {
-		LOG_ERR("Failed to save record (%s). Returned errno %d", serial, rc);
 		return SID_ERROR_STORAGE_WRITE_FAIL;
 	}
 
-	rc = settings_commit();
+	rc = storage_commit();
 	if (rc != 0) {
 		LOG_ERR("Failed to commit changes. Returned errno %d", rc);
 		return SID_ERROR_GENERIC;
@@ -223,44 +523,36 @@ sid_error_t sid_pal_storage_kv_record_delete(uint16_t group, uint16_t key)
 	}
 #endif /* CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE */
 
-	char serial[STORAGE_SERIAL_SIZE] = { 0 };
-	settings_serialize_group_key(serial, sizeof(serial), group, key);
-	int rc = settings_delete(serial);
-	if (rc == 0) {
-		return SID_ERROR_NONE;
+#ifdef CONFIG_SIDEWALK_STORAGE_TXN
+	sid_error_t erc = sid_storage_txn_delete(group, key);
+	if (erc != SID_ERROR_NOSUPPORT) {
+		return erc;
 	}
-	LOG_ERR("Failed to delete record (%s). Returned errno %d", serial, rc);
-	return SID_ERROR_GENERIC;
-}
+#endif /* CONFIG_SIDEWALK_STORAGE_TXN */
 
-int delete_subtree_cb(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg,
-		      void *param)
-{
-	char *subtree = (char *)param;
-	char serial[STORAGE_SERIAL_SIZE] = { 0 };
-	snprintf(serial, sizeof(serial), "%s/%s", subtree, key);
-	int rc = settings_delete(serial);
-	if (rc != 0) {
-		LOG_ERR("Failed to delete record. Returned errno %d", rc);
-		return rc;
-	}
-	return 0;
+	int rc = storage_record_erase(group, key);
+	return rc ? SID_ERROR_GENERIC : SID_ERROR_NONE;
 }
 
 sid_error_t sid_pal_storage_kv_group_delete(uint16_t group)
 {
-	char serial[STORAGE_SERIAL_SIZE] = { 0 };
-	settings_serialize_group(serial, sizeof(serial), group);
-	int rc = settings_load_subtree_direct(serial, delete_subtree_cb, (void *)serial);
+#ifdef CONFIG_SIDEWALK_STORAGE_TXN
+	/* Journaled, a reset does not leave a part of the group deleted. */
+	sid_error_t erc = sid_storage_txn_group_delete(group);
+	if (erc != SID_ERROR_NONE) {
+		return erc;
+	}
+#else
+	int rc = storage_group_erase(group);
 	if (rc != 0) {
-		LOG_ERR("Failed to delete group. Returned errno %d", rc);
 		return SID_ERROR_STORAGE_ERASE_FAIL;
 	}
-	rc = settings_commit();
+	rc = storage_commit();
 	if (rc != 0) {
 		LOG_ERR("Failed to commit changes. Returned errno %d", rc);
 		return SID_ERROR_GENERIC;
 	}
+#endif /* CONFIG_SIDEWALK_STORAGE_TXN */
 
 #ifdef CONFIG_SIDEWALK_CRYPTO_PSA_KEY_STORAGE
 	bool success = true;
@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_storage_cache.c
+ *  @brief Write-back RAM cache of the Sidewalk key-value storage.
+ */
+
+#include <sid_storage_cache.h>
+#include <sid_pal_storage_kv_ifc.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <string.h>
+
+LOG_MODULE_REGISTER(sid_storage_cache, CONFIG_SIDEWALK_LOG_LEVEL);
+
+#define CACHE_ENTRIES CONFIG_SIDEWALK_STORAGE_CACHE_ENTRIES
+#define CACHE_CRITICAL_MAX CONFIG_SIDEWALK_STORAGE_CACHE_CRITICAL_MAX
+#define CACHE_FLUSH_DELAY K_MSEC(CONFIG_SIDEWALK_STORAGE_CACHE_FLUSH_DELAY_MS)
+#define CACHE_DATA_MAX SID_PAL_KV_STORE_MAX_LENGTH_BYTES
+
+struct cache_entry {
+	uint16_t group;
+	uint16_t key;
+	uint32_t last_use;
+	uint8_t len;
+	bool used;
+	/* The value is not written to the backend yet. */
+	bool dirty;
+	uint8_t data[CACHE_DATA_MAX];
+};
+
+struct critical_record {
+	uint16_t group;
+	uint16_t key;
+	bool used;
+};
+
+static K_MUTEX_DEFINE(cache_mutex);
+static struct cache_entry cache[CACHE_ENTRIES];
+static struct critical_record critical[CACHE_CRITICAL_MAX];
+static const struct sid_storage_cache_backend *cache_backend;
+static uint32_t cache_use_counter;
+static struct sid_storage_cache_stats cache_stats;
+
+static void cache_flush_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(cache_flush_work, cache_flush_work_handler);
+
+/* Has to be called with the mutex held. */
+static struct cache_entry *cache_find(uint16_t group, uint16_t key)
+{
+	for (int i = 0; i < CACHE_ENTRIES; i++) {
+		if (cache[i].used && cache[i].group == group && cache[i].key == key) {
+			return &cache[i];
+		}
+	}
+	return NULL;
+}
+
+/* Has to be called with the mutex held. */
+static bool cache_is_critical(uint16_t group, uint16_t key)
+{
+	for (int i = 0; i < CACHE_CRITICAL_MAX; i++) {
+		if (critical[i].used && critical[i].group == group &&
+		    (critical[i].key == key || critical[i].key == SID_STORAGE_CACHE_KEY_ANY)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/* Has to be called with the mutex held. */
+static sid_error_t cache_flush(void)
+{
+	sid_error_t erc = SID_ERROR_NONE;
+	uint32_t written = 0;
+
+	if (!cache_backend) {
+		return SID_ERROR_NONE;
+	}
+
+	for (int i = 0; i < CACHE_ENTRIES; i++) {
+		if (!cache[i].used || !cache[i].dirty) {
+			continue;
+		}
+		int err = cache_backend->write(cache[i].group, cache[i].key, cache[i].data,
+					       cache[i].len);
+		if (err) {
+			LOG_ERR("Failed to write record %04x/%04x (err %d)", cache[i].group,
+				cache[i].key, err);
+			erc = SID_ERROR_STORAGE_WRITE_FAIL;
+			continue;
+		}
+		cache[i].dirty = false;
+		written++;
+	}
+
+	if (written) {
+		int err = cache_backend->commit();
+		if (err) {
+			LOG_ERR("Failed to commit records (err %d)", err);
+			erc = SID_ERROR_STORAGE_WRITE_FAIL;
+		}
+		cache_stats.flushes++;
+		cache_stats.flushed_records += written;
+	}
+
+	return erc;
+}
+
+/* Has to be called with the mutex held. Returns an unused or the least recently used entry. */
+static struct cache_entry *cache_entry_alloc(bool clean_only)
+{
+	struct cache_entry *lru = NULL;
+
+	for (int i = 0; i < CACHE_ENTRIES; i++) {
+		if (!cache[i].used) {
+			return &cache[i];
+		}
+		if (clean_only && cache[i].dirty) {
+			continue;
+		}
+		if (!lru || (int32_t)(cache[i].last_use - lru->last_use) < 0) {
+			lru = &cache[i];
+		}
+	}
+	return lru;
+}
+
+static void cache_flush_work_handler(struct k_work *work)
+{
+	sid_error_t erc;
+
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+	erc = cache_flush();
+	if (erc != SID_ERROR_NONE) {
+		/* The records stay in the cache, try again later. */
+		k_work_schedule(&cache_flush_work, CACHE_FLUSH_DELAY);
+	}
+	k_mutex_unlock(&cache_mutex);
+}
+
+void sid_storage_cache_init(const struct sid_storage_cache_backend *backend)
+{
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+	cache_backend = backend;
+	k_mutex_unlock(&cache_mutex);
+}
+
+sid_error_t sid_storage_cache_set(uint16_t group, uint16_t key, const void *data, uint32_t len)
+{
+	struct cache_entry *entry;
+	sid_error_t erc = SID_ERROR_NONE;
+
+	if (len > CACHE_DATA_MAX) {
+		return SID_ERROR_NOSUPPORT;
+	}
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+	if (!cache_backend || cache_is_critical(group, key)) {
+		cache_stats.write_through++;
+		k_mutex_unlock(&cache_mutex);
+		return SID_ERROR_NOSUPPORT;
+	}
+
+	entry = cache_find(group, key);
+	if (entry && entry->len == len && !memcmp(entry->data, data, len)) {
+		entry->last_use = ++cache_use_counter;
+		cache_stats.unchanged++;
+		k_mutex_unlock(&cache_mutex);
+		return SID_ERROR_NONE;
+	}
+
+	if (entry) {
+		cache_stats.coalesced += entry->dirty ? 1 : 0;
+	} else {
+		entry = cache_entry_alloc(true);
+		if (!entry) {
+			/* Every entry holds an unwritten record. */
+			erc = cache_flush();
+			entry = cache_entry_alloc(true);
+		}
+	}
+
+	if (entry) {
+		entry->group = group;
+		entry->key = key;
+		entry->len = len;
+		entry->used = true;
+		entry->dirty = true;
+		entry->last_use = ++cache_use_counter;
+		memcpy(entry->data, data, len);
+		cache_stats.writes++;
+		erc = SID_ERROR_NONE;
+		k_work_schedule(&cache_flush_work, CACHE_FLUSH_DELAY);
+	}
+	k_mutex_unlock(&cache_mutex);
+
+	return erc;
+}
+
+bool sid_storage_cache_get(uint16_t group, uint16_t key, void *data, uint32_t len,
+			   uint32_t *stored_len)
+{
+	struct cache_entry *entry;
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+	entry = cache_find(group, key);
+	if (entry) {
+		if (data) {
+			memcpy(data, entry->data, MIN(len, entry->len));
+		}
+		if (stored_len) {
+			*stored_len = entry->len;
+		}
+		entry->last_use = ++cache_use_counter;
+		cache_stats.read_hits++;
+	}
+	k_mutex_unlock(&cache_mutex);
+
+	return entry != NULL;
+}
+
+void sid_storage_cache_invalidate(uint16_t group, uint16_t key)
+{
+	struct cache_entry *entry;
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+	entry = cache_find(group, key);
+	if (entry) {
+		memset(entry, 0, sizeof(*entry));
+	}
+	k_mutex_unlock(&cache_mutex);
+}
+
+void sid_storage_cache_invalidate_group(uint16_t group)
+{
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+	for (int i = 0; i < CACHE_ENTRIES; i++) {
+		if (cache[i].used && cache[i].group == group) {
+			memset(&cache[i], 0, sizeof(cache[i]));
+		}
+	}
+	k_mutex_unlock(&cache_mutex);
+}
+
+sid_error_t sid_storage_cache_critical_add(uint16_t group, uint16_t key)
+{
+	sid_error_t erc = SID_ERROR_OOM;
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+	if (cache_is_critical(group, key)) {
+		erc = SID_ERROR_NONE;
+	}
+	for (int i = 0; erc != SID_ERROR_NONE && i < CACHE_CRITICAL_MAX; i++) {
+		if (!critical[i].used) {
+			critical[i] = (struct critical_record){ .group = group, .key = key, .used = true };
+			erc = SID_ERROR_NONE;
+		}
+	}
+	k_mutex_unlock(&cache_mutex);
+
+	if (erc == SID_ERROR_NONE) {
+		/* Cached values of the record are written now, later writes go through. */
+		erc = sid_storage_cache_sync();
+	}
+
+	return erc;
+}
+
+bool sid_storage_cache_is_critical(uint16_t group, uint16_t key)
+{
+	bool is_critical;
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+	is_critical = cache_is_critical(group, key);
+	k_mutex_unlock(&cache_mutex);
+
+	return is_critical;
+}
+
+sid_error_t sid_storage_cache_sync(void)
+{
+	sid_error_t erc;
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+	erc = cache_flush();
+	if (erc == SID_ERROR_NONE) {
+		(void)k_work_cancel_delayable(&cache_flush_work);
+	}
+	k_mutex_unlock(&cache_mutex);
+
+	return erc;
+}
+
+void sid_storage_cache_stats_get(struct sid_storage_cache_stats *stats)
+{
+	if (!stats) {
+		return;
+	}
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+	*stats = cache_stats;
+	k_mutex_unlock(&cache_mutex);
+}
+
+void sid_storage_cache_stats_reset(void)
+{
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+	memset(&cache_stats, 0, sizeof(cache_stats));
+	k_mutex_unlock(&cache_mutex);
+}
@@ -0,0 +1,501 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_storage_id.c
+ *  @brief Sidewalk key-value storage with numeric IDs.
+ */
+
+#include <sid_storage_id.h>
+#include <sid_storage_map.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/settings/settings.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(CONFIG_SETTINGS_NVS)
+#include <zephyr/fs/nvs.h>
+#elif defined(CONFIG_SETTINGS_ZMS)
+#include <zephyr/fs/zms.h>
+#else
+#error "The Sidewalk storage with numeric IDs needs the settings NVS or ZMS backend"
+#endif
+
+LOG_MODULE_REGISTER(sid_storage_id, CONFIG_SIDEWALK_LOG_LEVEL);
+
+/* The settings backend uses the IDs from 0x8000, the Sidewalk records the range below. */
+#define ID_LAYOUT_ID 0x3fff
+#define ID_DIR_BASE 0x4000
+#define ID_VALUE_BASE 0x6000
+#define ID_RANGE_SIZE (ID_VALUE_BASE - ID_DIR_BASE)
+#define ID_LAYOUT_VERSION 2
+
+#define ID_MAP_SLOTS CONFIG_SIDEWALK_STORAGE_ID_SLOTS
+/* The map keeps a quarter of its slots free. */
+#define ID_RECORDS_MAX (ID_MAP_SLOTS - ID_MAP_SLOTS / 4)
+
+#define ID_SETTINGS_SUBTREE "sidewalk/storage"
+
+BUILD_ASSERT(ID_RECORDS_MAX <= ID_RANGE_SIZE, "Too many Sidewalk storage slots");
+
+struct id_dir_entry {
+	uint16_t group;
+	uint16_t key;
+};
+
+/* Stored in ID_LAYOUT_ID. */
+struct id_layout {
+	uint8_t version;
+	/* The records of the settings layout are moved to the slots. */
+	uint8_t migrated;
+	/* No slot at or above is used, so init reads only the directory below. */
+	uint16_t slots;
+};
+
+/* Entry IDs are the value IDs of the records. */
+SID_STORAGE_MAP_DEFINE(id_map, ID_MAP_SLOTS);
+static K_MUTEX_DEFINE(id_mutex);
+static uint32_t id_slots_used[DIV_ROUND_UP(ID_RECORDS_MAX, 32)];
+static struct id_layout id_layout;
+/* Used only during the migration, when the mutex is held. */
+static uint8_t id_migration_buf[SETTINGS_MAX_VAL_LEN];
+
+#if defined(CONFIG_SETTINGS_NVS)
+static struct nvs_fs *id_fs;
+
+static ssize_t id_fs_read(uint16_t id, void *data, size_t len)
+{
+	return nvs_read(id_fs, id, data, len);
+}
+
+static ssize_t id_fs_write(uint16_t id, const void *data, size_t len)
+{
+	return nvs_write(id_fs, id, data, len);
+}
+
+static int id_fs_delete(uint16_t id)
+{
+	return nvs_delete(id_fs, id);
+}
+
+static ssize_t id_fs_len(uint16_t id)
+{
+	uint8_t data;
+
+	/* Returns the size of the stored value, even when it does not fit the buffer. */
+	return nvs_read(id_fs, id, &data, sizeof(data));
+}
+#else
+static struct zms_fs *id_fs;
+
+static ssize_t id_fs_read(uint16_t id, void *data, size_t len)
+{
+	return zms_read(id_fs, id, data, len);
+}
+
+static ssize_t id_fs_write(uint16_t id, const void *data, size_t len)
+{
+	return zms_write(id_fs, id, data, len);
+}
+
+static int id_fs_delete(uint16_t id)
+{
+	return zms_delete(id_fs, id);
+}
+
+static ssize_t id_fs_len(uint16_t id)
+{
+	return zms_get_data_length(id_fs, id);
+}
+#endif /* CONFIG_SETTINGS_NVS */
+
+static inline uint16_t id_dir(uint32_t slot)
+{
+	return ID_DIR_BASE + slot;
+}
+
+static inline uint16_t id_value(uint32_t slot)
+{
+	return ID_VALUE_BASE + slot;
+}
+
+static inline uint32_t id_slot(uint16_t value_id)
+{
+	return value_id - ID_VALUE_BASE;
+}
+
+static void id_slot_mark(uint32_t slot, bool used)
+{
+	/* Slots over the limit of this build are used by a build with more slots, never allocated. */
+	if (slot >= ID_RECORDS_MAX) {
+		return;
+	}
+	if (used) {
+		id_slots_used[slot / 32] |= BIT(slot % 32);
+	} else {
+		id_slots_used[slot / 32] &= ~BIT(slot % 32);
+	}
+}
+
+/* Has to be called with the mutex held. */
+static int id_layout_write(uint8_t migrated, uint32_t slots)
+{
+	struct id_layout layout = {
+		.version = ID_LAYOUT_VERSION,
+		.migrated = migrated,
+		.slots = slots,
+	};
+	ssize_t rc = id_fs_write(ID_LAYOUT_ID, &layout, sizeof(layout));
+
+	if (rc < 0) {
+		LOG_ERR("Failed to write layout (err %d)", (int)rc);
+		return rc;
+	}
+	id_layout = layout;
+	return 0;
+}
+
+/* Has to be called with the mutex held. */
+static int id_layout_read(void)
+{
+	ssize_t rc = id_fs_read(ID_LAYOUT_ID, &id_layout, sizeof(id_layout));
+
+	if (rc == sizeof(id_layout) && id_layout.version == ID_LAYOUT_VERSION) {
+		return 0;
+	}
+	if (rc < 0 && rc != -ENOENT) {
+		return rc;
+	}
+
+	/*
+	 * Without the layout of this version the used slots are not known, so the
+	 * whole range is read once. The older layout was written after the migration.
+	 */
+	id_layout.version = 0;
+	id_layout.migrated = rc > 0;
+	id_layout.slots = ID_RANGE_SIZE;
+	return 0;
+}
+
+static int id_slot_alloc(void)
+{
+	for (uint32_t slot = 0; slot < ID_RECORDS_MAX; slot++) {
+		if (!(id_slots_used[slot / 32] & BIT(slot % 32))) {
+			return slot;
+		}
+	}
+	return -ENOSPC;
+}
+
+/* Has to be called with the mutex held. */
+static int id_map_build(void)
+{
+	struct id_dir_entry dir;
+	uint32_t slots = 0;
+	ssize_t rc;
+
+	sid_storage_map_clear(&id_map);
+	memset(id_slots_used, 0, sizeof(id_slots_used));
+
+	/* Slots over the limit of this build may be used by a build with more slots. */
+	for (uint32_t slot = 0; slot < id_layout.slots; slot++) {
+		rc = id_fs_read(id_dir(slot), &dir, sizeof(dir));
+		if (rc == -ENOENT) {
+			continue;
+		}
+		if (rc < 0) {
+			LOG_ERR("Failed to read slot %u (err %d)", slot, (int)rc);
+			return rc;
+		}
+		slots = slot + 1;
+		/* The value is written before the directory entry and deleted after it. */
+		rc = id_fs_len(id_value(slot));
+		if (rc <= 0) {
+			LOG_WRN("Slot %u without value", slot);
+			continue;
+		}
+		if (!sid_storage_map_insert(&id_map, dir.group, dir.key, id_value(slot), rc)) {
+			LOG_ERR("No map slot for record %04x/%04x", dir.group, dir.key);
+			return -ENOSPC;
+		}
+		id_slot_mark(slot, true);
+	}
+
+	/* Lowered when the highest slots were freed, so the next init reads less. */
+	if (id_layout.version != ID_LAYOUT_VERSION || slots < id_layout.slots) {
+		return id_layout_write(id_layout.migrated, slots);
+	}
+	return 0;
+}
+
+/* Has to be called with the mutex held. */
+static int id_record_write(uint16_t group, uint16_t key, const void *data, uint32_t len)
+{
+	struct sid_storage_map_entry *entry = sid_storage_map_find(&id_map, group, key);
+	struct id_dir_entry dir = { .group = group, .key = key };
+	ssize_t rc;
+	int slot;
+
+	if (entry) {
+		rc = id_fs_write(entry->id, data, len);
+		if (rc < 0) {
+			return rc;
+		}
+		entry->len = len;
+		return 0;
+	}
+
+	slot = id_slot_alloc();
+	if (slot < 0) {
+		LOG_ERR("No free slot for record %04x/%04x", group, key);
+		return slot;
+	}
+
+	/* Raised before the slot is written, so the next init reads it. */
+	if (slot >= id_layout.slots) {
+		rc = id_layout_write(id_layout.migrated, slot + 1);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	rc = id_fs_write(id_value(slot), data, len);
+	if (rc >= 0) {
+		rc = id_fs_write(id_dir(slot), &dir, sizeof(dir));
+	}
+	if (rc < 0) {
+		(void)id_fs_delete(id_value(slot));
+		return rc;
+	}
+
+	sid_storage_map_insert(&id_map, group, key, id_value(slot), len);
+	id_slot_mark(slot, true);
+	return 0;
+}
+
+/* Has to be called with the mutex held. The map entry is left to the caller. */
+static int id_record_erase(uint16_t value_id)
+{
+	uint32_t slot = id_slot(value_id);
+	int rc = id_fs_delete(id_dir(slot));
+
+	if (rc == 0) {
+		rc = id_fs_delete(value_id);
+	}
+	if (rc == 0) {
+		id_slot_mark(slot, false);
+	}
+	return rc;
+}
+
+struct id_migration {
+	uint32_t migrated;
+	/* The settings do not return the error of the callback. */
+	int err;
+};
+
+static int id_migrate_cb(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg,
+			 void *param)
+{
+	struct id_migration *migration = param;
+	char serial[32];
+	uint16_t record_group;
+	uint16_t record_key;
+	char *end;
+	ssize_t rc;
+
+	/* The key is "gggg/kkkk", relative to the subtree. */
+	record_group = (uint16_t)strtoul(key, &end, 16);
+	if (end == key || *end != '/') {
+		return 0;
+	}
+	record_key = (uint16_t)strtoul(end + 1, &end, 16);
+	if (*end != '\0') {
+		return 0;
+	}
+
+	if (len == 0) {
+		return 0;
+	}
+
+	/* The record stays in the settings and the layout is not marked as migrated. */
+	if (len > sizeof(id_migration_buf)) {
+		LOG_ERR("Record %s of %u bytes is too large to migrate", key, len);
+		migration->err = -EFBIG;
+		return migration->err;
+	}
+
+	rc = read_cb(cb_arg, id_migration_buf, len);
+	if (rc <= 0) {
+		LOG_ERR("Failed to read record %s (err %d)", key, (int)rc);
+		migration->err = rc ? rc : -EIO;
+		return migration->err;
+	}
+
+	rc = id_record_write(record_group, record_key, id_migration_buf, rc);
+	if (rc) {
+		migration->err = rc;
+		return rc;
+	}
+
+	/* A migration interrupted here writes the same value again on the next boot. */
+	snprintf(serial, sizeof(serial), ID_SETTINGS_SUBTREE "/%s", key);
+	rc = settings_delete(serial);
+	if (rc) {
+		LOG_ERR("Failed to delete migrated record %s (err %d)", serial, (int)rc);
+		migration->err = rc;
+		return rc;
+	}
+
+	migration->migrated++;
+	return 0;
+}
+
+/* Has to be called with the mutex held. */
+static int id_migrate(void)
+{
+	struct id_migration migration = { 0 };
+	int rc;
+
+	if (id_layout.migrated) {
+		return 0;
+	}
+
+	rc = settings_load_subtree_direct(ID_SETTINGS_SUBTREE, id_migrate_cb, &migration);
+	if (rc == 0) {
+		rc = migration.err;
+	}
+	if (rc) {
+		LOG_ERR("Migration from settings failed (err %d)", rc);
+		return rc;
+	}
+
+	rc = id_layout_write(true, id_layout.slots);
+	if (rc) {
+		return rc;
+	}
+
+	LOG_INF("Migrated %u records from settings", migration.migrated);
+	return 0;
+}
+
+int sid_storage_id_init(void)
+{
+	void *storage = NULL;
+	int rc;
+
+	rc = settings_storage_get(&storage);
+	if (rc || !storage) {
+		LOG_ERR("Settings file system not available (err %d)", rc);
+		return rc ? rc : -ENODEV;
+	}
+
+	k_mutex_lock(&id_mutex, K_FOREVER);
+	id_fs = storage;
+	rc = id_layout_read();
+	if (rc == 0) {
+		rc = id_map_build();
+	}
+	if (rc == 0) {
+		rc = id_migrate();
+	}
+	k_mutex_unlock(&id_mutex);
+
+	return rc;
+}
+
+int sid_storage_id_read(uint16_t group, uint16_t key, void *data, uint32_t len,
+			uint32_t *stored_len)
+{
+	struct sid_storage_map_entry *entry;
+	int rc = 0;
+
+	k_mutex_lock(&id_mutex, K_FOREVER);
+	entry = sid_storage_map_find(&id_map, group, key);
+	if (!entry) {
+		rc = -ENOENT;
+	} else {
+		if (data) {
+			ssize_t read = id_fs_read(entry->id, data, len);
+
+			rc = read < 0 ? read : 0;
+		}
+		if (stored_len) {
+			*stored_len = entry->len;
+		}
+	}
+	k_mutex_unlock(&id_mutex);
+
+	return rc;
+}
+
+int sid_storage_id_write(uint16_t group, uint16_t key, const void *data, uint32_t len)
+{
+	int rc;
+
+	k_mutex_lock(&id_mutex, K_FOREVER);
+	rc = id_record_write(group, key, data, len);
+	k_mutex_unlock(&id_mutex);
+
+	return rc;
+}
+
+int sid_storage_id_delete(uint16_t group, uint16_t key)
+{
+	struct sid_storage_map_entry *entry;
+	int rc = 0;
+
+	k_mutex_lock(&id_mutex, K_FOREVER);
+	entry = sid_storage_map_find(&id_map, group, key);
+	if (entry) {
+		rc = id_record_erase(entry->id);
+		if (rc == 0) {
+			sid_storage_map_remove(&id_map, entry);
+		}
+	}
+	k_mutex_unlock(&id_mutex);
+
+	return rc;
+}
+
+int sid_storage_id_group_delete(uint16_t group)
+{
+	int rc = 0;
+
+	k_mutex_lock(&id_mutex, K_FOREVER);
+	for (uint32_t i = 0; i < id_map.slots && rc == 0; i++) {
+		if (id_map.entries[i].id && id_map.entries[i].group == group) {
+			rc = id_record_erase(id_map.entries[i].id);
+		}
+	}
+	if (rc == 0) {
+		sid_storage_map_remove_group(&id_map, group);
+	} else {
+		/* Some records of the group are deleted. */
+		(void)id_map_build();
+	}
+	k_mutex_unlock(&id_mutex);
+
+	return rc;
+}
+
+int sid_storage_id_group_records(uint16_t group)
+{
+	int records = 0;
+
+	k_mutex_lock(&id_mutex, K_FOREVER);
+	for (uint32_t i = 0; i < id_map.slots; i++) {
+		if (id_map.entries[i].id && id_map.entries[i].group == group) {
+			records++;
+		}
+	}
+	k_mutex_unlock(&id_mutex);
+
+	return records;
+}
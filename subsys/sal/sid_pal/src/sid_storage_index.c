@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_storage_index.c
+ *  @brief RAM index of the Sidewalk key-value storage records.
+ */
+
+#include <sid_storage_index.h>
+#include <sid_storage_map.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/fs/nvs.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/settings/settings.h>
+#include <settings/settings_nvs.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+LOG_MODULE_REGISTER(sid_storage_index, CONFIG_SIDEWALK_LOG_LEVEL);
+
+#define INDEX_NAME_PREFIX "sidewalk/storage/"
+#define INDEX_NAME_PREFIX_LEN (sizeof(INDEX_NAME_PREFIX) - 1)
+/* "sidewalk/storage/gggg/kkkk", stored by the settings backend without the terminator. */
+#define INDEX_NAME_LEN (INDEX_NAME_PREFIX_LEN + 9)
+
+/* Entry IDs are the NVS IDs of the record names, the values are stored at
+ * id + NVS_NAME_ID_OFFSET. Name IDs start above NVS_NAMECNT_ID, so they are never 0.
+ */
+SID_STORAGE_MAP_DEFINE(index_map, CONFIG_SIDEWALK_STORAGE_INDEX_SLOTS);
+static K_MUTEX_DEFINE(index_mutex);
+static struct nvs_fs *index_fs;
+static bool index_complete;
+
+/* Has to be called with the mutex held. */
+static void index_insert(uint16_t group, uint16_t key, uint16_t name_id, uint32_t len)
+{
+	if (!sid_storage_map_insert(&index_map, group, key, name_id, len)) {
+		LOG_WRN("Index full, lookups use the settings backend");
+		index_complete = false;
+	}
+}
+
+static bool index_name_parse(const char *name, ssize_t name_len, uint16_t *group, uint16_t *key)
+{
+	char hex[5] = { 0 };
+	char *end;
+
+	if (name_len != INDEX_NAME_LEN || memcmp(name, INDEX_NAME_PREFIX, INDEX_NAME_PREFIX_LEN) ||
+	    name[INDEX_NAME_PREFIX_LEN + 4] != '/') {
+		return false;
+	}
+
+	memcpy(hex, &name[INDEX_NAME_PREFIX_LEN], 4);
+	*group = (uint16_t)strtoul(hex, &end, 16);
+	if (*end) {
+		return false;
+	}
+	memcpy(hex, &name[INDEX_NAME_PREFIX_LEN + 5], 4);
+	*key = (uint16_t)strtoul(hex, &end, 16);
+	return *end == '\0';
+}
+
+/* Has to be called with the mutex held. Only new records are looked up, the settings backend keeps
+ * the name ID of a record when its value changes.
+ */
+static int index_name_id_find(uint16_t group, uint16_t key, uint16_t *name_id)
+{
+	char expected[INDEX_NAME_LEN + 1];
+	char name[INDEX_NAME_LEN];
+	uint16_t last_id;
+	ssize_t rc;
+
+	snprintf(expected, sizeof(expected), INDEX_NAME_PREFIX "%04x/%04x", group, key);
+
+	rc = nvs_read(index_fs, NVS_NAMECNT_ID, &last_id, sizeof(last_id));
+	if (rc < 0) {
+		return rc;
+	}
+
+	for (uint32_t id = last_id; id > NVS_NAMECNT_ID; id--) {
+		rc = nvs_read(index_fs, id, name, sizeof(name));
+		if (rc == INDEX_NAME_LEN && !memcmp(name, expected, INDEX_NAME_LEN)) {
+			*name_id = id;
+			return 0;
+		}
+	}
+	return -ENOENT;
+}
+
+sid_error_t sid_storage_index_build(void)
+{
+	void *storage = NULL;
+	char name[INDEX_NAME_LEN];
+	uint16_t last_id;
+	uint16_t group, key;
+	uint8_t value;
+	ssize_t rc;
+
+	k_mutex_lock(&index_mutex, K_FOREVER);
+	sid_storage_map_clear(&index_map);
+	index_complete = false;
+
+	rc = settings_storage_get(&storage);
+	if (rc || !storage) {
+		LOG_ERR("Settings NVS backend not available (err %d)", (int)rc);
+		k_mutex_unlock(&index_mutex);
+		return SID_ERROR_STORAGE_READ_FAIL;
+	}
+	index_fs = storage;
+
+	rc = nvs_read(index_fs, NVS_NAMECNT_ID, &last_id, sizeof(last_id));
+	if (rc == -ENOENT) {
+		/* Nothing was stored yet. */
+		last_id = NVS_NAMECNT_ID;
+	} else if (rc < 0) {
+		LOG_ERR("Failed to read settings name count (err %d)", (int)rc);
+		k_mutex_unlock(&index_mutex);
+		return SID_ERROR_STORAGE_READ_FAIL;
+	}
+
+	index_complete = true;
+	for (uint32_t id = NVS_NAMECNT_ID + 1; id <= last_id && index_complete; id++) {
+		rc = nvs_read(index_fs, id, name, sizeof(name));
+		if (rc == -ENOENT) {
+			continue;
+		}
+		if (rc < 0) {
+			LOG_ERR("Failed to read settings name %04x (err %d)", id, (int)rc);
+			index_complete = false;
+			break;
+		}
+		if (!index_name_parse(name, rc, &group, &key)) {
+			continue;
+		}
+		/* Returns the size of the stored value, even when it does not fit the buffer. */
+		rc = nvs_read(index_fs, id + NVS_NAME_ID_OFFSET, &value, sizeof(value));
+		if (rc <= 0) {
+			continue;
+		}
+		index_insert(group, key, id, rc);
+	}
+
+	LOG_DBG("Indexed %u records", index_map.count);
+	k_mutex_unlock(&index_mutex);
+
+	return index_complete ? SID_ERROR_NONE : SID_ERROR_STORAGE_READ_FAIL;
+}
+
+int sid_storage_index_read(uint16_t group, uint16_t key, void *data, uint32_t len,
+			   uint32_t *stored_len)
+{
+	struct sid_storage_map_entry *entry;
+	int err = 0;
+
+	k_mutex_lock(&index_mutex, K_FOREVER);
+	if (!index_complete) {
+		k_mutex_unlock(&index_mutex);
+		return -EAGAIN;
+	}
+
+	entry = sid_storage_map_find(&index_map, group, key);
+	if (!entry) {
+		err = -ENOENT;
+	} else {
+		if (data && nvs_read(index_fs, entry->id + NVS_NAME_ID_OFFSET, data, len) <= 0) {
+			err = -EAGAIN;
+		}
+		if (stored_len) {
+			*stored_len = entry->len;
+		}
+	}
+	k_mutex_unlock(&index_mutex);
+
+	return err;
+}
+
+void sid_storage_index_update(uint16_t group, uint16_t key, uint32_t len)
+{
+	struct sid_storage_map_entry *entry;
+	uint16_t name_id;
+
+	k_mutex_lock(&index_mutex, K_FOREVER);
+	if (!index_complete) {
+		k_mutex_unlock(&index_mutex);
+		return;
+	}
+
+	entry = sid_storage_map_find(&index_map, group, key);
+	if (entry) {
+		entry->len = (uint16_t)len;
+	} else if (index_name_id_find(group, key, &name_id) == 0) {
+		index_insert(group, key, name_id, len);
+	} else {
+		LOG_WRN("Record %04x/%04x not found in the backend, index dropped", group, key);
+		index_complete = false;
+	}
+	k_mutex_unlock(&index_mutex);
+}
+
+void sid_storage_index_remove(uint16_t group, uint16_t key)
+{
+	struct sid_storage_map_entry *entry;
+
+	k_mutex_lock(&index_mutex, K_FOREVER);
+	entry = sid_storage_map_find(&index_map, group, key);
+	if (entry) {
+		sid_storage_map_remove(&index_map, entry);
+	}
+	k_mutex_unlock(&index_mutex);
+}
+
+void sid_storage_index_remove_group(uint16_t group)
+{
+	k_mutex_lock(&index_mutex, K_FOREVER);
+	sid_storage_map_remove_group(&index_map, group);
+	k_mutex_unlock(&index_mutex);
+}
+
+bool sid_storage_index_is_complete(void)
+{
+	bool complete;
+
+	k_mutex_lock(&index_mutex, K_FOREVER);
+	complete = index_complete;
+	k_mutex_unlock(&index_mutex);
+
+	return complete;
+}
+
+uint32_t sid_storage_index_records(void)
+{
+	uint32_t count;
+
+	k_mutex_lock(&index_mutex, K_FOREVER);
+	count = index_map.count;
+	k_mutex_unlock(&index_mutex);
+
+	return count;
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_storage_map.c
+ *  @brief Hash table mapping the group and key of a Sidewalk record to its backend ID.
+ */
+
+#include <sid_storage_map.h>
+
+#include <string.h>
+
+static inline bool map_entry_used(const struct sid_storage_map_entry *entry)
+{
+	return entry->id != 0;
+}
+
+static inline uint32_t map_hash(const struct sid_storage_map *map, uint16_t group, uint16_t key)
+{
+	uint32_t hash = (((uint32_t)group << 16) | key) * 2654435761u;
+
+	return (hash >> 16) & (map->slots - 1);
+}
+
+static inline uint32_t map_next(const struct sid_storage_map *map, uint32_t i)
+{
+	return (i + 1) & (map->slots - 1);
+}
+
+/* Later entries of the probe sequence are moved back into the hole. */
+static void map_slot_remove(struct sid_storage_map *map, uint32_t hole)
+{
+	uint32_t mask = map->slots - 1;
+	uint32_t i = hole;
+
+	memset(&map->entries[hole], 0, sizeof(map->entries[hole]));
+	map->count--;
+
+	for (;;) {
+		i = map_next(map, i);
+		if (!map_entry_used(&map->entries[i])) {
+			return;
+		}
+		uint32_t home = map_hash(map, map->entries[i].group, map->entries[i].key);
+
+		if (((i - home) & mask) >= ((i - hole) & mask)) {
+			map->entries[hole] = map->entries[i];
+			memset(&map->entries[i], 0, sizeof(map->entries[i]));
+			hole = i;
+		}
+	}
+}
+
+void sid_storage_map_clear(struct sid_storage_map *map)
+{
+	memset(map->entries, 0, map->slots * sizeof(map->entries[0]));
+	map->count = 0;
+}
+
+struct sid_storage_map_entry *sid_storage_map_find(struct sid_storage_map *map, uint16_t group,
+						   uint16_t key)
+{
+	uint32_t i = map_hash(map, group, key);
+
+	for (uint32_t n = 0; n < map->slots; n++, i = map_next(map, i)) {
+		if (!map_entry_used(&map->entries[i])) {
+			return NULL;
+		}
+		if (map->entries[i].group == group && map->entries[i].key == key) {
+			return &map->entries[i];
+		}
+	}
+	return NULL;
+}
+
+struct sid_storage_map_entry *sid_storage_map_insert(struct sid_storage_map *map, uint16_t group,
+						     uint16_t key, uint16_t id, uint32_t len)
+{
+	uint32_t i = map_hash(map, group, key);
+
+	if (map->count >= map->slots - map->slots / 4) {
+		return NULL;
+	}
+
+	while (map_entry_used(&map->entries[i])) {
+		i = map_next(map, i);
+	}
+	map->entries[i] = (struct sid_storage_map_entry){
+		.group = group, .key = key, .id = id, .len = (uint16_t)len
+	};
+	map->count++;
+	return &map->entries[i];
+}
+
+void sid_storage_map_remove(struct sid_storage_map *map, struct sid_storage_map_entry *entry)
+{
+	map_slot_remove(map, entry - map->entries);
+}
+
+void sid_storage_map_remove_group(struct sid_storage_map *map, uint16_t group)
+{
+	bool removed;
+
+	do {
+		/* A removal near the end of the table can move entries of the group to its start. */
+		removed = false;
+		for (uint32_t i = 0; i < map->slots; i++) {
+			while (map_entry_used(&map->entries[i]) && map->entries[i].group == group) {
+				map_slot_remove(map, i);
+				removed = true;
+			}
+		}
+	} while (removed);
+}
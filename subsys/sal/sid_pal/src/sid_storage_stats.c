@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_storage_stats.c
+ *  @brief Flash wear statistics of the Sidewalk storage.
+ */
+
+#include <sid_storage_stats.h>
+#include <settings_utils.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/settings/settings.h>
+#include <string.h>
+
+#if defined(CONFIG_SETTINGS_NVS)
+#include <zephyr/fs/nvs.h>
+#elif defined(CONFIG_SETTINGS_ZMS)
+#include <zephyr/fs/zms.h>
+#endif
+
+LOG_MODULE_REGISTER(sid_storage_stats, CONFIG_SIDEWALK_LOG_LEVEL);
+
+#define STATS_SETTINGS_KEY "sidewalk/stats/storage"
+#define STATS_VERSION 1
+#define STATS_SAVE_INTERVAL_S CONFIG_SIDEWALK_STORAGE_STATS_SAVE_INTERVAL_S
+
+struct stats_record {
+	uint32_t version;
+	struct sid_storage_stats stats;
+};
+
+static K_MUTEX_DEFINE(stats_mutex);
+static struct sid_storage_stats stats;
+/* Groups written or deleted since the last commit, the last entry is for the other groups. */
+static bool stats_group_pending[SID_STORAGE_STATS_GROUPS + 1];
+static bool stats_loaded;
+static bool stats_changed;
+
+/* Used with the save mutex held, too large for the stack. Locked before the stats mutex. */
+static K_MUTEX_DEFINE(stats_save_mutex);
+static struct stats_record stats_record;
+
+static void stats_save_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(stats_save_work, stats_save_work_handler);
+
+static const char *const source_names[SID_STORAGE_STATS_SOURCE_NUM] = {
+	[SID_STORAGE_STATS_MFG] = "mfg",
+	[SID_STORAGE_STATS_SETTINGS_UTILS] = "settings_utils",
+	[SID_STORAGE_STATS_DFU_IMAGE] = "dfu_image",
+};
+
+/*
+ * The sector of the allocation table write address moves to the next sector
+ * when the current one is full, after the garbage collection of the sector
+ * following it, which is erased. The address is read without the file system
+ * lock, a move which is in progress is counted on the next call.
+ */
+#if defined(CONFIG_SETTINGS_NVS)
+/* ADDR_SECT_SHIFT of the NVS. */
+#define STATS_FS_SECT_SHIFT 16
+static struct nvs_fs *stats_fs;
+#elif defined(CONFIG_SETTINGS_ZMS)
+/* ADDR_SECT_SHIFT of the ZMS. */
+#define STATS_FS_SECT_SHIFT 32
+static struct zms_fs *stats_fs;
+#endif
+
+#ifdef STATS_FS_SECT_SHIFT
+static uint32_t stats_last_sector;
+
+static bool stats_fs_sector(uint32_t *sector)
+{
+	if (!stats_fs || !stats_fs->sector_count) {
+		return false;
+	}
+	*sector = (uint32_t)(stats_fs->ate_wra >> STATS_FS_SECT_SHIFT);
+	return true;
+}
+#endif /* STATS_FS_SECT_SHIFT */
+
+/* Has to be called with the mutex held. */
+static void stats_backend_sample(void)
+{
+#ifdef STATS_FS_SECT_SHIFT
+	uint32_t sector;
+	uint32_t moves;
+
+	if (!stats_fs_sector(&sector) || sector == stats_last_sector) {
+		return;
+	}
+
+	/* More than one full turn of the sectors between two calls is not detected. */
+	moves = (sector + stats_fs->sector_count - stats_last_sector) % stats_fs->sector_count;
+	stats.backend.gc_erases += moves;
+	stats.backend.erased_bytes += (uint64_t)moves * stats_fs->sector_size;
+	stats_last_sector = sector;
+#endif /* STATS_FS_SECT_SHIFT */
+}
+
+/* Has to be called with the mutex held. */
+static void stats_mark_changed(void)
+{
+	stats_changed = true;
+	if (stats_loaded && STATS_SAVE_INTERVAL_S > 0) {
+		/* Not moved when scheduled already, so the interval is kept. */
+		(void)k_work_schedule(&stats_save_work, K_SECONDS(STATS_SAVE_INTERVAL_S));
+	}
+}
+
+/* Has to be called with the mutex held. Returns SID_STORAGE_STATS_GROUPS for the other groups. */
+static int stats_group_index(uint16_t group)
+{
+	for (int i = 0; i < SID_STORAGE_STATS_GROUPS; i++) {
+		struct sid_storage_stats_group *entry = &stats.groups[i];
+
+		if (!entry->writes && !entry->deletes) {
+			entry->group = group;
+			return i;
+		}
+		if (entry->group == group) {
+			return i;
+		}
+	}
+	return SID_STORAGE_STATS_GROUPS;
+}
+
+static struct sid_storage_stats_group *stats_group_entry(int index)
+{
+	return index < SID_STORAGE_STATS_GROUPS ? &stats.groups[index] : &stats.other;
+}
+
+/* Has to be called with the mutex held. */
+static void stats_key_add(uint16_t group, uint16_t key, uint32_t writes)
+{
+	struct sid_storage_stats_key *min = &stats.keys[0];
+
+	for (int i = 0; i < SID_STORAGE_STATS_KEYS; i++) {
+		struct sid_storage_stats_key *entry = &stats.keys[i];
+
+		if (entry->writes && entry->group == group && entry->key == key) {
+			entry->writes += writes;
+			return;
+		}
+		if (entry->writes < min->writes) {
+			min = entry;
+		}
+	}
+
+	/* Space saving, the least written record is replaced and its count kept. */
+	min->group = group;
+	min->key = key;
+	min->writes += writes;
+}
+
+static void stats_group_merge(struct sid_storage_stats_group *dst,
+			      const struct sid_storage_stats_group *src)
+{
+	dst->writes += src->writes;
+	dst->deletes += src->deletes;
+	dst->commits += src->commits;
+	dst->bytes += src->bytes;
+}
+
+/* Has to be called with the mutex held. */
+static void stats_merge(const struct sid_storage_stats *saved)
+{
+	for (int i = 0; i < SID_STORAGE_STATS_GROUPS; i++) {
+		const struct sid_storage_stats_group *entry = &saved->groups[i];
+
+		if (entry->writes || entry->deletes) {
+			stats_group_merge(stats_group_entry(stats_group_index(entry->group)),
+					  entry);
+		}
+	}
+	stats_group_merge(&stats.other, &saved->other);
+
+	for (int i = 0; i < SID_STORAGE_STATS_KEYS; i++) {
+		if (saved->keys[i].writes) {
+			stats_key_add(saved->keys[i].group, saved->keys[i].key,
+				      saved->keys[i].writes);
+		}
+	}
+
+	for (int i = 0; i < SID_STORAGE_STATS_SOURCE_NUM; i++) {
+		stats.source[i].writes += saved->source[i].writes;
+		stats.source[i].erases += saved->source[i].erases;
+		stats.source[i].bytes += saved->source[i].bytes;
+		stats.source[i].erased_bytes += saved->source[i].erased_bytes;
+	}
+
+	stats.backend.gc_erases += saved->backend.gc_erases;
+	stats.backend.commits += saved->backend.commits;
+	stats.backend.erased_bytes += saved->backend.erased_bytes;
+	stats.saves += saved->saves;
+}
+
+void sid_storage_stats_init(void)
+{
+	int len;
+
+	k_mutex_lock(&stats_save_mutex, K_FOREVER);
+	k_mutex_lock(&stats_mutex, K_FOREVER);
+#ifdef STATS_FS_SECT_SHIFT
+	void *storage = NULL;
+
+	if (!stats_fs && settings_storage_get(&storage) == 0 && storage) {
+		stats_fs = storage;
+		(void)stats_fs_sector(&stats_last_sector);
+	}
+#endif /* STATS_FS_SECT_SHIFT */
+
+	if (!stats_loaded) {
+		len = settings_utils_load_immediate_value(STATS_SETTINGS_KEY, &stats_record,
+							  sizeof(stats_record));
+		if (len == sizeof(stats_record) && stats_record.version == STATS_VERSION) {
+			stats_merge(&stats_record.stats);
+		} else if (len > 0) {
+			LOG_WRN("Saved storage statistics dropped, version or size changed");
+		}
+
+		stats_loaded = true;
+		if (stats_changed) {
+			stats_mark_changed();
+		}
+	}
+	k_mutex_unlock(&stats_mutex);
+	k_mutex_unlock(&stats_save_mutex);
+}
+
+void sid_storage_stats_record_write(uint16_t group, uint16_t key, uint32_t len)
+{
+	k_mutex_lock(&stats_mutex, K_FOREVER);
+	int index = stats_group_index(group);
+	struct sid_storage_stats_group *entry = stats_group_entry(index);
+
+	entry->writes++;
+	entry->bytes += len;
+	stats_group_pending[index] = true;
+	stats_key_add(group, key, 1);
+	stats_backend_sample();
+	stats_mark_changed();
+	k_mutex_unlock(&stats_mutex);
+}
+
+void sid_storage_stats_record_delete(uint16_t group)
+{
+	k_mutex_lock(&stats_mutex, K_FOREVER);
+	int index = stats_group_index(group);
+
+	stats_group_entry(index)->deletes++;
+	stats_group_pending[index] = true;
+	stats_backend_sample();
+	stats_mark_changed();
+	k_mutex_unlock(&stats_mutex);
+}
+
+void sid_storage_stats_commit(void)
+{
+	k_mutex_lock(&stats_mutex, K_FOREVER);
+	for (int i = 0; i <= SID_STORAGE_STATS_GROUPS; i++) {
+		if (stats_group_pending[i]) {
+			stats_group_entry(i)->commits++;
+			stats_group_pending[i] = false;
+		}
+	}
+	stats.backend.commits++;
+	stats_backend_sample();
+	stats_mark_changed();
+	k_mutex_unlock(&stats_mutex);
+}
+
+void sid_storage_stats_source_write(enum sid_storage_stats_source source, uint32_t len)
+{
+	if (source >= SID_STORAGE_STATS_SOURCE_NUM) {
+		return;
+	}
+
+	k_mutex_lock(&stats_mutex, K_FOREVER);
+	stats.source[source].writes++;
+	stats.source[source].bytes += len;
+	stats_backend_sample();
+	stats_mark_changed();
+	k_mutex_unlock(&stats_mutex);
+}
+
+void sid_storage_stats_source_erase(enum sid_storage_stats_source source, uint32_t len)
+{
+	if (source >= SID_STORAGE_STATS_SOURCE_NUM) {
+		return;
+	}
+
+	k_mutex_lock(&stats_mutex, K_FOREVER);
+	stats.source[source].erases++;
+	stats.source[source].erased_bytes += len;
+	stats_mark_changed();
+	k_mutex_unlock(&stats_mutex);
+}
+
+const char *sid_storage_stats_source_name(enum sid_storage_stats_source source)
+{
+	if (source >= SID_STORAGE_STATS_SOURCE_NUM) {
+		return "unknown";
+	}
+	return source_names[source];
+}
+
+void sid_storage_stats_get(struct sid_storage_stats *out)
+{
+	if (!out) {
+		return;
+	}
+
+	k_mutex_lock(&stats_mutex, K_FOREVER);
+	stats_backend_sample();
+	*out = stats;
+	k_mutex_unlock(&stats_mutex);
+}
+
+sid_error_t sid_storage_stats_reset(void)
+{
+	int err;
+
+	k_mutex_lock(&stats_save_mutex, K_FOREVER);
+	k_mutex_lock(&stats_mutex, K_FOREVER);
+	memset(&stats, 0, sizeof(stats));
+	memset(stats_group_pending, 0, sizeof(stats_group_pending));
+	stats_changed = false;
+	(void)k_work_cancel_delayable(&stats_save_work);
+	err = settings_delete(STATS_SETTINGS_KEY);
+	k_mutex_unlock(&stats_mutex);
+	k_mutex_unlock(&stats_save_mutex);
+
+	if (err) {
+		LOG_ERR("Failed to delete saved storage statistics (err %d)", err);
+		return SID_ERROR_STORAGE_ERASE_FAIL;
+	}
+	return SID_ERROR_NONE;
+}
+
+sid_error_t sid_storage_stats_save(void)
+{
+	int err;
+
+	k_mutex_lock(&stats_save_mutex, K_FOREVER);
+	k_mutex_lock(&stats_mutex, K_FOREVER);
+	if (!stats_loaded || !stats_changed) {
+		/* Saving before the saved statistics are loaded would overwrite them. */
+		k_mutex_unlock(&stats_mutex);
+		k_mutex_unlock(&stats_save_mutex);
+		return stats_loaded ? SID_ERROR_NONE : SID_ERROR_UNINITIALIZED;
+	}
+	stats.saves++;
+	stats_changed = false;
+	stats_record.version = STATS_VERSION;
+	stats_record.stats = stats;
+	k_mutex_unlock(&stats_mutex);
+
+	err = settings_save_one(STATS_SETTINGS_KEY, &stats_record, sizeof(stats_record));
+	k_mutex_unlock(&stats_save_mutex);
+
+	if (err) {
+		LOG_ERR("Failed to save storage statistics (err %d)", err);
+		k_mutex_lock(&stats_mutex, K_FOREVER);
+		stats.saves--;
+		stats_mark_changed();
+		k_mutex_unlock(&stats_mutex);
+		return SID_ERROR_STORAGE_WRITE_FAIL;
+	}
+	return SID_ERROR_NONE;
+}
+
+static void stats_save_work_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	(void)sid_storage_stats_save();
+}
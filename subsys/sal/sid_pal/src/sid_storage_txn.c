@@ -0,0 +1,374 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_storage_txn.c
+ *  @brief Transactions of the Sidewalk key-value storage.
+ */
+
+#include <sid_storage_txn.h>
+#include <sid_pal_storage_kv_ifc.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/crc.h>
+#include <errno.h>
+#include <string.h>
+
+LOG_MODULE_REGISTER(sid_storage_txn, CONFIG_SIDEWALK_LOG_LEVEL);
+
+#define TXN_BUF_SIZE CONFIG_SIDEWALK_STORAGE_TXN_BUF_SIZE
+#define TXN_JOURNAL_VERSION 1
+
+enum txn_op_type {
+	TXN_OP_SET = 1,
+	TXN_OP_DELETE = 2,
+	TXN_OP_GROUP_DELETE = 3,
+};
+
+struct txn_journal_hdr {
+	/* CRC32 of the operations following the header. */
+	uint32_t crc;
+	uint16_t len;
+	uint16_t version;
+};
+
+/* Followed by len bytes of the value for TXN_OP_SET. */
+struct txn_op {
+	uint8_t type;
+	uint8_t reserved;
+	uint16_t group;
+	uint16_t key;
+	uint16_t len;
+};
+
+static K_MUTEX_DEFINE(txn_mutex);
+/* Journal of the open transaction, the header is filled by the commit. */
+static uint8_t txn_buf[TXN_BUF_SIZE];
+static uint32_t txn_used;
+static k_tid_t txn_owner;
+static bool txn_open;
+static const struct sid_storage_txn_backend *txn_backend;
+
+BUILD_ASSERT(TXN_BUF_SIZE > sizeof(struct txn_journal_hdr) + sizeof(struct txn_op),
+	     "Sidewalk storage journal too small");
+
+/* Has to be called with the mutex held. */
+static bool txn_is_owner(void)
+{
+	return txn_open && txn_owner == k_current_get();
+}
+
+/* Has to be called with the mutex held. */
+static sid_error_t txn_stage(enum txn_op_type type, uint16_t group, uint16_t key, const void *data,
+			     uint32_t len)
+{
+	struct txn_op op = { .type = type, .group = group, .key = key, .len = len };
+
+	if (len > UINT16_MAX || txn_used + sizeof(op) + len > sizeof(txn_buf)) {
+		LOG_ERR("Journal full, record %04x/%04x not staged", group, key);
+		return SID_ERROR_BUFFER_OVERFLOW;
+	}
+
+	memcpy(&txn_buf[txn_used], &op, sizeof(op));
+	txn_used += sizeof(op);
+	if (len) {
+		memcpy(&txn_buf[txn_used], data, len);
+		txn_used += len;
+	}
+	return SID_ERROR_NONE;
+}
+
+static int txn_apply(const uint8_t *ops, uint32_t len)
+{
+	uint32_t offset = 0;
+	struct txn_op op;
+	int err = 0;
+
+	while (offset < len && !err) {
+		if (offset + sizeof(op) > len) {
+			return -EINVAL;
+		}
+		memcpy(&op, &ops[offset], sizeof(op));
+		offset += sizeof(op);
+
+		switch (op.type) {
+		case TXN_OP_SET:
+			if (offset + op.len > len) {
+				return -EINVAL;
+			}
+			err = txn_backend->write(op.group, op.key, &ops[offset], op.len);
+			offset += op.len;
+			break;
+		case TXN_OP_DELETE:
+			err = txn_backend->erase(op.group, op.key);
+			break;
+		case TXN_OP_GROUP_DELETE:
+			err = txn_backend->group_erase(op.group);
+			break;
+		default:
+			return -EINVAL;
+		}
+	}
+	return err;
+}
+
+/* Has to be called with the mutex held. The journal starts with room for the header. */
+static sid_error_t txn_journal_run(uint8_t *journal, uint32_t len)
+{
+	struct txn_journal_hdr hdr = { .len = len - sizeof(hdr), .version = TXN_JOURNAL_VERSION };
+	int err;
+
+	hdr.crc = crc32_ieee(&journal[sizeof(hdr)], hdr.len);
+	memcpy(journal, &hdr, sizeof(hdr));
+
+	/* A single record, so the journal is stored entirely or not at all. */
+	err = txn_backend->write(SID_STORAGE_TXN_JOURNAL_GROUP, SID_STORAGE_TXN_JOURNAL_KEY, journal,
+				 len);
+	if (err) {
+		LOG_ERR("Failed to write journal (err %d)", err);
+		return SID_ERROR_STORAGE_WRITE_FAIL;
+	}
+
+	err = txn_apply(&journal[sizeof(hdr)], hdr.len);
+	if (err) {
+		/* The journal stays stored, the next init applies it again. */
+		LOG_ERR("Failed to apply journal (err %d)", err);
+		return SID_ERROR_GENERIC;
+	}
+
+	err = txn_backend->erase(SID_STORAGE_TXN_JOURNAL_GROUP, SID_STORAGE_TXN_JOURNAL_KEY);
+	if (err) {
+		LOG_ERR("Failed to delete journal (err %d)", err);
+		return SID_ERROR_STORAGE_ERASE_FAIL;
+	}
+
+	err = txn_backend->commit();
+	if (err) {
+		LOG_ERR("Failed to commit journal (err %d)", err);
+		return SID_ERROR_GENERIC;
+	}
+	return SID_ERROR_NONE;
+}
+
+/* Has to be called with the mutex held. */
+static sid_error_t txn_journal_replay(void)
+{
+	struct txn_journal_hdr hdr;
+	int len;
+	int err;
+
+	len = txn_backend->read(SID_STORAGE_TXN_JOURNAL_GROUP, SID_STORAGE_TXN_JOURNAL_KEY, txn_buf,
+				sizeof(txn_buf));
+	if (len <= 0) {
+		return SID_ERROR_NONE;
+	}
+
+	memcpy(&hdr, txn_buf, MIN(sizeof(hdr), (size_t)len));
+	if ((size_t)len < sizeof(hdr) || hdr.version != TXN_JOURNAL_VERSION ||
+	    hdr.len != len - sizeof(hdr) || hdr.crc != crc32_ieee(&txn_buf[sizeof(hdr)], hdr.len)) {
+		LOG_ERR("Invalid journal dropped");
+	} else {
+		LOG_WRN("Applying journal of an interrupted transaction");
+		err = txn_apply(&txn_buf[sizeof(hdr)], hdr.len);
+		if (err) {
+			LOG_ERR("Failed to apply journal (err %d)", err);
+			return SID_ERROR_STORAGE_WRITE_FAIL;
+		}
+	}
+
+	err = txn_backend->erase(SID_STORAGE_TXN_JOURNAL_GROUP, SID_STORAGE_TXN_JOURNAL_KEY);
+	if (err == 0) {
+		err = txn_backend->commit();
+	}
+	return err ? SID_ERROR_STORAGE_ERASE_FAIL : SID_ERROR_NONE;
+}
+
+sid_error_t sid_storage_txn_init(const struct sid_storage_txn_backend *backend)
+{
+	sid_error_t erc;
+
+	k_mutex_lock(&txn_mutex, K_FOREVER);
+	txn_backend = backend;
+	txn_open = false;
+	erc = txn_journal_replay();
+	k_mutex_unlock(&txn_mutex);
+
+	return erc;
+}
+
+sid_error_t sid_pal_storage_kv_txn_begin(void)
+{
+	sid_error_t erc = SID_ERROR_NONE;
+
+	k_mutex_lock(&txn_mutex, K_FOREVER);
+	if (!txn_backend) {
+		erc = SID_ERROR_UNINITIALIZED;
+	} else if (txn_open) {
+		erc = SID_ERROR_BUSY;
+	} else {
+		txn_open = true;
+		txn_owner = k_current_get();
+		txn_used = sizeof(struct txn_journal_hdr);
+	}
+	k_mutex_unlock(&txn_mutex);
+
+	return erc;
+}
+
+sid_error_t sid_pal_storage_kv_txn_commit(void)
+{
+	sid_error_t erc = SID_ERROR_NONE;
+
+	k_mutex_lock(&txn_mutex, K_FOREVER);
+	if (!txn_is_owner()) {
+		k_mutex_unlock(&txn_mutex);
+		return SID_ERROR_INVALID_STATE;
+	}
+
+	if (txn_used > sizeof(struct txn_journal_hdr)) {
+		erc = txn_journal_run(txn_buf, txn_used);
+	}
+	txn_open = false;
+	k_mutex_unlock(&txn_mutex);
+
+	return erc;
+}
+
+sid_error_t sid_pal_storage_kv_txn_abort(void)
+{
+	sid_error_t erc = SID_ERROR_NONE;
+
+	k_mutex_lock(&txn_mutex, K_FOREVER);
+	if (txn_is_owner()) {
+		txn_open = false;
+	} else {
+		erc = SID_ERROR_INVALID_STATE;
+	}
+	k_mutex_unlock(&txn_mutex);
+
+	return erc;
+}
+
+sid_error_t sid_storage_txn_set(uint16_t group, uint16_t key, const void *data, uint32_t len)
+{
+	sid_error_t erc = SID_ERROR_NOSUPPORT;
+
+	k_mutex_lock(&txn_mutex, K_FOREVER);
+	if (txn_is_owner()) {
+		erc = txn_stage(TXN_OP_SET, group, key, data, len);
+	}
+	k_mutex_unlock(&txn_mutex);
+
+	return erc;
+}
+
+sid_error_t sid_storage_txn_delete(uint16_t group, uint16_t key)
+{
+	sid_error_t erc = SID_ERROR_NOSUPPORT;
+
+	k_mutex_lock(&txn_mutex, K_FOREVER);
+	if (txn_is_owner()) {
+		erc = txn_stage(TXN_OP_DELETE, group, key, NULL, 0);
+	}
+	k_mutex_unlock(&txn_mutex);
+
+	return erc;
+}
+
+/* Has to be called with the mutex held. */
+static sid_error_t txn_group_delete(uint16_t group)
+{
+	uint8_t batch[sizeof(struct txn_journal_hdr) + sizeof(struct txn_op)];
+	struct txn_op op = { .type = TXN_OP_GROUP_DELETE, .group = group };
+	int records;
+	int err;
+
+	records = txn_backend->group_records(group);
+	if (records < 0) {
+		LOG_ERR("Failed to count records of group %04x (err %d)", group, records);
+		return SID_ERROR_STORAGE_READ_FAIL;
+	}
+
+	/* Deleting at most one record is atomic, the journal would only add two writes. */
+	if (records <= 1) {
+		err = txn_backend->group_erase(group);
+		if (err) {
+			return SID_ERROR_STORAGE_ERASE_FAIL;
+		}
+		err = txn_backend->commit();
+		if (err) {
+			LOG_ERR("Failed to commit group delete (err %d)", err);
+			return SID_ERROR_GENERIC;
+		}
+		return SID_ERROR_NONE;
+	}
+
+	memcpy(&batch[sizeof(struct txn_journal_hdr)], &op, sizeof(op));
+	return txn_journal_run(batch, sizeof(batch));
+}
+
+sid_error_t sid_storage_txn_group_delete(uint16_t group)
+{
+	sid_error_t erc;
+
+	k_mutex_lock(&txn_mutex, K_FOREVER);
+	if (!txn_backend) {
+		erc = SID_ERROR_UNINITIALIZED;
+	} else if (txn_is_owner()) {
+		erc = txn_stage(TXN_OP_GROUP_DELETE, group, 0, NULL, 0);
+	} else {
+		erc = txn_group_delete(group);
+	}
+	k_mutex_unlock(&txn_mutex);
+
+	return erc;
+}
+
+bool sid_storage_txn_get(uint16_t group, uint16_t key, void *data, uint32_t len,
+			 uint32_t *stored_len, sid_error_t *erc)
+{
+	const uint8_t *value = NULL;
+	bool changed = false;
+	struct txn_op op;
+	struct txn_op last = { 0 };
+
+	k_mutex_lock(&txn_mutex, K_FOREVER);
+	if (!txn_is_owner()) {
+		k_mutex_unlock(&txn_mutex);
+		return false;
+	}
+
+	/* The last operation on the record wins. */
+	for (uint32_t offset = sizeof(struct txn_journal_hdr); offset < txn_used;) {
+		memcpy(&op, &txn_buf[offset], sizeof(op));
+		offset += sizeof(op);
+		if (op.group == group && (op.type == TXN_OP_GROUP_DELETE || op.key == key)) {
+			last = op;
+			value = &txn_buf[offset];
+			changed = true;
+		}
+		if (op.type == TXN_OP_SET) {
+			offset += op.len;
+		}
+	}
+
+	if (changed) {
+		if (last.type == TXN_OP_SET) {
+			if (data) {
+				memcpy(data, value, MIN(len, last.len));
+			}
+			if (stored_len) {
+				*stored_len = last.len;
+			}
+			*erc = SID_ERROR_NONE;
+		} else {
+			*erc = SID_ERROR_NOT_FOUND;
+		}
+	}
+	k_mutex_unlock(&txn_mutex);
+
+	return changed;
+}
@@ -11,6 +11,10 @@
 #include <sid_pal_swi_ifc.h>
 #include <zephyr/kernel.h>
 
+#ifdef CONFIG_SIDEWALK_SWI_SERVICE
+#include <sid_swi_service.h>
+#endif /* CONFIG_SIDEWALK_SWI_SERVICE */
+
 #ifndef CONFIG_SIDEWALK_SWI_PRIORITY
 #error "CONFIG_SIDEWALK_SWI_PRIORITY must be defined"
 #endif
@@ -19,16 +23,39 @@
 #error "CONFIG_SIDEWALK_SWI_STACK_SIZE must be defined"
 #endif
 
-static K_SEM_DEFINE(swi_trigger_sem, 0, 1);
-
 static sid_pal_swi_cb_t swi_cb;
 static bool is_init = false;
 
+#ifdef CONFIG_SIDEWALK_SWI_SERVICE
+static uint8_t swi_channel;
+
+static void swi_channel_handler(void *arg)
+{
+	ARG_UNUSED(arg);
+
+	sid_pal_swi_cb_t cb = swi_cb;
+
+	if (cb) {
+		cb();
+	}
+}
+#else
+static K_SEM_DEFINE(swi_trigger_sem, 0, 1);
+#endif /* CONFIG_SIDEWALK_SWI_SERVICE */
+
 sid_error_t sid_pal_swi_init(void)
 {
 	if (is_init) {
 		return SID_ERROR_NONE;
 	}
+#ifdef CONFIG_SIDEWALK_SWI_SERVICE
+	sid_error_t ret = sid_swi_service_register(swi_channel_handler, NULL,
+						   CONFIG_SIDEWALK_SWI_SERVICE_STACK_PRIORITY,
+						   &swi_channel);
+	if (ret != SID_ERROR_NONE) {
+		return ret;
+	}
+#endif /* CONFIG_SIDEWALK_SWI_SERVICE */
 	is_init = true;
 	return SID_ERROR_NONE;
 }
@@ -39,6 +66,9 @@ sid_error_t sid_pal_swi_deinit(void)
 		return SID_ERROR_NONE;
 	}
 	sid_pal_swi_stop();
+#ifdef CONFIG_SIDEWALK_SWI_SERVICE
+	(void)sid_swi_service_unregister(swi_channel);
+#endif /* CONFIG_SIDEWALK_SWI_SERVICE */
 	is_init = false;
 	return SID_ERROR_NONE;
 }
@@ -65,10 +95,15 @@ sid_error_t sid_pal_swi_trigger(void)
 		return SID_ERROR_INVALID_STATE;
 	}
 
+#ifdef CONFIG_SIDEWALK_SWI_SERVICE
+	return sid_swi_service_trigger(swi_channel);
+#else
 	k_sem_give(&swi_trigger_sem);
 	return SID_ERROR_NONE;
+#endif /* CONFIG_SIDEWALK_SWI_SERVICE */
 }
 
+#ifndef CONFIG_SIDEWALK_SWI_SERVICE
 static void swi_task(void *arg1, void *arg2, void *arg3)
 {
 	ARG_UNUSED(arg1);
@@ -85,3 +120,4 @@ static void swi_task(void *arg1, void *arg2, void *arg3)
 
 K_THREAD_DEFINE(swi_thread, CONFIG_SIDEWALK_SWI_STACK_SIZE, swi_task, NULL, NULL, NULL,
 		K_PRIO_COOP(CONFIG_SIDEWALK_SWI_PRIORITY), 0, 0);
+#endif /* CONFIG_SIDEWALK_SWI_SERVICE */
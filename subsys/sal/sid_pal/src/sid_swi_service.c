@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_swi_service.c
+ *  @brief Sidewalk multi-channel software interrupt service.
+ */
+
+#include <sid_swi_service.h>
+#include <sid_critical_region_lock.h>
+
+#include <zephyr/kernel.h>
+#include <string.h>
+
+#ifndef CONFIG_SIDEWALK_SWI_PRIORITY
+#error "CONFIG_SIDEWALK_SWI_PRIORITY must be defined"
+#endif
+
+#ifndef CONFIG_SIDEWALK_SWI_STACK_SIZE
+#error "CONFIG_SIDEWALK_SWI_STACK_SIZE must be defined"
+#endif
+
+#define SWI_CHANNELS CONFIG_SIDEWALK_SWI_CHANNELS
+
+BUILD_ASSERT(SWI_CHANNELS <= 32, "The pending bits of all channels have to fit in 32 bits");
+
+struct swi_channel {
+	sid_swi_service_cb_t callback;
+	void *arg;
+	uint8_t priority;
+	/* Cycle counter at the trigger which made the channel pending. */
+	uint32_t trigger_cycles;
+	struct sid_swi_channel_stats stats;
+};
+
+SID_REGION_LOCK_DEFINE(swi_lock);
+static K_SEM_DEFINE(swi_trigger_sem, 0, 1);
+
+static struct swi_channel channels[SWI_CHANNELS];
+/* Registered channels sorted by priority, the same priorities in the registration order. */
+static uint8_t order[SWI_CHANNELS];
+static uint8_t order_num;
+static uint32_t pending;
+
+static bool channel_valid(uint8_t channel)
+{
+	return channel < SWI_CHANNELS && channels[channel].callback;
+}
+
+/* Has to be called with the lock held. */
+static void order_insert(uint8_t channel)
+{
+	uint8_t pos = order_num;
+
+	for (; pos > 0 && channels[order[pos - 1]].priority > channels[channel].priority; pos--) {
+		order[pos] = order[pos - 1];
+	}
+	order[pos] = channel;
+	order_num++;
+}
+
+/* Has to be called with the lock held. */
+static void order_remove(uint8_t channel)
+{
+	uint8_t pos = 0;
+
+	while (order[pos] != channel) {
+		pos++;
+	}
+	order_num--;
+	memmove(&order[pos], &order[pos + 1], (order_num - pos) * sizeof(order[0]));
+}
+
+sid_error_t sid_swi_service_register(sid_swi_service_cb_t callback, void *arg, uint8_t priority,
+				     uint8_t *channel)
+{
+	sid_error_t ret = SID_ERROR_OOM;
+
+	if (!callback || !channel) {
+		return SID_ERROR_NULL_POINTER;
+	}
+
+	SID_REGION_LOCKED(&swi_lock)
+	{
+		for (uint8_t i = 0; i < SWI_CHANNELS; i++) {
+			if (channels[i].callback) {
+				continue;
+			}
+			channels[i] = (struct swi_channel){
+				.callback = callback,
+				.arg = arg,
+				.priority = priority,
+			};
+			order_insert(i);
+			*channel = i;
+			ret = SID_ERROR_NONE;
+			break;
+		}
+	}
+
+	return ret;
+}
+
+sid_error_t sid_swi_service_unregister(uint8_t channel)
+{
+	sid_error_t ret = SID_ERROR_INVALID_ARGS;
+
+	SID_REGION_LOCKED(&swi_lock)
+	{
+		if (channel_valid(channel)) {
+			order_remove(channel);
+			pending &= ~BIT(channel);
+			channels[channel].callback = NULL;
+			ret = SID_ERROR_NONE;
+		}
+	}
+
+	return ret;
+}
+
+sid_error_t sid_swi_service_trigger(uint8_t channel)
+{
+	sid_error_t ret = SID_ERROR_INVALID_ARGS;
+
+	SID_REGION_LOCKED(&swi_lock)
+	{
+		if (channel_valid(channel)) {
+			channels[channel].stats.triggers++;
+			if (pending & BIT(channel)) {
+				channels[channel].stats.coalesced++;
+			} else {
+				pending |= BIT(channel);
+				channels[channel].trigger_cycles = k_cycle_get_32();
+			}
+			ret = SID_ERROR_NONE;
+		}
+	}
+
+	if (ret == SID_ERROR_NONE) {
+		k_sem_give(&swi_trigger_sem);
+	}
+	return ret;
+}
+
+sid_error_t sid_swi_service_stats_get(uint8_t channel, struct sid_swi_channel_stats *stats)
+{
+	sid_error_t ret = SID_ERROR_INVALID_ARGS;
+
+	if (!stats) {
+		return SID_ERROR_NULL_POINTER;
+	}
+
+	SID_REGION_LOCKED(&swi_lock)
+	{
+		if (channel_valid(channel)) {
+			*stats = channels[channel].stats;
+			ret = SID_ERROR_NONE;
+		}
+	}
+
+	return ret;
+}
+
+void sid_swi_service_stats_reset(void)
+{
+	SID_REGION_LOCKED(&swi_lock)
+	{
+		for (uint8_t i = 0; i < SWI_CHANNELS; i++) {
+			memset(&channels[i].stats, 0, sizeof(channels[i].stats));
+		}
+	}
+}
+
+/*
+ * Take the pending channel with the highest priority.
+ * The channel is not pending anymore when its callback runs, so it can be triggered again.
+ */
+static bool swi_next(sid_swi_service_cb_t *callback, void **arg)
+{
+	bool found = false;
+
+	SID_REGION_LOCKED(&swi_lock)
+	{
+		for (uint8_t pos = 0; pos < order_num; pos++) {
+			struct swi_channel *ch = &channels[order[pos]];
+			uint32_t latency_us;
+
+			if (!(pending & BIT(order[pos]))) {
+				continue;
+			}
+
+			pending &= ~BIT(order[pos]);
+			latency_us = k_cyc_to_us_floor32(k_cycle_get_32() - ch->trigger_cycles);
+			ch->stats.runs++;
+			ch->stats.latency_sum_us += latency_us;
+			ch->stats.latency_max_us = MAX(ch->stats.latency_max_us, latency_us);
+
+			*callback = ch->callback;
+			*arg = ch->arg;
+			found = true;
+			break;
+		}
+	}
+
+	return found;
+}
+
+static void swi_task(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	sid_swi_service_cb_t callback;
+	void *arg;
+
+	while (1) {
+		k_sem_take(&swi_trigger_sem, K_FOREVER);
+		/* Every callback can trigger a channel with a higher priority, so select again. */
+		while (swi_next(&callback, &arg)) {
+			callback(arg);
+		}
+	}
+}
+
+K_THREAD_DEFINE(swi_service_thread, CONFIG_SIDEWALK_SWI_STACK_SIZE, swi_task, NULL, NULL, NULL,
+		K_PRIO_COOP(CONFIG_SIDEWALK_SWI_PRIORITY), 0, 0);
@@ -13,9 +13,23 @@
 #include <sid_pal_assert_ifc.h>
 #include <sid_pal_critical_region_ifc.h>
 #include <sid_time_ops.h>
+#include <sid_timer_queue.h>
 #include <stdint.h>
+#include <string.h>
 #include <zephyr/kernel.h>
 
+#ifdef CONFIG_SIDEWALK_TIMER_STATS
+#include <sid_timer_stats.h>
+#endif /* CONFIG_SIDEWALK_TIMER_STATS */
+
+#ifdef CONFIG_SIDEWALK_TIMER_COALESCING
+#include <sid_timer_coalescing.h>
+#endif /* CONFIG_SIDEWALK_TIMER_COALESCING */
+
+#ifdef CONFIG_SIDEWALK_TIMER_REGION_LOCK
+#include <sid_critical_region_lock.h>
+#endif /* CONFIG_SIDEWALK_TIMER_REGION_LOCK */
+
 #ifdef CONFIG_SIDEWALK_THREAD_TIMER
 #ifndef CONFIG_SIDEWALK_TIMER_PRIORITY
 #error "CONFIG_SIDEWALK_TIMER_PRIORITY must be defined"
@@ -28,18 +42,380 @@
 static K_SEM_DEFINE(timer_trigger_sem, 0, 1);
 #endif /* CONFIG_SIDEWALK_THREAD_TIMER */
 
-struct sid_pal_timer_ctx {
-	sys_dlist_t list;
-};
+#define TIMER_PRIO_CLASS_NUM (SID_PAL_TIMER_PRIO_CLASS_LOWPOWER + 1)
+
+#ifdef CONFIG_SIDEWALK_TIMER_REGION_LOCK
+SID_REGION_LOCK_DEFINE(timer_lock);
+static sid_region_key_t timer_lock_key;
+#endif /* CONFIG_SIDEWALK_TIMER_REGION_LOCK */
+
+/*
+ * Timer data is protected by the global critical region or by the timer lock.
+ * Neither is held while a timer callback runs.
+ */
+static inline void timer_lock_enter(void)
+{
+#ifdef CONFIG_SIDEWALK_TIMER_REGION_LOCK
+	const sid_region_key_t key = sid_region_lock(&timer_lock);
+
+	timer_lock_key = key;
+#else
+	sid_pal_enter_critical_region();
+#endif /* CONFIG_SIDEWALK_TIMER_REGION_LOCK */
+}
+
+static inline void timer_lock_exit(void)
+{
+#ifdef CONFIG_SIDEWALK_TIMER_REGION_LOCK
+	sid_region_unlock(&timer_lock, timer_lock_key);
+#else
+	sid_pal_exit_critical_region();
+#endif /* CONFIG_SIDEWALK_TIMER_REGION_LOCK */
+}
 
 static const struct sid_timespec tolerance_lowpower = { .tv_sec = 1, .tv_nsec = 0 };
 static const struct sid_timespec tolerance_precise = { .tv_sec = 0, .tv_nsec = 0 };
 
-static struct sid_pal_timer_ctx sid_pal_timer_ctx = {
-	.list = SYS_DLIST_STATIC_INIT(&sid_pal_timer_ctx.list),
+static void sid_timer_start(const sid_timer_queue_time_t *wakeup);
+static void timer_queue_insert(sid_pal_timer_t *timer);
+
+static inline sid_pal_timer_prio_class_t timer_prio_class(const sid_pal_timer_t *timer)
+{
+	return sid_time_is_zero(timer->tolerance) ? SID_PAL_TIMER_PRIO_CLASS_PRECISE :
+						    SID_PAL_TIMER_PRIO_CLASS_LOWPOWER;
+}
+
+/*
+ * Seconds are converted exactly, so only the sub-second part is rounded
+ * and the 64-bit nanosecond conversion can not overflow.
+ * Alarms are rounded up, so a timer never expires before its alarm.
+ */
+static inline void timer_queue_time_ceil(sid_timer_queue_time_t *result,
+					 const struct sid_timespec *time)
+{
+#ifdef CONFIG_SIDEWALK_TIMER_TICKS
+	*result = sid_time_is_infinity(time) ?
+			  SID_TIMER_QUEUE_TIME_INFINITY :
+			  ((uint64_t)time->tv_sec * CONFIG_SYS_CLOCK_TICKS_PER_SEC +
+			   k_ns_to_ticks_ceil64(time->tv_nsec));
+#else
+	*result = *time;
+#endif /* CONFIG_SIDEWALK_TIMER_TICKS */
+}
+
+/* Current time and tolerances are rounded down, for the same reason. */
+static inline void timer_queue_time_floor(sid_timer_queue_time_t *result,
+					  const struct sid_timespec *time)
+{
+#ifdef CONFIG_SIDEWALK_TIMER_TICKS
+	*result = (uint64_t)time->tv_sec * CONFIG_SYS_CLOCK_TICKS_PER_SEC +
+		  k_ns_to_ticks_floor64(time->tv_nsec);
+#else
+	*result = *time;
+#endif /* CONFIG_SIDEWALK_TIMER_TICKS */
+}
+
+#ifdef CONFIG_SIDEWALK_TIMER_TICKS
+/*
+ * sid_pal_timer_t is allocated by the Sidewalk libraries and has no room for
+ * the converted alarm, so recent conversions are kept in a table indexed by
+ * the timer address. An entry is valid for any timer with the same alarm,
+ * the zeroed table holds the conversion of the zero alarm.
+ */
+#define TIMER_TICKS_CACHE_SIZE CONFIG_SIDEWALK_TIMER_TICKS_CACHE_SIZE
+
+struct timer_ticks_entry {
+	struct sid_timespec alarm;
+	sid_timer_queue_time_t ticks;
 };
 
-static void sid_timer_start(const struct sid_timespec *sid_time);
+static struct timer_ticks_entry timer_ticks_cache[TIMER_TICKS_CACHE_SIZE];
+
+sid_timer_queue_time_t sid_timer_queue_alarm(const sid_pal_timer_t *timer)
+{
+	struct timer_ticks_entry *entry =
+		&timer_ticks_cache[((uintptr_t)timer / sizeof(void *)) % TIMER_TICKS_CACHE_SIZE];
+
+	if (entry->alarm.tv_sec != timer->alarm.tv_sec ||
+	    entry->alarm.tv_nsec != timer->alarm.tv_nsec) {
+		entry->alarm = timer->alarm;
+		timer_queue_time_ceil(&entry->ticks, &timer->alarm);
+	}
+
+	return entry->ticks;
+}
+
+sid_timer_queue_time_t sid_timer_queue_tolerance(const sid_pal_timer_t *timer)
+{
+	sid_timer_queue_time_t tolerance;
+
+	timer_queue_time_floor(&tolerance, timer->tolerance);
+	return tolerance;
+}
+#endif /* CONFIG_SIDEWALK_TIMER_TICKS */
+
+#ifdef CONFIG_SIDEWALK_TIMER_COALESCING
+/* Wakeup currently set in the hardware timer. */
+static sid_timer_queue_time_t wakeup_deadline = SID_TIMER_QUEUE_TIME_INFINITY;
+static uint32_t wakeups_avoided;
+
+uint32_t sid_timer_coalescing_wakeups_avoided(void)
+{
+	return wakeups_avoided;
+}
+
+void sid_timer_coalescing_reset(void)
+{
+	timer_lock_enter();
+	wakeups_avoided = 0;
+	timer_lock_exit();
+}
+#endif /* CONFIG_SIDEWALK_TIMER_COALESCING */
+
+struct timer_coalescing_sample {
+	uint32_t fired;
+	uint32_t alarms;
+	struct sid_timespec last_alarm;
+};
+
+/* Has to be called in the critical region, for fired timers in the alarm order. */
+static inline void timer_coalescing_fire(struct timer_coalescing_sample *sample,
+					 const struct sid_timespec *alarm)
+{
+#ifdef CONFIG_SIDEWALK_TIMER_COALESCING
+	if (!sample->fired || sid_time_gt(alarm, &sample->last_alarm)) {
+		sample->alarms++;
+		sample->last_alarm = *alarm;
+	}
+	sample->fired++;
+#endif /* CONFIG_SIDEWALK_TIMER_COALESCING */
+}
+
+/* Has to be called in the critical region. */
+static inline void timer_coalescing_event_end(const struct timer_coalescing_sample *sample)
+{
+#ifdef CONFIG_SIDEWALK_TIMER_COALESCING
+	/* A wakeup which fired a single timer did not avoid any other wakeup. */
+	if (sample->fired > 1) {
+		wakeups_avoided += sample->alarms - 1;
+	}
+#endif /* CONFIG_SIDEWALK_TIMER_COALESCING */
+}
+
+struct timer_stats_sample {
+	sid_pal_timer_prio_class_t prio_class;
+	uint32_t lateness_us;
+	uint32_t callback_cycles;
+};
+
+#ifdef CONFIG_SIDEWALK_TIMER_STATS
+static struct sid_timer_stats timer_stats;
+
+static void timer_stats_hist_add(struct sid_timer_stats_hist *hist, uint32_t value_us)
+{
+	hist->buckets[sid_timer_stats_bucket(value_us)]++;
+	hist->count++;
+	hist->sum_us += value_us;
+	hist->max_us = MAX(hist->max_us, value_us);
+}
+
+void sid_timer_stats_get(struct sid_timer_stats *stats)
+{
+	if (!stats) {
+		return;
+	}
+
+	timer_lock_enter();
+	*stats = timer_stats;
+	timer_lock_exit();
+}
+
+void sid_timer_stats_reset(void)
+{
+	timer_lock_enter();
+	memset(&timer_stats, 0, sizeof(timer_stats));
+	timer_lock_exit();
+}
+#endif /* CONFIG_SIDEWALK_TIMER_STATS */
+
+/* Has to be called right after the critical region has been entered. */
+static inline uint32_t timer_stats_lock_begin(void)
+{
+#ifdef CONFIG_SIDEWALK_TIMER_STATS
+	return k_cycle_get_32();
+#else
+	return 0;
+#endif /* CONFIG_SIDEWALK_TIMER_STATS */
+}
+
+/* Has to be called right before the critical region is exited. */
+static inline void timer_stats_lock_end(uint32_t lock_begin)
+{
+#ifdef CONFIG_SIDEWALK_TIMER_STATS
+	timer_stats_hist_add(&timer_stats.lock_hold,
+			     k_cyc_to_us_floor32(k_cycle_get_32() - lock_begin));
+#endif /* CONFIG_SIDEWALK_TIMER_STATS */
+}
+
+static inline void timer_stats_fire_begin(struct timer_stats_sample *sample,
+					  const sid_pal_timer_t *timer,
+					  const struct sid_timespec *alarm)
+{
+#ifdef CONFIG_SIDEWALK_TIMER_STATS
+	struct sid_timespec lateness;
+
+	sid_pal_uptime_now(&lateness);
+	sample->prio_class = timer_prio_class(timer);
+	sample->lateness_us = 0;
+	if (sid_time_gt(&lateness, alarm)) {
+		sid_time_sub(&lateness, alarm);
+		sample->lateness_us = (uint32_t)MIN((uint64_t)lateness.tv_sec * USEC_PER_SEC +
+							    lateness.tv_nsec / NSEC_PER_USEC,
+						    UINT32_MAX);
+	}
+	sample->callback_cycles = k_cycle_get_32();
+#endif /* CONFIG_SIDEWALK_TIMER_STATS */
+}
+
+static inline void timer_stats_fire_end(struct timer_stats_sample *sample)
+{
+#ifdef CONFIG_SIDEWALK_TIMER_STATS
+	sample->callback_cycles = k_cycle_get_32() - sample->callback_cycles;
+#endif /* CONFIG_SIDEWALK_TIMER_STATS */
+}
+
+/* Has to be called right before the last critical region of the event is exited. */
+static inline void timer_stats_event_end(uint32_t lock_begin)
+{
+#ifdef CONFIG_SIDEWALK_TIMER_STATS
+	timer_stats.events++;
+#endif /* CONFIG_SIDEWALK_TIMER_STATS */
+	timer_stats_lock_end(lock_begin);
+}
+
+/* Has to be called in the critical region. */
+static inline void timer_stats_fire_commit(const struct timer_stats_sample *sample)
+{
+#ifdef CONFIG_SIDEWALK_TIMER_STATS
+	timer_stats_hist_add(&timer_stats.lateness[sample->prio_class], sample->lateness_us);
+	timer_stats_hist_add(&timer_stats.callback, k_cyc_to_us_floor32(sample->callback_cycles));
+#endif /* CONFIG_SIDEWALK_TIMER_STATS */
+}
+
+/*
+ * Has to be called in the critical region, the callback runs outside of it.
+ * Returns in a new critical region started at @p lock_begin.
+ */
+static void sid_timer_fire(sid_pal_timer_t *timer, const struct sid_timespec *alarm,
+			   uint32_t *lock_begin)
+{
+	struct timer_stats_sample sample;
+
+	timer_stats_fire_begin(&sample, timer, alarm);
+	timer_stats_lock_end(*lock_begin);
+	timer_lock_exit();
+
+	if (timer->callback) {
+		timer->callback(timer->callback_arg, timer);
+	}
+	timer_stats_fire_end(&sample);
+
+	timer_lock_enter();
+	*lock_begin = timer_stats_lock_begin();
+	timer_stats_fire_commit(&sample);
+}
+
+#ifdef CONFIG_SIDEWALK_TIMER_WORKQ
+K_THREAD_STACK_DEFINE(timer_workq_precise_stack, CONFIG_SIDEWALK_TIMER_WORKQ_PRECISE_STACK_SIZE);
+K_THREAD_STACK_DEFINE(timer_workq_lowpower_stack, CONFIG_SIDEWALK_TIMER_WORKQ_LOWPOWER_STACK_SIZE);
+
+/* Expired timers waiting for the callback, one work queue per priority class. */
+struct timer_dispatch {
+	struct k_work_q queue;
+	struct k_work work;
+	sys_dlist_t pending;
+};
+
+static struct timer_dispatch timer_dispatch[TIMER_PRIO_CLASS_NUM];
+
+static void timer_dispatch_work(struct k_work *work)
+{
+	struct timer_dispatch *dispatch = CONTAINER_OF(work, struct timer_dispatch, work);
+	sys_dnode_t *node;
+	uint32_t lock_begin;
+
+	/*
+	 * A timer canceled before its callback started is removed from the pending list.
+	 * A periodic timer is re-armed here, so it is never pending twice.
+	 */
+	timer_lock_enter();
+	lock_begin = timer_stats_lock_begin();
+	while ((node = sys_dlist_get(&dispatch->pending))) {
+		sid_pal_timer_t *timer = CONTAINER_OF(node, sid_pal_timer_t, node);
+		const struct sid_timespec alarm = timer->alarm;
+
+		if (!sid_time_is_infinity(&timer->period)) {
+			sid_time_add(&timer->alarm, &timer->period);
+			timer_queue_insert(timer);
+		}
+		sid_timer_fire(timer, &alarm, &lock_begin);
+	}
+	timer_stats_lock_end(lock_begin);
+	timer_lock_exit();
+}
+
+static int timer_dispatch_init(void)
+{
+	static const struct {
+		k_thread_stack_t *stack;
+		size_t stack_size;
+		int prio;
+		const char *name;
+	} queues[TIMER_PRIO_CLASS_NUM] = {
+		[SID_PAL_TIMER_PRIO_CLASS_PRECISE] = {
+			.stack = timer_workq_precise_stack,
+			.stack_size = K_THREAD_STACK_SIZEOF(timer_workq_precise_stack),
+			.prio = K_PRIO_COOP(CONFIG_SIDEWALK_TIMER_WORKQ_PRECISE_PRIORITY),
+			.name = "sid_timer_precise",
+		},
+		[SID_PAL_TIMER_PRIO_CLASS_LOWPOWER] = {
+			.stack = timer_workq_lowpower_stack,
+			.stack_size = K_THREAD_STACK_SIZEOF(timer_workq_lowpower_stack),
+			.prio = K_PRIO_PREEMPT(CONFIG_SIDEWALK_TIMER_WORKQ_LOWPOWER_PRIORITY),
+			.name = "sid_timer_lowpower",
+		},
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(timer_dispatch); i++) {
+		const struct k_work_queue_config config = { .name = queues[i].name };
+
+		sys_dlist_init(&timer_dispatch[i].pending);
+		k_work_init(&timer_dispatch[i].work, timer_dispatch_work);
+		k_work_queue_init(&timer_dispatch[i].queue);
+		k_work_queue_start(&timer_dispatch[i].queue, queues[i].stack, queues[i].stack_size,
+				   queues[i].prio, &config);
+	}
+
+	return 0;
+}
+
+SYS_INIT(timer_dispatch_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_SIDEWALK_TIMER_WORKQ */
+
+/*
+ * Has to be called in the critical region, for expired timers in the alarm order.
+ * The timer node is free once the timer expired, so it links the pending list.
+ * The timer stays armed until its callback starts.
+ */
+static inline void timer_dispatch_add(sid_pal_timer_t *timer)
+{
+#ifdef CONFIG_SIDEWALK_TIMER_WORKQ
+	struct timer_dispatch *dispatch = &timer_dispatch[timer_prio_class(timer)];
+
+	sys_dlist_append(&dispatch->pending, &timer->node);
+	k_work_submit_to_queue(&dispatch->queue, &dispatch->work);
+#endif /* CONFIG_SIDEWALK_TIMER_WORKQ */
+}
 
 static const struct sid_timespec *sid_pal_timer_get_tolerance(sid_pal_timer_prio_class_t type)
 {
@@ -63,13 +439,11 @@ static const struct sid_timespec *sid_pal_timer_get_tolerance(sid_pal_timer_prio
 static bool sid_pal_timer_list_in_list(const sid_pal_timer_t *timer)
 {
 	SID_PAL_ASSERT(timer);
-	bool result = true;
+	bool result;
 
-	sid_pal_enter_critical_region();
-	if ((0 == timer->node.next) && (0 == timer->node.prev)) {
-		result = false;
-	}
-	sid_pal_exit_critical_region();
+	timer_lock_enter();
+	result = sid_timer_queue_is_queued(timer);
+	timer_lock_exit();
 
 	return result;
 }
@@ -78,76 +452,59 @@ static void sid_pal_timer_list_delete(sid_pal_timer_t *timer)
 {
 	SID_PAL_ASSERT(timer);
 
-	sid_pal_enter_critical_region();
-	if (!((0 == timer->node.next) && (0 == timer->node.prev))) {
-		sys_dlist_remove(&timer->node);
-	}
-	sid_pal_exit_critical_region();
-}
+	timer_lock_enter();
+#ifdef CONFIG_SIDEWALK_TIMER_COALESCING
+	if (sid_timer_queue_is_queued(timer)) {
+		sid_timer_queue_time_t latest;
 
-static void sid_pal_timer_list_insert(struct sid_pal_timer_ctx *ctx, sid_pal_timer_t *timer)
-{
-	SID_PAL_ASSERT(ctx && timer);
-	bool reschedule_required = true;
+		/* Only the timer with the earliest window end defines the deadline. */
+		sid_timer_queue_latest(timer, &latest);
+		sid_timer_queue_remove(timer);
+		if (!sid_timer_queue_time_gt(&latest, &wakeup_deadline)) {
+			sid_timer_queue_time_t deadline;
 
-	sid_pal_enter_critical_region();
-	sys_dnode_t *node = sys_dlist_peek_head(&ctx->list);
-
-	while (node) {
-		sid_pal_timer_t *element = CONTAINER_OF(node, __typeof__(*element), node);
-		if (sid_time_gt(&element->alarm, &timer->alarm)) {
-			struct sid_timespec diff = element->alarm;
-			sid_time_sub(&diff, &timer->alarm);
-			if (!sid_time_gt(&diff, timer->tolerance)) {
-				reschedule_required = false;
-				timer->alarm = element->alarm;
-			}
-			sys_dlist_append(&element->node, &timer->node);
-			break;
+			sid_timer_queue_deadline(&deadline);
+			sid_timer_start(&deadline);
 		}
-		reschedule_required = false;
-		node = sys_dlist_peek_next_no_check(&ctx->list, node);
 	}
-
-	if (!node) {
-		sys_dlist_append(&ctx->list, &timer->node);
-	}
-	if (reschedule_required) {
-		sid_timer_start(&timer->alarm);
-	}
-	sid_pal_exit_critical_region();
+#else
+	sid_timer_queue_remove(timer);
+#endif /* CONFIG_SIDEWALK_TIMER_COALESCING */
+	timer_lock_exit();
 }
 
-static void sid_pal_timer_list_fetch(struct sid_pal_timer_ctx *ctx,
-				     const struct sid_timespec *non_gt_than,
-				     sid_pal_timer_t **timer)
+/* Has to be called in the critical region. */
+static void timer_queue_insert(sid_pal_timer_t *timer)
 {
-	SID_PAL_ASSERT(ctx && non_gt_than && timer);
-	*timer = NULL;
+	const sid_pal_timer_t *head = sid_timer_queue_peek();
 
-	sid_pal_enter_critical_region();
-	sid_pal_timer_t *result = SYS_DLIST_PEEK_HEAD_CONTAINER(&ctx->list, result, node);
+	sid_timer_queue_insert(timer);
+#ifdef CONFIG_SIDEWALK_TIMER_COALESCING
+	ARG_UNUSED(head);
+	sid_timer_queue_time_t latest;
 
-	if (result && !sid_time_gt(&result->alarm, non_gt_than)) {
-		*timer = result;
-		sys_dlist_remove(&result->node);
+	/* The deadline is the earliest window end, so only a new earlier end can move it. */
+	sid_timer_queue_latest(timer, &latest);
+	if (sid_timer_queue_time_gt(&wakeup_deadline, &latest)) {
+		sid_timer_start(&latest);
 	}
-	sid_pal_exit_critical_region();
+#else
+	if ((sid_timer_queue_peek() == timer) &&
+	    (!head || sid_timer_queue_is_before(timer, head))) {
+		sid_timer_queue_time_t alarm = sid_timer_queue_alarm(timer);
+
+		sid_timer_start(&alarm);
+	}
+#endif /* CONFIG_SIDEWALK_TIMER_COALESCING */
 }
 
-static void sid_pal_timer_list_get_next_schedule(struct sid_pal_timer_ctx *ctx,
-						 struct sid_timespec *schedule)
+static void sid_pal_timer_list_insert(sid_pal_timer_t *timer)
 {
-	SID_PAL_ASSERT(ctx && schedule);
-	*schedule = SID_TIME_INFINITY;
-
-	sid_pal_enter_critical_region();
-	sid_pal_timer_t *result = SYS_DLIST_PEEK_HEAD_CONTAINER(&ctx->list, result, node);
+	SID_PAL_ASSERT(timer);
 
-	if (result) {
-		*schedule = result->alarm;
-	}
-	sid_pal_exit_critical_region();
+	timer_lock_enter();
+	timer_queue_insert(timer);
+	timer_lock_exit();
 }
 
 sid_error_t sid_pal_timer_init(sid_pal_timer_t *timer_storage, sid_pal_timer_cb_t event_callback,
@@ -161,7 +518,7 @@ sid_error_t sid_pal_timer_init(sid_pal_timer_t *timer_storage, sid_pal_timer_cb_
 	timer_storage->callback_arg = event_callback_arg;
 	timer_storage->alarm = SID_TIME_INFINITY;
 	timer_storage->period = SID_TIME_INFINITY;
-	sys_dnode_init(&timer_storage->node);
+	sid_timer_queue_node_init(timer_storage);
 
 	return SID_ERROR_NONE;
 }
@@ -178,8 +535,10 @@ sid_error_t sid_pal_timer_deinit(sid_pal_timer_t *timer_storage)
 	return SID_ERROR_NONE;
 }
 
-sid_error_t sid_pal_timer_arm(sid_pal_timer_t *timer_storage, sid_pal_timer_prio_class_t type,
-			      const struct sid_timespec *when, const struct sid_timespec *period)
+static sid_error_t sid_pal_timer_arm_tolerance(sid_pal_timer_t *timer_storage,
+					       const struct sid_timespec *when,
+					       const struct sid_timespec *period,
+					       const struct sid_timespec *tolerance)
 {
 	if (!timer_storage || !when) {
 		return SID_ERROR_INVALID_ARGS;
@@ -194,11 +553,37 @@ sid_error_t sid_pal_timer_arm(sid_pal_timer_t *timer_storage, sid_pal_timer_prio
 
 	timer_storage->alarm = *when;
 	timer_storage->period = *period;
-	timer_storage->tolerance = sid_pal_timer_get_tolerance(type);
-	sid_pal_timer_list_insert(&sid_pal_timer_ctx, timer_storage);
+	timer_storage->tolerance = tolerance;
+	sid_pal_timer_list_insert(timer_storage);
 	return SID_ERROR_NONE;
 }
 
+sid_error_t sid_pal_timer_arm(sid_pal_timer_t *timer_storage, sid_pal_timer_prio_class_t type,
+			      const struct sid_timespec *when, const struct sid_timespec *period)
+{
+	return sid_pal_timer_arm_tolerance(timer_storage, when, period,
+					   sid_pal_timer_get_tolerance(type));
+}
+
+#ifdef CONFIG_SIDEWALK_TIMER_COALESCING
+sid_error_t sid_pal_timer_arm_with_tolerance(sid_pal_timer_t *timer_storage,
+					     const struct sid_timespec *when,
+					     const struct sid_timespec *period,
+					     const struct sid_timespec *tolerance)
+{
+	if (!timer_storage || !tolerance || tolerance->tv_nsec >= SID_TIME_NSEC_PER_SEC) {
+		return SID_ERROR_INVALID_ARGS;
+	}
+
+	if (sid_pal_timer_is_armed(timer_storage)) {
+		return SID_ERROR_INVALID_ARGS;
+	}
+
+	/* The timer keeps the pointer, sid_pal_timer_t has no room for a copy. */
+	return sid_pal_timer_arm_tolerance(timer_storage, when, period, tolerance);
+}
+#endif /* CONFIG_SIDEWALK_TIMER_COALESCING */
+
 sid_error_t sid_pal_timer_cancel(sid_pal_timer_t *timer_storage)
 {
 	if (!timer_storage) {
@@ -218,39 +603,88 @@ bool sid_pal_timer_is_armed(const sid_pal_timer_t *timer_storage)
 	return sid_pal_timer_list_in_list(timer_storage);
 }
 
-void sid_pal_timer_event_callback(void *arg, const struct sid_timespec *now)
+static void sid_timer_event_handle(const sid_timer_queue_time_t *now)
 {
-	ARG_UNUSED(arg);
 	sid_pal_timer_t *timer = NULL;
-
-	do {
-		sid_pal_timer_list_fetch(&sid_pal_timer_ctx, now, &timer);
-		if (!timer) {
-			break;
-		}
+	struct timer_coalescing_sample coalescing = { 0 };
+	uint32_t lock_begin;
+
+	/*
+	 * All due timers are detached at once. Every next expired timer is taken
+	 * (and re-armed when periodic) in the same critical region in which the previous
+	 * callback ended, so a timer canceled by an earlier callback does not fire.
+	 * The last critical region schedules the next wakeup.
+	 * With k expired timers (p periodic) this takes k + 1 critical regions,
+	 * instead of k + p + 2 needed when each step was locked separately.
+	 * With CONFIG_SIDEWALK_TIMER_WORKQ the callbacks are only queued here
+	 * and periodic timers are re-armed by the work queue, so every due timer
+	 * is handled in a single critical region.
+	 */
+	timer_lock_enter();
+	lock_begin = timer_stats_lock_begin();
+	sid_timer_queue_expire(now);
+	while ((timer = sid_timer_queue_pop_expired())) {
+		const struct sid_timespec alarm = timer->alarm;
+
+		timer_coalescing_fire(&coalescing, &alarm);
+#ifdef CONFIG_SIDEWALK_TIMER_WORKQ
+		timer_dispatch_add(timer);
+#else
 		if (!sid_time_is_infinity(&timer->period)) {
 			sid_time_add(&timer->alarm, &timer->period);
-
-			sid_pal_timer_list_insert(&sid_pal_timer_ctx, timer);
-		}
-		if (timer->callback) {
-			timer->callback(timer->callback_arg, (sid_pal_timer_t *)timer);
+			sid_timer_queue_insert(timer);
 		}
-	} while (1);
+		sid_timer_fire(timer, &alarm, &lock_begin);
+#endif /* CONFIG_SIDEWALK_TIMER_WORKQ */
+	}
 
-	struct sid_timespec next_schedule;
+	timer_coalescing_event_end(&coalescing);
+#ifdef CONFIG_SIDEWALK_TIMER_COALESCING
+	sid_timer_queue_time_t deadline;
 
-	sid_pal_timer_list_get_next_schedule(&sid_pal_timer_ctx, &next_schedule);
-	sid_timer_start(&next_schedule);
+	sid_timer_queue_deadline(&deadline);
+	sid_timer_start(&deadline);
+#else
+	sid_timer_queue_time_t wakeup = SID_TIMER_QUEUE_TIME_INFINITY;
+
+	timer = sid_timer_queue_peek();
+	if (timer) {
+		wakeup = sid_timer_queue_alarm(timer);
+	}
+	sid_timer_start(&wakeup);
+#endif /* CONFIG_SIDEWALK_TIMER_COALESCING */
+	timer_stats_event_end(lock_begin);
+	timer_lock_exit();
 }
 
-static void sid_timer_handler(struct k_timer *timer_data)
+void sid_pal_timer_event_callback(void *arg, const struct sid_timespec *now)
 {
-	ARG_UNUSED(timer_data);
-#ifndef CONFIG_SIDEWALK_THREAD_TIMER
+	ARG_UNUSED(arg);
+	sid_timer_queue_time_t queue_now;
+
+	timer_queue_time_floor(&queue_now, now);
+	sid_timer_event_handle(&queue_now);
+}
+
+static void sid_timer_event_now(void)
+{
+#ifdef CONFIG_SIDEWALK_TIMER_TICKS
+	/* The uptime is counted in kernel ticks, so no conversion is needed. */
+	sid_timer_queue_time_t now = (uint64_t)k_uptime_ticks();
+
+	sid_timer_event_handle(&now);
+#else
 	struct sid_timespec handle_time;
 	sid_pal_uptime_now(&handle_time);
 	sid_pal_timer_event_callback(NULL, &handle_time);
+#endif /* CONFIG_SIDEWALK_TIMER_TICKS */
+}
+
+static void sid_timer_handler(struct k_timer *timer_data)
+{
+	ARG_UNUSED(timer_data);
+#ifndef CONFIG_SIDEWALK_THREAD_TIMER
+	sid_timer_event_now();
 #else
 	k_sem_give(&timer_trigger_sem);
 #endif /* CONFIG_SIDEWALK_THREAD_TIMER */
@@ -258,14 +692,27 @@ static void sid_timer_handler(struct k_timer *timer_data)
 
 K_TIMER_DEFINE(sid_timer, sid_timer_handler, NULL);
 
-static void sid_timer_start(const struct sid_timespec *sid_time)
+static void sid_timer_start(const sid_timer_queue_time_t *wakeup)
 {
+#ifdef CONFIG_SIDEWALK_TIMER_COALESCING
+	wakeup_deadline = *wakeup;
+#endif /* CONFIG_SIDEWALK_TIMER_COALESCING */
+
+#ifdef CONFIG_SIDEWALK_TIMER_TICKS
+	if (*wakeup == SID_TIMER_QUEUE_TIME_INFINITY) {
+		k_timer_stop(&sid_timer);
+		return;
+	}
+	k_timer_start(&sid_timer, Z_TIMEOUT_TICKS(Z_TICK_ABS((k_ticks_t)*wakeup)), K_NO_WAIT);
+#else
+	const struct sid_timespec *sid_time = wakeup;
 	k_ticks_t timer_duration;
 
 	timer_duration = (k_ticks_t)k_ns_to_ticks_ceil64(MAX((uint64_t)sid_time->tv_nsec, 0));
 	timer_duration +=
 		(k_ticks_t)k_ms_to_ticks_ceil64(MAX((uint64_t)sid_time->tv_sec * MSEC_PER_SEC, 0));
 	k_timer_start(&sid_timer, Z_TIMEOUT_TICKS(Z_TICK_ABS(timer_duration)), K_NO_WAIT);
+#endif /* CONFIG_SIDEWALK_TIMER_TICKS */
 }
 
 #ifdef CONFIG_SIDEWALK_THREAD_TIMER
@@ -277,9 +724,7 @@ static void timer_task(void *arg1, void *arg2, void *arg3)
 
 	while (1) {
 		k_sem_take(&timer_trigger_sem, K_FOREVER);
-		struct sid_timespec handle_time;
-		sid_pal_uptime_now(&handle_time);
-		sid_pal_timer_event_callback(NULL, &handle_time);
+		sid_timer_event_now();
 	}
 }
 
@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_timer_heap.c
+ *  @brief Pairing heap timer queue.
+ *
+ *  Insert is O(1), expiry and cancel are O(log n) amortized.
+ *  The heap links are kept in a static pool, so sid_pal_timer_t keeps the layout
+ *  the Sidewalk libraries are built with. Every heap node keeps a pointer to its
+ *  leftmost child, its right sibling and to its left sibling (or to its parent
+ *  for the leftmost child). The queued timer is the only element of the list of
+ *  its heap node, so its node leads to the heap node.
+ *  Expired timers are moved to a list linked through the timer node.
+ */
+
+#include <sid_timer_queue.h>
+#include <sid_pal_assert_ifc.h>
+
+#include <zephyr/kernel.h>
+
+#define HEAP_NODES CONFIG_SIDEWALK_TIMER_QUEUE_HEAP_SIZE
+
+struct heap_node {
+	/* Holds the node of the queued timer. */
+	sys_dlist_t timer;
+	struct heap_node *child;
+	struct heap_node *sibling;
+	struct heap_node *prev;
+};
+
+static struct heap_node heap_nodes[HEAP_NODES];
+/* Nodes of the pool never used yet. */
+static uint32_t heap_nodes_used;
+/* Released nodes, linked through the sibling. */
+static struct heap_node *heap_free;
+static struct heap_node *heap_root;
+static sys_dlist_t expired_list = SYS_DLIST_STATIC_INIT(&expired_list);
+
+static struct heap_node *heap_node_alloc(sid_pal_timer_t *timer)
+{
+	struct heap_node *node = heap_free;
+
+	if (node) {
+		heap_free = node->sibling;
+	} else if (heap_nodes_used < HEAP_NODES) {
+		node = &heap_nodes[heap_nodes_used++];
+	}
+
+	/* More timers armed than CONFIG_SIDEWALK_TIMER_QUEUE_HEAP_SIZE. */
+	SID_PAL_ASSERT(node);
+
+	node->child = NULL;
+	node->sibling = NULL;
+	node->prev = NULL;
+	sys_dlist_init(&node->timer);
+	sys_dlist_append(&node->timer, &timer->node);
+
+	return node;
+}
+
+/* Detaches the timer of the node and releases the node. */
+static void heap_node_free(struct heap_node *node)
+{
+	sys_dlist_remove(sys_dlist_peek_head(&node->timer));
+	node->sibling = heap_free;
+	heap_free = node;
+}
+
+static inline sid_pal_timer_t *heap_timer(struct heap_node *node)
+{
+	return CONTAINER_OF(sys_dlist_peek_head(&node->timer), sid_pal_timer_t, node);
+}
+
+/* Returns NULL for a timer which is not in the heap. */
+static struct heap_node *heap_node_of(const sid_pal_timer_t *timer)
+{
+	uintptr_t list = (uintptr_t)timer->node.prev;
+
+	/* An expired timer is linked in the expired list, outside of the pool. */
+	if (!sys_dnode_is_linked(&timer->node) || list < (uintptr_t)&heap_nodes[0] ||
+	    list >= (uintptr_t)&heap_nodes[HEAP_NODES]) {
+		return NULL;
+	}
+
+	return CONTAINER_OF(timer->node.prev, struct heap_node, timer);
+}
+
+static inline bool heap_is_before(struct heap_node *a, struct heap_node *b)
+{
+	return sid_timer_queue_is_before(heap_timer(a), heap_timer(b));
+}
+
+/* Both arguments have to be detached roots, returns the new root. */
+static struct heap_node *heap_meld(struct heap_node *a, struct heap_node *b)
+{
+	if (heap_is_before(b, a)) {
+		struct heap_node *tmp = a;
+		a = b;
+		b = tmp;
+	}
+
+	b->sibling = a->child;
+	if (a->child) {
+		a->child->prev = b;
+	}
+	b->prev = a;
+	a->child = b;
+
+	return a;
+}
+
+/* Two-pass pairing of a sibling list, iterative to keep the stack usage constant. */
+static struct heap_node *heap_merge_pairs(struct heap_node *first)
+{
+	struct heap_node *pairs = NULL;
+	struct heap_node *result = NULL;
+
+	while (first) {
+		struct heap_node *a = first;
+		struct heap_node *b = a->sibling;
+
+		a->prev = NULL;
+		a->sibling = NULL;
+		if (!b) {
+			a->sibling = pairs;
+			pairs = a;
+			break;
+		}
+
+		first = b->sibling;
+		b->prev = NULL;
+		b->sibling = NULL;
+
+		a = heap_meld(a, b);
+		a->sibling = pairs;
+		pairs = a;
+	}
+
+	while (pairs) {
+		struct heap_node *next = pairs->sibling;
+
+		pairs->sibling = NULL;
+		result = result ? heap_meld(pairs, result) : pairs;
+		pairs = next;
+	}
+
+	return result;
+}
+
+void sid_timer_queue_node_init(sid_pal_timer_t *timer)
+{
+	SID_PAL_ASSERT(timer);
+
+	sys_dnode_init(&timer->node);
+}
+
+void sid_timer_queue_insert(sid_pal_timer_t *timer)
+{
+	SID_PAL_ASSERT(timer);
+	struct heap_node *node = heap_node_alloc(timer);
+
+	if (!heap_root) {
+		heap_root = node;
+		return;
+	}
+
+#ifndef CONFIG_SIDEWALK_TIMER_COALESCING
+	/* Only the root decides about the next wakeup, so only snap to the root alarm. */
+	if (sid_timer_queue_is_before(timer, heap_timer(heap_root))) {
+		sid_timer_queue_snap(timer, heap_timer(heap_root));
+	}
+#endif /* CONFIG_SIDEWALK_TIMER_COALESCING */
+
+	heap_root = heap_meld(heap_root, node);
+}
+
+void sid_timer_queue_remove(sid_pal_timer_t *timer)
+{
+	SID_PAL_ASSERT(timer);
+	struct heap_node *node = heap_node_of(timer);
+
+	if (!node) {
+		if (sys_dnode_is_linked(&timer->node)) {
+			sys_dlist_remove(&timer->node);
+		}
+		return;
+	}
+
+	if (node == heap_root) {
+		(void)sid_timer_queue_pop();
+		return;
+	}
+
+	if (node->prev->child == node) {
+		node->prev->child = node->sibling;
+	} else {
+		node->prev->sibling = node->sibling;
+	}
+	if (node->sibling) {
+		node->sibling->prev = node->prev;
+	}
+
+	struct heap_node *subtree = heap_merge_pairs(node->child);
+	if (subtree) {
+		heap_root = heap_meld(heap_root, subtree);
+	}
+	heap_node_free(node);
+}
+
+bool sid_timer_queue_is_queued(const sid_pal_timer_t *timer)
+{
+	SID_PAL_ASSERT(timer);
+
+	return sys_dnode_is_linked(&timer->node);
+}
+
+sid_pal_timer_t *sid_timer_queue_peek(void)
+{
+	return heap_root ? heap_timer(heap_root) : NULL;
+}
+
+sid_pal_timer_t *sid_timer_queue_pop(void)
+{
+	struct heap_node *node = heap_root;
+	sid_pal_timer_t *timer = NULL;
+
+	if (node) {
+		timer = heap_timer(node);
+		heap_root = heap_merge_pairs(node->child);
+		heap_node_free(node);
+	}
+
+	return timer;
+}
+
+void sid_timer_queue_expire(const sid_timer_queue_time_t *now)
+{
+	SID_PAL_ASSERT(now);
+
+	while (heap_root && sid_timer_queue_is_due(heap_timer(heap_root), now)) {
+		sid_pal_timer_t *timer = sid_timer_queue_pop();
+
+		sys_dlist_append(&expired_list, &timer->node);
+	}
+}
+
+sid_pal_timer_t *sid_timer_queue_pop_expired(void)
+{
+	sys_dnode_t *node = sys_dlist_get(&expired_list);
+
+	return node ? CONTAINER_OF(node, sid_pal_timer_t, node) : NULL;
+}
+
+#ifdef CONFIG_SIDEWALK_TIMER_COALESCING
+/* The leftmost sibling keeps the parent in prev. */
+static struct heap_node *heap_parent(struct heap_node *node)
+{
+	while (node->prev && node->prev->child != node) {
+		node = node->prev;
+	}
+
+	return node->prev;
+}
+
+void sid_timer_queue_deadline(sid_timer_queue_time_t *deadline)
+{
+	SID_PAL_ASSERT(deadline);
+	struct heap_node *node = heap_root;
+
+	*deadline = SID_TIMER_QUEUE_TIME_INFINITY;
+	/*
+	 * Iterative preorder walk. Children never expire before their parent,
+	 * so a subtree with the root alarm after the deadline can be skipped.
+	 */
+	while (node) {
+		sid_pal_timer_t *timer = heap_timer(node);
+
+		if (sid_timer_queue_is_due(timer, deadline)) {
+			sid_timer_queue_time_t latest;
+
+			sid_timer_queue_latest(timer, &latest);
+			if (sid_timer_queue_time_gt(deadline, &latest)) {
+				*deadline = latest;
+			}
+			if (node->child) {
+				node = node->child;
+				continue;
+			}
+		}
+
+		while (node && !node->sibling) {
+			node = heap_parent(node);
+		}
+		node = node ? node->sibling : NULL;
+	}
+}
+#endif /* CONFIG_SIDEWALK_TIMER_COALESCING */
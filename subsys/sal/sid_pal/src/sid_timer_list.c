@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file sid_timer_list.c
+ *  @brief Sorted list timer queue.
+ *
+ *  Insert is O(n), expiry is O(1). Suitable for a small number of timers.
+ */
+
+#include <sid_timer_queue.h>
+#include <sid_pal_assert_ifc.h>
+
+#include <zephyr/kernel.h>
+
+static sys_dlist_t timer_list = SYS_DLIST_STATIC_INIT(&timer_list);
+static sys_dlist_t expired_list = SYS_DLIST_STATIC_INIT(&expired_list);
+
+void sid_timer_queue_node_init(sid_pal_timer_t *timer)
+{
+	SID_PAL_ASSERT(timer);
+
+	sys_dnode_init(&timer->node);
+}
+
+void sid_timer_queue_insert(sid_pal_timer_t *timer)
+{
+	SID_PAL_ASSERT(timer);
+	sys_dnode_t *node = sys_dlist_peek_head(&timer_list);
+
+	while (node) {
+		sid_pal_timer_t *element = CONTAINER_OF(node, __typeof__(*element), node);
+		if (sid_timer_queue_is_before(timer, element)) {
+#ifndef CONFIG_SIDEWALK_TIMER_COALESCING
+			sid_timer_queue_snap(timer, element);
+#endif /* CONFIG_SIDEWALK_TIMER_COALESCING */
+			sys_dlist_insert(&element->node, &timer->node);
+			return;
+		}
+		node = sys_dlist_peek_next_no_check(&timer_list, node);
+	}
+
+	sys_dlist_append(&timer_list, &timer->node);
+}
+
+void sid_timer_queue_remove(sid_pal_timer_t *timer)
+{
+	SID_PAL_ASSERT(timer);
+
+	if (sys_dnode_is_linked(&timer->node)) {
+		sys_dlist_remove(&timer->node);
+	}
+}
+
+bool sid_timer_queue_is_queued(const sid_pal_timer_t *timer)
+{
+	SID_PAL_ASSERT(timer);
+
+	return sys_dnode_is_linked(&timer->node);
+}
+
+sid_pal_timer_t *sid_timer_queue_peek(void)
+{
+	sid_pal_timer_t *timer = SYS_DLIST_PEEK_HEAD_CONTAINER(&timer_list, timer, node);
+
+	return timer;
+}
+
+sid_pal_timer_t *sid_timer_queue_pop(void)
+{
+	sid_pal_timer_t *timer = SYS_DLIST_PEEK_HEAD_CONTAINER(&timer_list, timer, node);
+
+	if (timer) {
+		sys_dlist_remove(&timer->node);
+	}
+
+	return timer;
+}
+
+void sid_timer_queue_expire(const sid_timer_queue_time_t *now)
+{
+	SID_PAL_ASSERT(now);
+	sid_pal_timer_t *timer = SYS_DLIST_PEEK_HEAD_CONTAINER(&timer_list, timer, node);
+
+	while (timer && sid_timer_queue_is_due(timer, now)) {
+		sys_dlist_remove(&timer->node);
+		sys_dlist_append(&expired_list, &timer->node);
+		timer = SYS_DLIST_PEEK_HEAD_CONTAINER(&timer_list, timer, node);
+	}
+}
+
+sid_pal_timer_t *sid_timer_queue_pop_expired(void)
+{
+	sys_dnode_t *node = sys_dlist_get(&expired_list);
+
+	return node ? CONTAINER_OF(node, sid_pal_timer_t, node) : NULL;
+}
+
+#ifdef CONFIG_SIDEWALK_TIMER_COALESCING
+void sid_timer_queue_deadline(sid_timer_queue_time_t *deadline)
+{
+	SID_PAL_ASSERT(deadline);
+	sid_pal_timer_t *timer;
+
+	*deadline = SID_TIMER_QUEUE_TIME_INFINITY;
+	/* The list is sorted by alarm, no window starting after the deadline can lower it. */
+	SYS_DLIST_FOR_EACH_CONTAINER (&timer_list, timer, node) {
+		sid_timer_queue_time_t latest;
+
+		if (!sid_timer_queue_is_due(timer, deadline)) {
+			break;
+		}
+		sid_timer_queue_latest(timer, &latest);
+		if (sid_timer_queue_time_gt(deadline, &latest)) {
+			*deadline = latest;
+		}
+	}
+}
+#endif /* CONFIG_SIDEWALK_TIMER_COALESCING */
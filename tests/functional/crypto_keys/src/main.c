@@ -126,4 +126,68 @@ ZTEST(crypto_keys, test_sid_crypto_key_generate)
 	zassert_equal(0, err, "err: %d", err);
 }
 
+static void key_cmac(uint8_t *key_buffer, uint8_t *mac)
+{
+	uint8_t in[TEST_SYMMETRIC_KEY_SIZE] = { 0 };
+	sid_pal_aes_params_t params = {
+		.algo = SID_PAL_AES_CMAC_128,
+		.mode = SID_PAL_CRYPTO_MAC_CALCULATE,
+		.key = key_buffer,
+		.key_size = TEST_SYMMETRIC_KEY_SIZE * 8,
+		.in = in,
+		.in_size = sizeof(in),
+		.out = mac,
+		.out_size = TEST_SYMMETRIC_KEY_SIZE,
+	};
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_aes_crypt(&params));
+}
+
+ZTEST(crypto_keys, test_sid_crypto_key_residency)
+{
+	uint8_t test_key_data[TEST_SYMMETRIC_KEY_SIZE] = { 0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5,
+							   0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB,
+							   0xBC, 0xBD, 0xBE, 0xBF };
+	uint8_t mac[TEST_SYMMETRIC_KEY_SIZE];
+	uint8_t mac_again[TEST_SYMMETRIC_KEY_SIZE];
+	struct sid_crypto_keys_stats stats;
+	int err = -ENOEXEC;
+
+	err = sid_crypto_keys_init();
+	zassert_equal(0, err, "err: %d", err);
+
+	err = sid_crypto_keys_new_import(test_key_id, test_key_data, TEST_SYMMETRIC_KEY_SIZE);
+	zassert_equal(0, err, "err: %d", err);
+
+	err = sid_crypto_keys_buffer_set(test_key_id, test_key_data, TEST_SYMMETRIC_KEY_SIZE);
+	zassert_equal(0, err, "err: %d", err);
+
+	sid_crypto_keys_stats_reset();
+	key_cmac(test_key_data, mac);
+	key_cmac(test_key_data, mac_again);
+	zassert_mem_equal(mac, mac_again, sizeof(mac));
+
+	sid_crypto_keys_stats_get(&stats);
+	if (IS_ENABLED(CONFIG_SIDEWALK_CRYPTO_KEYS_PURGE_AFTER_USE)) {
+		zassert_equal(2, stats.loads);
+		zassert_equal(0, stats.hits);
+		zassert_equal(2, stats.purges);
+	} else if (IS_ENABLED(CONFIG_SIDEWALK_CRYPTO_KEYS_PURGE_IMMEDIATELY)) {
+		/* Purged after the import, the first use loads the key. */
+		zassert_equal(1, stats.loads);
+		zassert_equal(1, stats.hits);
+		zassert_equal(0, stats.purges);
+	} else {
+		zassert_equal(0, stats.loads);
+		zassert_equal(2, stats.hits);
+		zassert_equal(0, stats.purges);
+	}
+
+	err = sid_crypto_keys_delete(test_key_id);
+	zassert_equal(0, err, "err: %d", err);
+
+	err = sid_crypto_keys_deinit();
+	zassert_equal(0, err, "err: %d", err);
+}
+
 ZTEST_SUITE(crypto_keys, NULL, setup, NULL, NULL, teardown);
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <unity.h>
+#include <sid_pal_critical_region_ifc.h>
+#include <sid_critical_region_profiler.h>
+
+#include <zephyr/kernel.h>
+
+#define HOLD_SHORT_US 100
+#define HOLD_MEDIUM_US 200
+#define HOLD_LONG_US 300
+
+/* Every function is a separate call site of the critical region. */
+static __noinline void hold_site_a(uint32_t hold_us)
+{
+	sid_pal_enter_critical_region();
+	k_busy_wait(hold_us);
+	sid_pal_exit_critical_region();
+}
+
+static __noinline void hold_site_b(uint32_t hold_us)
+{
+	sid_pal_enter_critical_region();
+	k_busy_wait(hold_us);
+	sid_pal_exit_critical_region();
+}
+
+static __noinline void hold_site_c(uint32_t hold_us)
+{
+	sid_pal_enter_critical_region();
+	k_busy_wait(hold_us);
+	sid_pal_exit_critical_region();
+}
+
+static __noinline void hold_site_nested(uint32_t hold_us)
+{
+	sid_pal_enter_critical_region();
+	hold_site_a(hold_us);
+	k_busy_wait(hold_us);
+	sid_pal_exit_critical_region();
+}
+
+static void assert_site_max_at_least(const struct sid_critical_region_site *site, uint32_t hold_us)
+{
+	TEST_ASSERT_GREATER_OR_EQUAL_UINT32(k_us_to_cyc_floor32(hold_us), site->max_cycles);
+}
+
+void setUp(void)
+{
+	sid_critical_region_profiler_reset();
+}
+
+void test_sid_critical_region_profiler_empty(void)
+{
+	struct sid_critical_region_profile profile;
+
+	sid_critical_region_profiler_get(&profile);
+	TEST_ASSERT_EQUAL(0, profile.sites_num);
+	TEST_ASSERT_EQUAL(0, profile.count);
+	TEST_ASSERT_EQUAL(0, profile.evicted);
+
+	sid_critical_region_profiler_get(NULL);
+}
+
+void test_sid_critical_region_profiler_outermost_caller(void)
+{
+	struct sid_critical_region_profile profile;
+
+	hold_site_nested(HOLD_SHORT_US);
+
+	sid_critical_region_profiler_get(&profile);
+	TEST_ASSERT_EQUAL(1, profile.count);
+	TEST_ASSERT_EQUAL(1, profile.sites_num);
+	TEST_ASSERT_EQUAL(1, profile.sites[0].count);
+	assert_site_max_at_least(&profile.sites[0], 2 * HOLD_SHORT_US);
+
+	/* The same function entered as the outermost region is another call site. */
+	hold_site_a(HOLD_SHORT_US);
+	sid_critical_region_profiler_get(&profile);
+	TEST_ASSERT_EQUAL(2, profile.count);
+	TEST_ASSERT_EQUAL(2, profile.sites_num);
+	TEST_ASSERT_NOT_EQUAL(profile.sites[0].caller, profile.sites[1].caller);
+}
+
+void test_sid_critical_region_profiler_sorted(void)
+{
+	struct sid_critical_region_profile profile;
+
+	hold_site_a(HOLD_SHORT_US);
+	hold_site_b(HOLD_LONG_US);
+	hold_site_a(HOLD_SHORT_US);
+
+	sid_critical_region_profiler_get(&profile);
+	TEST_ASSERT_EQUAL(3, profile.count);
+	TEST_ASSERT_EQUAL(2, profile.sites_num);
+	TEST_ASSERT_EQUAL(1, profile.sites[0].count);
+	assert_site_max_at_least(&profile.sites[0], HOLD_LONG_US);
+	TEST_ASSERT_EQUAL(2, profile.sites[1].count);
+	assert_site_max_at_least(&profile.sites[1], HOLD_SHORT_US);
+	TEST_ASSERT_GREATER_OR_EQUAL_UINT64(2 * (uint64_t)k_us_to_cyc_floor32(HOLD_SHORT_US),
+					    profile.sites[1].sum_cycles);
+	TEST_ASSERT_GREATER_THAN_UINT32(profile.sites[1].max_cycles, profile.sites[0].max_cycles);
+}
+
+void test_sid_critical_region_profiler_keeps_worst_sites(void)
+{
+	struct sid_critical_region_profile profile;
+	uintptr_t caller_b;
+
+	hold_site_a(HOLD_SHORT_US);
+	hold_site_b(HOLD_MEDIUM_US);
+	sid_critical_region_profiler_get(&profile);
+	caller_b = profile.sites[0].caller;
+
+	/* Full table, the shortest call site makes room for a longer one. */
+	hold_site_c(HOLD_LONG_US);
+	sid_critical_region_profiler_get(&profile);
+	TEST_ASSERT_EQUAL(3, profile.count);
+	TEST_ASSERT_EQUAL(2, profile.sites_num);
+	TEST_ASSERT_EQUAL(1, profile.evicted);
+	assert_site_max_at_least(&profile.sites[0], HOLD_LONG_US);
+	TEST_ASSERT_EQUAL(caller_b, profile.sites[1].caller);
+
+	/* A shorter hold of a new call site is only counted. */
+	hold_site_a(HOLD_SHORT_US);
+	sid_critical_region_profiler_get(&profile);
+	TEST_ASSERT_EQUAL(4, profile.count);
+	TEST_ASSERT_EQUAL(2, profile.sites_num);
+	TEST_ASSERT_EQUAL(1, profile.evicted);
+	TEST_ASSERT_EQUAL(caller_b, profile.sites[1].caller);
+}
+
+void test_sid_critical_region_profiler_reset(void)
+{
+	struct sid_critical_region_profile profile;
+
+	hold_site_a(HOLD_SHORT_US);
+	sid_critical_region_profiler_reset();
+
+	sid_critical_region_profiler_get(&profile);
+	TEST_ASSERT_EQUAL(0, profile.count);
+	TEST_ASSERT_EQUAL(0, profile.sites_num);
+}
+
+/* It is required to be added to each test. That is because unity is using
+ * different main signature (returns int) and zephyr expects main which does
+ * not return value.
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	return unity_main();
+}
@@ -6,8 +6,8 @@
 #include <unity.h>
 #include <string.h>
 #include <stdio.h>
-#include <math.h>
 #include <sid_pal_crypto_ifc.h>
+#include <sid_crypto_stream.h>
 #include <zephyr/sys/util.h>
 
 #include <zephyr/fff.h>
@@ -73,6 +73,13 @@ FAKE_VALUE_FUNC(psa_status_t, psa_aead_decrypt_setup, psa_aead_operation_t *, mb
 FAKE_VALUE_FUNC(psa_status_t, psa_aead_abort, psa_aead_operation_t *);
 FAKE_VALUE_FUNC(psa_status_t, psa_raw_key_agreement, psa_algorithm_t, mbedtls_svc_key_id_t,
 		const uint8_t *, size_t, uint8_t *, size_t, size_t *);
+FAKE_VALUE_FUNC(psa_status_t, psa_hash_setup, psa_hash_operation_t *, psa_algorithm_t);
+FAKE_VALUE_FUNC(psa_status_t, psa_hash_update, psa_hash_operation_t *, const uint8_t *, size_t);
+FAKE_VALUE_FUNC(psa_status_t, psa_hash_finish, psa_hash_operation_t *, uint8_t *, size_t,
+		size_t *);
+FAKE_VALUE_FUNC(psa_status_t, psa_hash_verify, psa_hash_operation_t *, const uint8_t *, size_t);
+FAKE_VALUE_FUNC(psa_status_t, psa_hash_abort, psa_hash_operation_t *);
+FAKE_VALUE_FUNC(psa_status_t, psa_mac_abort, psa_mac_operation_t *);
 /*************************************************************************
 * Create fake functions for tests end.
 * ***********************************************************************/
@@ -108,7 +115,13 @@ FAKE_VALUE_FUNC(psa_status_t, psa_raw_key_agreement, psa_algorithm_t, mbedtls_sv
 	FAKE(psa_aead_set_nonce)                                                                   \
 	FAKE(psa_aead_set_lengths)                                                                 \
 	FAKE(psa_aead_abort)                                                                       \
-	FAKE(psa_raw_key_agreement)
+	FAKE(psa_raw_key_agreement)                                                                \
+	FAKE(psa_hash_setup)                                                                       \
+	FAKE(psa_hash_update)                                                                      \
+	FAKE(psa_hash_finish)                                                                      \
+	FAKE(psa_hash_verify)                                                                      \
+	FAKE(psa_hash_abort)                                                                       \
+	FAKE(psa_mac_abort)
 
 #define RNG_BUFF_MAX_SIZE (128)
 
@@ -141,14 +154,43 @@ FAKE_VALUE_FUNC(psa_status_t, psa_raw_key_agreement, psa_algorithm_t, mbedtls_sv
 
 #define ECDSA_SIGNATURE_SIZE (64)
 
-#define ALGO_DATA_CHUNK (32)
-
 /**
  * @brief create pointer to variable
  *
  */
 #define ALIAS(variable, alias_name) __typeof__(&variable) alias_name = &variable
 
+/**
+ * @brief Number of PSA update calls for an input of data_size bytes.
+ *
+ */
+static size_t update_calls(size_t data_size)
+{
+#if CONFIG_SIDEWALK_CRYPTO_DATA_CHUNK_SIZE > 0
+	return MAX(DIV_ROUND_UP(data_size, CONFIG_SIDEWALK_CRYPTO_DATA_CHUNK_SIZE), 1);
+#else
+	return 1;
+#endif /* CONFIG_SIDEWALK_CRYPTO_DATA_CHUNK_SIZE */
+}
+
+/**
+ * @brief Check that the input was given to PSA whole, in parts of at most the chunk size.
+ *
+ */
+#define ASSERT_UPDATE_PARTS(fake, data_size)                                                       \
+	do {                                                                                       \
+		size_t total = 0;                                                                  \
+		TEST_ASSERT_EQUAL(update_calls(data_size), fake.call_count);                       \
+		for (size_t i = 0; i < fake.call_count; i++) {                                     \
+			if (CONFIG_SIDEWALK_CRYPTO_DATA_CHUNK_SIZE > 0) {                          \
+				TEST_ASSERT_LESS_OR_EQUAL(CONFIG_SIDEWALK_CRYPTO_DATA_CHUNK_SIZE,  \
+							  fake.arg2_history[i]);                   \
+			}                                                                          \
+			total += fake.arg2_history[i];                                             \
+		}                                                                                  \
+		TEST_ASSERT_EQUAL(data_size, total);                                               \
+	} while (0)
+
 typedef psa_status_t (*custom_psa_aead_update_t)(psa_aead_operation_t *, const uint8_t *, size_t,
 						 uint8_t *, size_t, size_t *);
 struct mock_psa_aead_update_values_t {
@@ -451,12 +493,102 @@ void test_sid_pal_crypto_hash_pass(void)
 	psa_hash_compute_fake.return_val = PSA_SUCCESS;
 	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_pal_crypto_hash(&params));
 
-	// Check errors as well.
+	// Check errors as well, data over the chunk size is hashed in parts.
 	psa_hash_compute_fake.return_val = PSA_ERROR_NOT_SUPPORTED;
+	psa_hash_setup_fake.return_val = PSA_ERROR_NOT_SUPPORTED;
 	TEST_ASSERT_EQUAL(SID_ERROR_NOSUPPORT, sid_pal_crypto_hash(&params));
 
 	psa_hash_compute_fake.return_val = PSA_ERROR_GENERIC_ERROR;
+	psa_hash_setup_fake.return_val = PSA_ERROR_GENERIC_ERROR;
+	TEST_ASSERT_EQUAL(SID_ERROR_GENERIC, sid_pal_crypto_hash(&params));
+}
+
+void test_sid_pal_crypto_hash_compute_parts(void)
+{
+	sid_pal_hash_params_t params;
+	uint8_t data[HASH_TEST_DATA_BLOCK_SIZE];
+	uint8_t digest[SHA_MAX_DIGEST_LEN];
+	const bool one_shot = (update_calls(sizeof(data)) == 1);
+
+	memset(&params, 0x00, sizeof(params));
+
+	psa_crypto_init_fake.return_val = PSA_SUCCESS;
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_pal_crypto_init());
+
+	params.algo = SID_PAL_HASH_SHA256;
+	params.data = data;
+	params.digest = digest;
+	params.digest_size = SHA256_LEN;
+	params.data_size = sizeof(data);
+
+	/* Input larger than the chunk size falls back to a multi-part hash. */
+	psa_hash_compute_fake.return_val = PSA_SUCCESS;
+	psa_hash_setup_fake.return_val = PSA_SUCCESS;
+	psa_hash_update_fake.return_val = PSA_SUCCESS;
+	psa_hash_finish_fake.return_val = PSA_SUCCESS;
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_pal_crypto_hash(&params));
+	TEST_ASSERT_EQUAL(one_shot ? 1 : 0, psa_hash_compute_fake.call_count);
+	TEST_ASSERT_EQUAL(one_shot ? 0 : 1, psa_hash_setup_fake.call_count);
+	TEST_ASSERT_EQUAL(one_shot ? 0 : 1, psa_hash_finish_fake.call_count);
+	TEST_ASSERT_EQUAL(0, psa_hash_abort_fake.call_count);
+	if (!one_shot) {
+		ASSERT_UPDATE_PARTS(psa_hash_update_fake, params.data_size);
+	}
+
+	/* A failed multi-part hash is aborted. */
+	FFF_FAKES_LIST(RESET_FAKE);
+	psa_hash_compute_fake.return_val = PSA_ERROR_GENERIC_ERROR;
+	psa_hash_setup_fake.return_val = PSA_SUCCESS;
+	psa_hash_update_fake.return_val = PSA_SUCCESS;
+	psa_hash_finish_fake.return_val = PSA_ERROR_GENERIC_ERROR;
 	TEST_ASSERT_EQUAL(SID_ERROR_GENERIC, sid_pal_crypto_hash(&params));
+	TEST_ASSERT_EQUAL(one_shot ? 0 : 1, psa_hash_abort_fake.call_count);
+}
+
+void test_sid_pal_crypto_hash_update_parts(void)
+{
+	sid_pal_hash_ctx_t ctx;
+	uint8_t data[HASH_TEST_DATA_BLOCK_SIZE];
+	size_t test_vector[] = { 0, 1, 31, 32, 33, 64, 100, HASH_TEST_DATA_BLOCK_SIZE };
+
+	psa_crypto_init_fake.return_val = PSA_SUCCESS;
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_pal_crypto_init());
+
+	psa_hash_setup_fake.return_val = PSA_SUCCESS;
+	psa_hash_update_fake.return_val = PSA_SUCCESS;
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_pal_crypto_hash_init(&ctx, SID_PAL_HASH_SHA256));
+
+	for (size_t it = 0; it < ARRAY_SIZE(test_vector); it++) {
+		TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+				  sid_pal_crypto_hash_update(&ctx, data, test_vector[it]));
+		ASSERT_UPDATE_PARTS(psa_hash_update_fake, test_vector[it]);
+		RESET_FAKE(psa_hash_update);
+		psa_hash_update_fake.return_val = PSA_SUCCESS;
+	}
+	TEST_ASSERT_EQUAL(0, psa_hash_abort_fake.call_count);
+}
+
+void test_sid_pal_crypto_hash_update_fail_abort(void)
+{
+	sid_pal_hash_ctx_t ctx;
+	uint8_t data[HASH_TEST_DATA_BLOCK_SIZE];
+	psa_status_t psa_hash_update_ret[HASH_TEST_DATA_BLOCK_SIZE];
+	const size_t calls = update_calls(sizeof(data));
+
+	psa_crypto_init_fake.return_val = PSA_SUCCESS;
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_pal_crypto_init());
+
+	psa_hash_setup_fake.return_val = PSA_SUCCESS;
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_pal_crypto_hash_init(&ctx, SID_PAL_HASH_SHA256));
+
+	/* The last part fails, no part is given to PSA after it. */
+	for (size_t i = 0; i < calls; i++) {
+		psa_hash_update_ret[i] = (i == calls - 1) ? PSA_ERROR_GENERIC_ERROR : PSA_SUCCESS;
+	}
+	SET_RETURN_SEQ(psa_hash_update, psa_hash_update_ret, calls);
+	TEST_ASSERT_EQUAL(SID_ERROR_GENERIC, sid_pal_crypto_hash_update(&ctx, data, sizeof(data)));
+	TEST_ASSERT_EQUAL(calls, psa_hash_update_fake.call_count);
+	TEST_ASSERT_EQUAL(1, psa_hash_abort_fake.call_count);
 }
 
 /*************************************************************************
@@ -689,11 +821,47 @@ void test_sid_pal_crypto_hmac_variable_data_len(void)
 	for (int it = 0; it < (int)(sizeof(test_vector) / sizeof(test_vector[0])); it++) {
 		params.data_size = test_vector[it];
 		TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_pal_crypto_hmac(&params));
-		TEST_ASSERT_EQUAL(
-			ceilf((double)((double)params.data_size / (double)ALGO_DATA_CHUNK)),
-			psa_mac_update_fake.call_count);
+		ASSERT_UPDATE_PARTS(psa_mac_update_fake, params.data_size);
+		RESET_FAKE(psa_mac_update);
+	}
+}
+
+void test_sid_pal_crypto_hmac_update_parts(void)
+{
+	sid_pal_hmac_ctx_t ctx;
+	uint8_t data[HMAC_TEST_DATA_BLOCK_SIZE];
+	uint8_t hmac_test_key[HMAC_MAX_BLOCK_SIZE];
+	size_t test_vector[] = { 0, 1, 31, 32, 33, 64, 100, HMAC_TEST_DATA_BLOCK_SIZE };
+	psa_status_t psa_mac_update_ret[HMAC_TEST_DATA_BLOCK_SIZE];
+	const size_t calls = update_calls(sizeof(data));
+
+	psa_crypto_init_fake.return_val = PSA_SUCCESS;
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_pal_crypto_init());
+
+	psa_import_key_fake.return_val = PSA_SUCCESS;
+	psa_mac_sign_setup_fake.return_val = PSA_SUCCESS;
+	psa_mac_update_fake.return_val = PSA_SUCCESS;
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+			  sid_pal_crypto_hmac_init(&ctx, SID_PAL_HASH_SHA256, hmac_test_key,
+						   sizeof(hmac_test_key)));
+
+	for (size_t it = 0; it < ARRAY_SIZE(test_vector); it++) {
+		TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+				  sid_pal_crypto_hmac_update(&ctx, data, test_vector[it]));
+		ASSERT_UPDATE_PARTS(psa_mac_update_fake, test_vector[it]);
 		RESET_FAKE(psa_mac_update);
 	}
+	TEST_ASSERT_EQUAL(0, psa_mac_abort_fake.call_count);
+
+	/* The last part fails, the HMAC is aborted and its key released. */
+	for (size_t i = 0; i < calls; i++) {
+		psa_mac_update_ret[i] = (i == calls - 1) ? PSA_ERROR_GENERIC_ERROR : PSA_SUCCESS;
+	}
+	SET_RETURN_SEQ(psa_mac_update, psa_mac_update_ret, calls);
+	TEST_ASSERT_EQUAL(SID_ERROR_GENERIC, sid_pal_crypto_hmac_update(&ctx, data, sizeof(data)));
+	TEST_ASSERT_EQUAL(calls, psa_mac_update_fake.call_count);
+	TEST_ASSERT_EQUAL(1, psa_mac_abort_fake.call_count);
+	TEST_ASSERT_EQUAL(PSA_KEY_ID_NULL, ctx.key_handle);
 }
 
 /*************************************************************************
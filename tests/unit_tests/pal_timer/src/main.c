@@ -4,8 +4,13 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 #include <unity.h>
+#include <zephyr/kernel.h>
 #include <sid_pal_timer_ifc.h>
 #include <cmock_sid_pal_critical_region_ifc.h>
+#include <cmock_sid_pal_uptime_ifc.h>
+#include <sid_timer_stats.h>
+#include <sid_timer_coalescing.h>
+#include <sid_timer_queue.h>
 
 static sid_pal_timer_t *p_null_timer = NULL;
 static sid_pal_timer_t test_timer;
@@ -13,12 +18,27 @@ static sid_pal_timer_t test_timer_2;
 static int test_timer_arg;
 
 static int timer_callback_cnt = 0;
+static struct sid_timespec fake_uptime;
+
+static sid_error_t fake_uptime_now(struct sid_timespec *result, int cmock_num_calls)
+{
+	*result = fake_uptime;
+	return SID_ERROR_NONE;
+}
 
 void setUp(void)
 {
 	timer_callback_cnt = 0;
+	fake_uptime = SID_TIME_ZERO;
 	__cmock_sid_pal_enter_critical_region_Ignore();
 	__cmock_sid_pal_exit_critical_region_Ignore();
+	__cmock_sid_pal_uptime_now_Stub(fake_uptime_now);
+#ifdef CONFIG_SIDEWALK_TIMER_STATS
+	sid_timer_stats_reset();
+#endif /* CONFIG_SIDEWALK_TIMER_STATS */
+#ifdef CONFIG_SIDEWALK_TIMER_COALESCING
+	sid_timer_coalescing_reset();
+#endif /* CONFIG_SIDEWALK_TIMER_COALESCING */
 }
 
 /******************************************************************
@@ -229,6 +249,346 @@ void test_sid_pal_timer_two_timers(void)
 	timer_deinit();
 }
 
+static int critical_region_enter_cnt = 0;
+
+static void critical_region_enter_stub(int cmock_num_calls)
+{
+	critical_region_enter_cnt++;
+}
+
+void test_sid_pal_timer_batch_expiry(void)
+{
+	struct sid_timespec when_1 = { .tv_nsec = 50 * SID_TIME_NSEC_PER_USEC, .tv_sec = 0 };
+	struct sid_timespec when_2 = { .tv_nsec = 60 * SID_TIME_NSEC_PER_USEC, .tv_sec = 0 };
+	struct sid_timespec period = { .tv_sec = 5 };
+	struct sid_timespec fake_time = { .tv_nsec = 70 * SID_TIME_NSEC_PER_USEC, .tv_sec = 0 };
+
+	timer_init();
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+			  sid_pal_timer_init(&test_timer_2, timer_cb, &test_timer_arg));
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+			  sid_pal_timer_arm(&test_timer, SID_PAL_TIMER_PRIO_CLASS_PRECISE, &when_1,
+					    NULL));
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+			  sid_pal_timer_arm(&test_timer_2, SID_PAL_TIMER_PRIO_CLASS_PRECISE,
+					    &when_2, &period));
+
+	critical_region_enter_cnt = 0;
+	__cmock_sid_pal_enter_critical_region_Stub(critical_region_enter_stub);
+
+	sid_pal_timer_event_callback(NULL, &fake_time);
+
+	/* Two expired timers take three critical regions. */
+	TEST_ASSERT_EQUAL(2, timer_callback_cnt);
+	TEST_ASSERT_EQUAL(3, critical_region_enter_cnt);
+	TEST_ASSERT_FALSE(sid_pal_timer_is_armed(&test_timer));
+	TEST_ASSERT_TRUE(sid_pal_timer_is_armed(&test_timer_2));
+
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_pal_timer_deinit(&test_timer_2));
+	timer_deinit();
+}
+
+static void timer_cancel_cb(void *arg, sid_pal_timer_t *originator)
+{
+	timer_callback_cnt++;
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_pal_timer_cancel((sid_pal_timer_t *)arg));
+}
+
+void test_sid_pal_timer_cancel_from_expired_callback(void)
+{
+	struct sid_timespec when_1 = { .tv_nsec = 50 * SID_TIME_NSEC_PER_USEC, .tv_sec = 0 };
+	struct sid_timespec when_2 = { .tv_nsec = 60 * SID_TIME_NSEC_PER_USEC, .tv_sec = 0 };
+	struct sid_timespec fake_time = { .tv_nsec = 70 * SID_TIME_NSEC_PER_USEC, .tv_sec = 0 };
+
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+			  sid_pal_timer_init(&test_timer, timer_cancel_cb, &test_timer_2));
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+			  sid_pal_timer_init(&test_timer_2, timer_cb, &test_timer_arg));
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+			  sid_pal_timer_arm(&test_timer, SID_PAL_TIMER_PRIO_CLASS_PRECISE, &when_1,
+					    NULL));
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+			  sid_pal_timer_arm(&test_timer_2, SID_PAL_TIMER_PRIO_CLASS_PRECISE,
+					    &when_2, NULL));
+
+	sid_pal_timer_event_callback(NULL, &fake_time);
+
+	/* The second timer expired together with the first one, but was canceled by it. */
+	TEST_ASSERT_EQUAL(1, timer_callback_cnt);
+	TEST_ASSERT_FALSE(sid_pal_timer_is_armed(&test_timer_2));
+
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_pal_timer_deinit(&test_timer_2));
+	timer_deinit();
+}
+
+#define ORDER_TIMERS 8
+
+static sid_pal_timer_t order_timers[ORDER_TIMERS];
+static int order_expired[ORDER_TIMERS];
+
+static void timer_order_cb(void *arg, sid_pal_timer_t *originator)
+{
+	order_expired[timer_callback_cnt++] = (int)(originator - order_timers);
+}
+
+void test_sid_pal_timer_order_cancel(void)
+{
+	/* Armed out of order, alarms in order of the index. */
+	const int arm_order[ORDER_TIMERS] = { 5, 2, 7, 0, 3, 6, 1, 4 };
+	const int expected[] = { 0, 1, 2, 4, 6, 7 };
+	struct sid_timespec when;
+
+	for (int i = 0; i < ORDER_TIMERS; i++) {
+		TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+				  sid_pal_timer_init(&order_timers[i], timer_order_cb, NULL));
+	}
+	for (int i = 0; i < ORDER_TIMERS; i++) {
+		int idx = arm_order[i];
+
+		when = (struct sid_timespec){ .tv_nsec = (idx + 1) * 10 * SID_TIME_NSEC_PER_USEC };
+		TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+				  sid_pal_timer_arm(&order_timers[idx],
+						    SID_PAL_TIMER_PRIO_CLASS_PRECISE, &when, NULL));
+	}
+
+	/* Cancel timers in the middle of the queue. */
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_pal_timer_cancel(&order_timers[3]));
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_pal_timer_cancel(&order_timers[5]));
+	TEST_ASSERT_FALSE(sid_pal_timer_is_armed(&order_timers[3]));
+	TEST_ASSERT_FALSE(sid_pal_timer_is_armed(&order_timers[5]));
+	TEST_ASSERT_TRUE(sid_pal_timer_is_armed(&order_timers[4]));
+
+	when = (struct sid_timespec){ .tv_nsec = 25 * SID_TIME_NSEC_PER_USEC };
+	sid_pal_timer_event_callback(NULL, &when);
+	TEST_ASSERT_EQUAL(2, timer_callback_cnt);
+
+	when = (struct sid_timespec){ .tv_nsec = 100 * SID_TIME_NSEC_PER_USEC };
+	sid_pal_timer_event_callback(NULL, &when);
+	TEST_ASSERT_EQUAL(ARRAY_SIZE(expected), timer_callback_cnt);
+	TEST_ASSERT_EQUAL_INT_ARRAY(expected, order_expired, ARRAY_SIZE(expected));
+
+	for (int i = 0; i < ORDER_TIMERS; i++) {
+		TEST_ASSERT_FALSE(sid_pal_timer_is_armed(&order_timers[i]));
+		TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_pal_timer_deinit(&order_timers[i]));
+	}
+}
+
+void test_sid_pal_timer_stats(void)
+{
+#ifdef CONFIG_SIDEWALK_TIMER_STATS
+	struct sid_timespec when_1 = { .tv_nsec = 50 * SID_TIME_NSEC_PER_USEC, .tv_sec = 0 };
+	struct sid_timespec when_2 = { .tv_nsec = 80 * SID_TIME_NSEC_PER_USEC, .tv_sec = 0 };
+	struct sid_timer_stats stats;
+
+	timer_init();
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+			  sid_pal_timer_init(&test_timer_2, timer_cb, &test_timer_arg));
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+			  sid_pal_timer_arm(&test_timer, SID_PAL_TIMER_PRIO_CLASS_PRECISE, &when_1,
+					    NULL));
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+			  sid_pal_timer_arm(&test_timer_2, SID_PAL_TIMER_PRIO_CLASS_LOWPOWER,
+					    &when_2, NULL));
+
+	/* Handle both timers 1050 us after the precise one. */
+	fake_uptime.tv_nsec = 1100 * SID_TIME_NSEC_PER_USEC;
+	sid_pal_timer_event_callback(NULL, &fake_uptime);
+
+	sid_timer_stats_get(&stats);
+	TEST_ASSERT_EQUAL(1, stats.events);
+	TEST_ASSERT_EQUAL(1, stats.lateness[SID_PAL_TIMER_PRIO_CLASS_PRECISE].count);
+	TEST_ASSERT_EQUAL(1050, stats.lateness[SID_PAL_TIMER_PRIO_CLASS_PRECISE].max_us);
+	TEST_ASSERT_EQUAL(1, stats.lateness[SID_PAL_TIMER_PRIO_CLASS_PRECISE]
+				     .buckets[sid_timer_stats_bucket(1050)]);
+	TEST_ASSERT_EQUAL(1, stats.lateness[SID_PAL_TIMER_PRIO_CLASS_LOWPOWER].count);
+	TEST_ASSERT_EQUAL(1020, stats.lateness[SID_PAL_TIMER_PRIO_CLASS_LOWPOWER].max_us);
+	TEST_ASSERT_EQUAL(2, stats.callback.count);
+	TEST_ASSERT_EQUAL(3, stats.lock_hold.count);
+
+	sid_timer_stats_reset();
+	sid_timer_stats_get(&stats);
+	TEST_ASSERT_EQUAL(0, stats.events);
+	TEST_ASSERT_EQUAL(0, stats.callback.count);
+
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_pal_timer_deinit(&test_timer_2));
+	timer_deinit();
+#else
+	TEST_IGNORE_MESSAGE("CONFIG_SIDEWALK_TIMER_STATS is disabled");
+#endif /* CONFIG_SIDEWALK_TIMER_STATS */
+}
+
+void test_sid_pal_timer_stats_bucket(void)
+{
+	TEST_ASSERT_EQUAL(0, sid_timer_stats_bucket(0));
+	TEST_ASSERT_EQUAL(1, sid_timer_stats_bucket(1));
+	TEST_ASSERT_EQUAL(2, sid_timer_stats_bucket(2));
+	TEST_ASSERT_EQUAL(2, sid_timer_stats_bucket(3));
+	TEST_ASSERT_EQUAL(11, sid_timer_stats_bucket(1050));
+	TEST_ASSERT_EQUAL(SID_TIMER_STATS_HIST_BUCKETS - 1, sid_timer_stats_bucket(UINT32_MAX));
+}
+
+void test_sid_pal_timer_arm_with_tolerance(void)
+{
+#ifdef CONFIG_SIDEWALK_TIMER_COALESCING
+	struct sid_timespec when = { .tv_sec = 1, .tv_nsec = 0 };
+	struct sid_timespec tolerance = { .tv_sec = 0, .tv_nsec = 100 * SID_TIME_NSEC_PER_MSEC };
+
+	timer_init();
+	TEST_ASSERT_EQUAL(SID_ERROR_INVALID_ARGS,
+			  sid_pal_timer_arm_with_tolerance(p_null_timer, &when, NULL, &tolerance));
+	TEST_ASSERT_EQUAL(SID_ERROR_INVALID_ARGS,
+			  sid_pal_timer_arm_with_tolerance(&test_timer, NULL, NULL, &tolerance));
+	TEST_ASSERT_EQUAL(SID_ERROR_INVALID_ARGS,
+			  sid_pal_timer_arm_with_tolerance(&test_timer, &when, NULL, NULL));
+	TEST_ASSERT_EQUAL(SID_ERROR_INVALID_ARGS,
+			  sid_pal_timer_arm_with_tolerance(&test_timer, &when, NULL,
+							   &(struct sid_timespec){
+								   .tv_nsec = SID_TIME_NSEC_PER_SEC }));
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+			  sid_pal_timer_arm_with_tolerance(&test_timer, &when, NULL, &tolerance));
+	TEST_ASSERT_TRUE(sid_pal_timer_is_armed(&test_timer));
+	TEST_ASSERT_EQUAL_PTR(&tolerance, test_timer.tolerance);
+	TEST_ASSERT_EQUAL(SID_ERROR_INVALID_ARGS,
+			  sid_pal_timer_arm_with_tolerance(&test_timer, &when, NULL, &tolerance));
+	/* The alarm is not moved, the tolerance is applied when scheduling the wakeup. */
+	TEST_ASSERT_EQUAL(when.tv_sec, test_timer.alarm.tv_sec);
+	TEST_ASSERT_EQUAL(when.tv_nsec, test_timer.alarm.tv_nsec);
+	timer_deinit();
+#else
+	TEST_IGNORE_MESSAGE("CONFIG_SIDEWALK_TIMER_COALESCING is disabled");
+#endif /* CONFIG_SIDEWALK_TIMER_COALESCING */
+}
+
+#ifdef CONFIG_SIDEWALK_TIMER_COALESCING
+static void assert_queue_deadline(const struct sid_timespec *expected)
+{
+	sid_timer_queue_time_t deadline;
+
+	sid_timer_queue_deadline(&deadline);
+#ifdef CONFIG_SIDEWALK_TIMER_TICKS
+	if (sid_time_is_infinity(expected)) {
+		TEST_ASSERT_EQUAL_UINT64(UINT64_MAX, deadline);
+	} else {
+		TEST_ASSERT_EQUAL_UINT64((uint64_t)expected->tv_sec * CONFIG_SYS_CLOCK_TICKS_PER_SEC +
+						 k_ns_to_ticks_ceil64(expected->tv_nsec),
+					 deadline);
+	}
+#else
+	TEST_ASSERT_EQUAL(expected->tv_sec, deadline.tv_sec);
+	TEST_ASSERT_EQUAL(expected->tv_nsec, deadline.tv_nsec);
+#endif /* CONFIG_SIDEWALK_TIMER_TICKS */
+}
+
+/* Kernel uptime in @p ms, the hardware timer is started for it. */
+static struct sid_timespec uptime_after_ms(uint32_t ms)
+{
+	int64_t uptime_ms = k_uptime_get() + ms;
+
+	return (struct sid_timespec){ .tv_sec = uptime_ms / MSEC_PER_SEC,
+				      .tv_nsec = (uptime_ms % MSEC_PER_SEC) * NSEC_PER_MSEC };
+}
+#endif /* CONFIG_SIDEWALK_TIMER_COALESCING */
+
+void test_sid_pal_timer_coalescing(void)
+{
+#ifdef CONFIG_SIDEWALK_TIMER_COALESCING
+	static sid_pal_timer_t test_timer_3;
+	struct sid_timespec when_1 = { .tv_sec = 1, .tv_nsec = 0 };
+	struct sid_timespec when_2 = { .tv_sec = 1, .tv_nsec = 50 * SID_TIME_NSEC_PER_MSEC };
+	struct sid_timespec when_3 = { .tv_sec = 1, .tv_nsec = 200 * SID_TIME_NSEC_PER_MSEC };
+	struct sid_timespec tolerance = { .tv_sec = 0, .tv_nsec = 100 * SID_TIME_NSEC_PER_MSEC };
+	struct sid_timespec deadline = when_3;
+
+	timer_init();
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+			  sid_pal_timer_init(&test_timer_2, timer_cb, &test_timer_arg));
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+			  sid_pal_timer_init(&test_timer_3, timer_cb, &test_timer_arg));
+
+	/* Windows: [1.0, 1.1], [1.05, 1.05] and [1.2, 1.3]. */
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+			  sid_pal_timer_arm_with_tolerance(&test_timer, &when_1, NULL, &tolerance));
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+			  sid_pal_timer_arm(&test_timer_2, SID_PAL_TIMER_PRIO_CLASS_PRECISE,
+					    &when_2, NULL));
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+			  sid_pal_timer_arm_with_tolerance(&test_timer_3, &when_3, NULL, &tolerance));
+
+	assert_queue_deadline(&when_2);
+
+	/* A single wakeup handles the first two windows. */
+	sid_pal_timer_event_callback(NULL, &when_2);
+	TEST_ASSERT_EQUAL(2, timer_callback_cnt);
+	TEST_ASSERT_EQUAL(1, sid_timer_coalescing_wakeups_avoided());
+	TEST_ASSERT_TRUE(sid_pal_timer_is_armed(&test_timer_3));
+
+	sid_time_add(&deadline, &tolerance);
+	assert_queue_deadline(&deadline);
+
+	sid_pal_timer_event_callback(NULL, &deadline);
+	TEST_ASSERT_EQUAL(3, timer_callback_cnt);
+	TEST_ASSERT_EQUAL(1, sid_timer_coalescing_wakeups_avoided());
+
+	assert_queue_deadline(&SID_TIME_INFINITY);
+
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_pal_timer_deinit(&test_timer_3));
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_pal_timer_deinit(&test_timer_2));
+	timer_deinit();
+#else
+	TEST_IGNORE_MESSAGE("CONFIG_SIDEWALK_TIMER_COALESCING is disabled");
+#endif /* CONFIG_SIDEWALK_TIMER_COALESCING */
+}
+
+void test_sid_pal_timer_coalescing_cancel(void)
+{
+#ifdef CONFIG_SIDEWALK_TIMER_COALESCING
+	struct sid_timespec when_1 = uptime_after_ms(50);
+	struct sid_timespec when_2 = uptime_after_ms(500);
+	struct sid_timespec tolerance = { .tv_sec = 0, .tv_nsec = 50 * SID_TIME_NSEC_PER_MSEC };
+
+	timer_init();
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+			  sid_pal_timer_init(&test_timer_2, timer_cb, &test_timer_arg));
+
+	/* Windows: [50, 100] and [500, 500] ms from now, the wakeup is set for the first one. */
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+			  sid_pal_timer_arm_with_tolerance(&test_timer, &when_1, NULL, &tolerance));
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+			  sid_pal_timer_arm(&test_timer_2, SID_PAL_TIMER_PRIO_CLASS_PRECISE,
+					    &when_2, NULL));
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_pal_timer_cancel(&test_timer));
+
+	/* The wakeup is moved to the second window, so nothing is handled for 200 ms. */
+	critical_region_enter_cnt = 0;
+	__cmock_sid_pal_enter_critical_region_Stub(critical_region_enter_stub);
+	k_sleep(K_MSEC(200));
+	TEST_ASSERT_EQUAL(0, critical_region_enter_cnt);
+	TEST_ASSERT_EQUAL(0, timer_callback_cnt);
+	TEST_ASSERT_TRUE(sid_pal_timer_is_armed(&test_timer_2));
+
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_pal_timer_deinit(&test_timer_2));
+	timer_deinit();
+#else
+	TEST_IGNORE_MESSAGE("CONFIG_SIDEWALK_TIMER_COALESCING is disabled");
+#endif /* CONFIG_SIDEWALK_TIMER_COALESCING */
+}
+
+void test_sid_pal_timer_coalescing_infinity(void)
+{
+#ifdef CONFIG_SIDEWALK_TIMER_COALESCING
+	struct sid_timespec tolerance = { .tv_sec = 1, .tv_nsec = 0 };
+
+	timer_init();
+	/* The window end saturates instead of wrapping around to an early wakeup. */
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_pal_timer_arm_with_tolerance(
+						  &test_timer, &SID_TIME_INFINITY, NULL, &tolerance));
+	assert_queue_deadline(&SID_TIME_INFINITY);
+	timer_deinit();
+#else
+	TEST_IGNORE_MESSAGE("CONFIG_SIDEWALK_TIMER_COALESCING is disabled");
+#endif /* CONFIG_SIDEWALK_TIMER_COALESCING */
+}
+
 /* It is required to be added to each test. That is because unity is using
  * different main signature (returns int) and zephyr expects main which does
  * not return value.
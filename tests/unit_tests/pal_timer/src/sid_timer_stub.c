@@ -66,3 +66,8 @@ bool sid_time_is_infinity(const struct sid_timespec *time)
 	}
 	return false;
 }
+
+bool sid_time_is_zero(const struct sid_timespec *time)
+{
+	return (time->tv_sec == 0) && (time->tv_nsec == 0);
+}
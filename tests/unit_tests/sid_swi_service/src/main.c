@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <unity.h>
+#include <sid_swi_service.h>
+
+#include <zephyr/kernel.h>
+
+#define CHANNELS CONFIG_SIDEWALK_SWI_CHANNELS
+#define RUN_LOG_SIZE 16
+#define TRIGGER_DELAY_US 500
+
+static uint8_t registered[CHANNELS];
+static uint8_t registered_num;
+
+static uintptr_t run_log[RUN_LOG_SIZE];
+static uint8_t run_log_num;
+
+static void log_callback(void *arg)
+{
+	if (run_log_num < RUN_LOG_SIZE) {
+		run_log[run_log_num++] = (uintptr_t)arg;
+	}
+}
+
+static uint8_t register_channel(uintptr_t id, uint8_t priority)
+{
+	uint8_t channel;
+
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+			  sid_swi_service_register(log_callback, (void *)id, priority, &channel));
+	registered[registered_num++] = channel;
+	return channel;
+}
+
+void setUp(void)
+{
+	registered_num = 0;
+	run_log_num = 0;
+	sid_swi_service_stats_reset();
+}
+
+void tearDown(void)
+{
+	for (uint8_t i = 0; i < registered_num; i++) {
+		sid_swi_service_unregister(registered[i]);
+	}
+}
+
+void test_sid_swi_service_priority_order(void)
+{
+	const uint8_t low = register_channel(1, 2);
+	const uint8_t high = register_channel(2, 0);
+	const uint8_t mid_first = register_channel(3, 1);
+	const uint8_t mid_second = register_channel(4, 1);
+
+	/* The service thread does not run until all channels are pending. */
+	k_sched_lock();
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_swi_service_trigger(low));
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_swi_service_trigger(mid_second));
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_swi_service_trigger(mid_first));
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_swi_service_trigger(high));
+	k_sched_unlock();
+	k_yield();
+
+	TEST_ASSERT_EQUAL(4, run_log_num);
+	TEST_ASSERT_EQUAL(2, run_log[0]);
+	TEST_ASSERT_EQUAL(3, run_log[1]);
+	TEST_ASSERT_EQUAL(4, run_log[2]);
+	TEST_ASSERT_EQUAL(1, run_log[3]);
+}
+
+void test_sid_swi_service_coalesced(void)
+{
+	const uint8_t channel = register_channel(1, 0);
+	struct sid_swi_channel_stats stats;
+
+	k_sched_lock();
+	for (int i = 0; i < 3; i++) {
+		TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_swi_service_trigger(channel));
+	}
+	k_sched_unlock();
+	k_yield();
+
+	TEST_ASSERT_EQUAL(1, run_log_num);
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_swi_service_stats_get(channel, &stats));
+	TEST_ASSERT_EQUAL(3, stats.triggers);
+	TEST_ASSERT_EQUAL(2, stats.coalesced);
+	TEST_ASSERT_EQUAL(1, stats.runs);
+
+	/* Not pending anymore, the next trigger runs the callback again. */
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_swi_service_trigger(channel));
+	k_yield();
+
+	TEST_ASSERT_EQUAL(2, run_log_num);
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_swi_service_stats_get(channel, &stats));
+	TEST_ASSERT_EQUAL(4, stats.triggers);
+	TEST_ASSERT_EQUAL(2, stats.coalesced);
+	TEST_ASSERT_EQUAL(2, stats.runs);
+}
+
+void test_sid_swi_service_latency(void)
+{
+	const uint8_t channel = register_channel(1, 0);
+	struct sid_swi_channel_stats stats;
+
+	k_sched_lock();
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_swi_service_trigger(channel));
+	k_busy_wait(TRIGGER_DELAY_US);
+	/* The latency is measured from the first trigger. */
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_swi_service_trigger(channel));
+	k_sched_unlock();
+	k_yield();
+
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_swi_service_stats_get(channel, &stats));
+	TEST_ASSERT_EQUAL(1, stats.runs);
+	TEST_ASSERT_GREATER_OR_EQUAL_UINT32(TRIGGER_DELAY_US, stats.latency_max_us);
+	TEST_ASSERT_GREATER_OR_EQUAL_UINT64(TRIGGER_DELAY_US, stats.latency_sum_us);
+
+	sid_swi_service_stats_reset();
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_swi_service_stats_get(channel, &stats));
+	TEST_ASSERT_EQUAL(0, stats.triggers);
+	TEST_ASSERT_EQUAL(0, stats.runs);
+	TEST_ASSERT_EQUAL(0, stats.latency_max_us);
+}
+
+void test_sid_swi_service_unregister_pending(void)
+{
+	const uint8_t removed = register_channel(1, 0);
+	const uint8_t kept = register_channel(2, 1);
+
+	k_sched_lock();
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_swi_service_trigger(removed));
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_swi_service_trigger(kept));
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_swi_service_unregister(removed));
+	k_sched_unlock();
+	k_yield();
+
+	TEST_ASSERT_EQUAL(1, run_log_num);
+	TEST_ASSERT_EQUAL(2, run_log[0]);
+	TEST_ASSERT_EQUAL(SID_ERROR_INVALID_ARGS, sid_swi_service_trigger(removed));
+	TEST_ASSERT_EQUAL(SID_ERROR_INVALID_ARGS, sid_swi_service_unregister(removed));
+}
+
+void test_sid_swi_service_invalid_args(void)
+{
+	struct sid_swi_channel_stats stats;
+	uint8_t channel;
+
+	TEST_ASSERT_EQUAL(SID_ERROR_NULL_POINTER,
+			  sid_swi_service_register(NULL, NULL, 0, &channel));
+	TEST_ASSERT_EQUAL(SID_ERROR_NULL_POINTER,
+			  sid_swi_service_register(log_callback, NULL, 0, NULL));
+	TEST_ASSERT_EQUAL(SID_ERROR_INVALID_ARGS, sid_swi_service_trigger(CHANNELS));
+	TEST_ASSERT_EQUAL(SID_ERROR_INVALID_ARGS, sid_swi_service_stats_get(CHANNELS, &stats));
+
+	channel = register_channel(1, 0);
+	TEST_ASSERT_EQUAL(SID_ERROR_NULL_POINTER, sid_swi_service_stats_get(channel, NULL));
+}
+
+void test_sid_swi_service_all_channels(void)
+{
+	uint8_t channel;
+
+	for (uint8_t i = 0; i < CHANNELS; i++) {
+		register_channel(i, 0);
+	}
+	TEST_ASSERT_EQUAL(SID_ERROR_OOM, sid_swi_service_register(log_callback, NULL, 0, &channel));
+
+	/* A released channel can be registered again. */
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE, sid_swi_service_unregister(registered[0]));
+	TEST_ASSERT_EQUAL(SID_ERROR_NONE,
+			  sid_swi_service_register(log_callback, NULL, 0, &registered[0]));
+}
+
+/* It is required to be added to each test. That is because unity is using
+ * different main signature (returns int) and zephyr expects main which does
+ * not return value.
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	return unity_main();
+}
@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <unity.h>
+#include <sid_time_ops_inline.h>
+
+#include <stddef.h>
+
+#define ARRAY_LEN(array) (sizeof(array) / sizeof((array)[0]))
+
+/*
+ * Reference implementation with the behavior of the Sidewalk library,
+ * the inline variant has to give the same results.
+ */
+static void ref_normalize(struct sid_timespec *tm)
+{
+	while (tm->tv_nsec >= SID_TIME_NSEC_PER_SEC) {
+		tm->tv_sec++;
+		tm->tv_nsec -= SID_TIME_NSEC_PER_SEC;
+	}
+}
+
+static bool ref_gt(const struct sid_timespec *tm1, const struct sid_timespec *tm2)
+{
+	return (tm1->tv_sec > tm2->tv_sec) ||
+	       ((tm1->tv_sec == tm2->tv_sec) && (tm1->tv_nsec > tm2->tv_nsec));
+}
+
+static bool ref_eq(const struct sid_timespec *tm1, const struct sid_timespec *tm2)
+{
+	return (tm1->tv_sec == tm2->tv_sec) && (tm1->tv_nsec == tm2->tv_nsec);
+}
+
+/* Returns false when the library would assert. */
+static bool ref_add(struct sid_timespec *tm1, const struct sid_timespec *tm2)
+{
+	struct sid_timespec tmp = *tm2;
+
+	ref_normalize(&tmp);
+	ref_normalize(tm1);
+	if (tm1->tv_sec > ~tmp.tv_sec) {
+		return false;
+	}
+	tm1->tv_sec += tmp.tv_sec;
+	tm1->tv_nsec += tmp.tv_nsec;
+	ref_normalize(tm1);
+	return true;
+}
+
+/* Returns false when the library would assert. */
+static bool ref_sub(struct sid_timespec *tm1, const struct sid_timespec *tm2)
+{
+	struct sid_timespec tmp = *tm2;
+
+	if (ref_gt(tm2, tm1)) {
+		return false;
+	}
+	ref_normalize(&tmp);
+	if (tm1->tv_nsec < tmp.tv_nsec) {
+		tm1->tv_sec--;
+		tm1->tv_nsec += SID_TIME_NSEC_PER_SEC;
+	}
+	tm1->tv_sec -= tmp.tv_sec;
+	tm1->tv_nsec -= tmp.tv_nsec;
+	ref_normalize(tm1);
+	return true;
+}
+
+static const uint32_t test_sec[] = { 0, 1, 2, 999, 4294966, 0x7FFFFFFF, UINT32_MAX - 5,
+				     UINT32_MAX - 1, UINT32_MAX };
+
+static const uint32_t test_nsec[] = { 0,	  1,	      999999,	  1000000,    999999999,
+				      1000000000, 1000000001, 1999999999, 2000000000, 3999999999,
+				      4000000000, 4294967294, UINT32_MAX };
+
+static const uint32_t test_u32[] = { 0,	      1,	  999,	      1000,	  1001,
+				     999999,  1000000,	  1000001,    4294967,	  4294968,
+				     999999999, 1000000000, 2147483647, 4294967294, UINT32_MAX };
+
+static const uint64_t test_u64[] = { 0,
+				     1,
+				     999,
+				     1000,
+				     999999,
+				     1000000,
+				     (uint64_t)UINT32_MAX,
+				     (uint64_t)UINT32_MAX + 1,
+				     4294967295999ULL,
+				     4294967296000ULL,
+				     UINT64_MAX };
+
+#define FOR_EACH_TIMESPEC(var)                                                                     \
+	for (size_t var##_s = 0; var##_s < ARRAY_LEN(test_sec); var##_s++)                         \
+		for (size_t var##_n = 0; var##_n < ARRAY_LEN(test_nsec); var##_n++)                \
+			for (struct sid_timespec var = { .tv_sec = test_sec[var##_s],              \
+							 .tv_nsec = test_nsec[var##_n] },          \
+						 *var##_once = &var;                               \
+			     var##_once; var##_once = NULL)
+
+static void assert_timespec_equal(const struct sid_timespec *expected,
+				  const struct sid_timespec *actual)
+{
+	TEST_ASSERT_EQUAL_UINT32(expected->tv_sec, actual->tv_sec);
+	TEST_ASSERT_EQUAL_UINT32(expected->tv_nsec, actual->tv_nsec);
+}
+
+static uint32_t test_seed = 1;
+
+static uint32_t test_rand(void)
+{
+	test_seed = test_seed * 1664525u + 1013904223u;
+	return test_seed;
+}
+
+void setUp(void)
+{
+	test_seed = 1;
+}
+
+void test_sid_time_ops_inline_div(void)
+{
+	for (size_t i = 0; i < ARRAY_LEN(test_u32); i++) {
+		TEST_ASSERT_EQUAL_UINT32(test_u32[i] / 1000, sid_time_div_1000_inline(test_u32[i]));
+		TEST_ASSERT_EQUAL_UINT32(test_u32[i] / 1000000,
+					 sid_time_div_1000000_inline(test_u32[i]));
+		TEST_ASSERT_EQUAL_UINT32(test_u32[i] / 1000000000,
+					 sid_time_div_nsec_per_sec_inline(test_u32[i]));
+	}
+
+	for (uint32_t i = 0; i < 1000000; i++) {
+		uint32_t value = test_rand();
+
+		TEST_ASSERT_EQUAL_UINT32(value / 1000, sid_time_div_1000_inline(value));
+		TEST_ASSERT_EQUAL_UINT32(value / 1000000, sid_time_div_1000000_inline(value));
+		TEST_ASSERT_EQUAL_UINT32(value / 1000000000, sid_time_div_nsec_per_sec_inline(value));
+	}
+}
+
+/*
+ * The inline divisions are monotonic, so a quotient is right for every dividend
+ * in [q * divisor, (q + 1) * divisor - 1] when it is right at both ends of the range.
+ * Checking the ends of every range covers all 32-bit dividends.
+ */
+static void assert_div_exhaustive(uint32_t divisor, uint32_t (*div)(uint32_t))
+{
+	for (uint64_t first = 0; first <= UINT32_MAX; first += divisor) {
+		uint64_t last = first + divisor - 1;
+
+		if (last > UINT32_MAX) {
+			last = UINT32_MAX;
+		}
+		if ((div((uint32_t)first) != first / divisor) ||
+		    (div((uint32_t)last) != last / divisor)) {
+			TEST_FAIL_MESSAGE("Wrong quotient");
+		}
+	}
+}
+
+void test_sid_time_ops_inline_div_exhaustive(void)
+{
+	assert_div_exhaustive(1000, sid_time_div_1000_inline);
+	assert_div_exhaustive(1000000, sid_time_div_1000000_inline);
+	assert_div_exhaustive(1000000000, sid_time_div_nsec_per_sec_inline);
+}
+
+void test_sid_time_ops_inline_compare(void)
+{
+	FOR_EACH_TIMESPEC(tm1)
+	{
+		FOR_EACH_TIMESPEC(tm2)
+		{
+			TEST_ASSERT_EQUAL(ref_gt(&tm1, &tm2), sid_time_gt_inline(&tm1, &tm2));
+			TEST_ASSERT_EQUAL(!ref_gt(&tm1, &tm2) && !ref_eq(&tm1, &tm2),
+					  sid_time_lt_inline(&tm1, &tm2));
+			TEST_ASSERT_EQUAL(ref_eq(&tm1, &tm2), sid_time_eq_inline(&tm1, &tm2));
+		}
+		TEST_ASSERT_EQUAL(ref_eq(&tm1, &SID_TIME_INFINITY), sid_time_is_infinity_inline(&tm1));
+		TEST_ASSERT_EQUAL(ref_eq(&tm1, &SID_TIME_ZERO), sid_time_is_zero_inline(&tm1));
+	}
+}
+
+void test_sid_time_ops_inline_normalize(void)
+{
+	FOR_EACH_TIMESPEC(tm)
+	{
+		struct sid_timespec expected = tm;
+
+		ref_normalize(&expected);
+		sid_time_normalize_inline(&tm);
+		assert_timespec_equal(&expected, &tm);
+	}
+}
+
+void test_sid_time_ops_inline_add_sub(void)
+{
+	uint32_t checked = 0;
+
+	FOR_EACH_TIMESPEC(tm1)
+	{
+		FOR_EACH_TIMESPEC(tm2)
+		{
+			struct sid_timespec expected = tm1;
+			struct sid_timespec actual = tm1;
+
+			if (ref_add(&expected, &tm2)) {
+				sid_time_add_inline(&actual, &tm2);
+				assert_timespec_equal(&expected, &actual);
+				checked++;
+			}
+
+			expected = tm1;
+			actual = tm1;
+			if (ref_sub(&expected, &tm2)) {
+				sid_time_sub_inline(&actual, &tm2);
+				assert_timespec_equal(&expected, &actual);
+
+				sid_time_delta_inline(&actual, &tm1, &tm2);
+				assert_timespec_equal(&expected, &actual);
+				checked++;
+			}
+		}
+	}
+
+	/* Make sure the edge cases have not all been skipped as asserting. */
+	TEST_ASSERT_GREATER_THAN_UINT32(10000, checked);
+}
+
+void test_sid_time_ops_inline_timespec_to_units(void)
+{
+	FOR_EACH_TIMESPEC(tm)
+	{
+		TEST_ASSERT_EQUAL_UINT32(tm.tv_sec * 1000u + tm.tv_nsec / 1000000u,
+					 sid_timespec_to_ms_inline(&tm));
+		TEST_ASSERT_EQUAL_UINT64((uint64_t)tm.tv_sec * 1000u + tm.tv_nsec / 1000000u,
+					 sid_timespec_to_ms_64_inline(&tm));
+		TEST_ASSERT_EQUAL_UINT32(tm.tv_sec * 1000000u + tm.tv_nsec / 1000u,
+					 sid_timespec_to_us_inline(&tm));
+		TEST_ASSERT_EQUAL_UINT64((uint64_t)tm.tv_sec * 1000000u + tm.tv_nsec / 1000u,
+					 sid_timespec_to_us_64_inline(&tm));
+	}
+}
+
+void test_sid_time_ops_inline_units_to_timespec(void)
+{
+	struct sid_timespec actual;
+
+	for (size_t i = 0; i < ARRAY_LEN(test_u32); i++) {
+		const uint32_t value = test_u32[i];
+		const struct sid_timespec from_ms = { .tv_sec = value / 1000,
+						      .tv_nsec = (value % 1000) * 1000000 };
+		const struct sid_timespec from_us = { .tv_sec = value / 1000000,
+						      .tv_nsec = (value % 1000000) * 1000 };
+
+		sid_ms_to_timespec_inline(value, &actual);
+		assert_timespec_equal(&from_ms, &actual);
+		actual = sid_ms_to_timespec_ret_inline(value);
+		assert_timespec_equal(&from_ms, &actual);
+		sid_us_to_timespec_inline(value, &actual);
+		assert_timespec_equal(&from_us, &actual);
+	}
+
+	for (size_t i = 0; i < ARRAY_LEN(test_u64); i++) {
+		const uint64_t value = test_u64[i];
+		const struct sid_timespec from_ms = {
+			.tv_sec = (uint32_t)(value / 1000),
+			.tv_nsec = (uint32_t)(value % 1000) * 1000000
+		};
+		const struct sid_timespec from_us = {
+			.tv_sec = (uint32_t)(value / 1000000),
+			.tv_nsec = (uint32_t)(value % 1000000) * 1000
+		};
+
+		sid_ms_to_timespec_64_inline(value, &actual);
+		assert_timespec_equal(&from_ms, &actual);
+		sid_us_to_timespec_64_inline(value, &actual);
+		assert_timespec_equal(&from_us, &actual);
+	}
+}
+
+void test_sid_time_ops_inline_ms_arithmetic(void)
+{
+	FOR_EACH_TIMESPEC(tm)
+	{
+		for (size_t i = 0; i < ARRAY_LEN(test_u32); i++) {
+			const uint32_t ms = test_u32[i];
+			const struct sid_timespec ms_time = { .tv_sec = ms / 1000,
+							      .tv_nsec = (ms % 1000) * 1000000 };
+			uint32_t nsec = ms_time.tv_nsec + tm.tv_nsec;
+			const struct sid_timespec expected_ret = {
+				.tv_sec = tm.tv_sec + ms_time.tv_sec + nsec / SID_TIME_NSEC_PER_SEC,
+				.tv_nsec = nsec % SID_TIME_NSEC_PER_SEC
+			};
+			struct sid_timespec expected = tm;
+			struct sid_timespec actual = sid_add_ms_to_timespec_ret_inline(tm, ms);
+
+			assert_timespec_equal(&expected_ret, &actual);
+
+			actual = tm;
+			if (ref_add(&expected, &ms_time)) {
+				sid_add_ms_to_timespec_inline(&actual, ms);
+				assert_timespec_equal(&expected, &actual);
+			}
+
+			expected = tm;
+			actual = tm;
+			if (ref_sub(&expected, &ms_time)) {
+				sid_sub_ms_from_timespec_inline(&actual, ms);
+				assert_timespec_equal(&expected, &actual);
+			}
+		}
+	}
+}
+
+/* It is required to be added to each test. That is because unity is using
+ * different main signature (returns int) and zephyr expects main which does
+ * not return value.
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	return unity_main();
+}
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sid_pal_critical_region_ifc.h>
+#include <sid_critical_region_lock.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/ztest.h>
+
+#if defined(CONFIG_ARCH_POSIX) && defined(CONFIG_EXTERNAL_LIBC)
+/* The simulated time does not advance while the code runs, so the host clock is used. */
+#include <time.h>
+#define BENCH_HOST_CLOCK 1
+#define BENCH_UNIT "ns"
+#else
+#define BENCH_UNIT "cyc"
+#endif
+
+#define BENCH_OPS 10000
+#define BENCH_THREADS 3
+#define BENCH_THREAD_OPS 2000
+#define BENCH_THREAD_STACK_SIZE 1024
+#define BENCH_HOLD_US 200
+#define BENCH_LATENCY_ROUNDS 10
+
+SID_REGION_LOCK_DEFINE(bench_lock);
+static struct sid_region_lock bench_thread_locks[BENCH_THREADS];
+
+static volatile uint32_t bench_shared;
+static volatile uint32_t bench_isr_cycles;
+
+K_THREAD_STACK_ARRAY_DEFINE(bench_stacks, BENCH_THREADS, BENCH_THREAD_STACK_SIZE);
+static struct k_thread bench_threads[BENCH_THREADS];
+
+static const char *bench_backend(void)
+{
+	if (IS_ENABLED(CONFIG_SIDEWALK_CRITICAL_REGION_SPINLOCK)) {
+		return "spinlock";
+	}
+	if (IS_ENABLED(CONFIG_SIDEWALK_CRITICAL_REGION_PRIORITY_THRESHOLD)) {
+		return "priority threshold";
+	}
+	return "irq_lock";
+}
+
+static timing_t bench_now(void)
+{
+#ifdef BENCH_HOST_CLOCK
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (timing_t)now.tv_sec * NSEC_PER_SEC + now.tv_nsec;
+#else
+	return timing_counter_get();
+#endif /* BENCH_HOST_CLOCK */
+}
+
+/* Cost of one operation in BENCH_UNIT. */
+static uint64_t bench_per_op(timing_t start, timing_t end, uint32_t ops)
+{
+#ifdef BENCH_HOST_CLOCK
+	return (end - start) / ops;
+#else
+	return timing_cycles_get(&start, &end) / ops;
+#endif /* BENCH_HOST_CLOCK */
+}
+
+ZTEST(critical_region_benchmark, test_uncontended_cost)
+{
+	timing_t start, end;
+	uint64_t region, nested, scoped;
+
+	start = bench_now();
+	for (uint32_t i = 0; i < BENCH_OPS; i++) {
+		sid_pal_enter_critical_region();
+		bench_shared++;
+		sid_pal_exit_critical_region();
+	}
+	end = bench_now();
+	region = bench_per_op(start, end, BENCH_OPS);
+
+	sid_pal_enter_critical_region();
+	start = bench_now();
+	for (uint32_t i = 0; i < BENCH_OPS; i++) {
+		sid_pal_enter_critical_region();
+		bench_shared++;
+		sid_pal_exit_critical_region();
+	}
+	end = bench_now();
+	sid_pal_exit_critical_region();
+	nested = bench_per_op(start, end, BENCH_OPS);
+
+	start = bench_now();
+	for (uint32_t i = 0; i < BENCH_OPS; i++) {
+		SID_REGION_LOCKED(&bench_lock)
+		{
+			bench_shared++;
+		}
+	}
+	end = bench_now();
+	scoped = bench_per_op(start, end, BENCH_OPS);
+
+	TC_PRINT("backend: %s region: %llu " BENCH_UNIT "/op nested: %llu " BENCH_UNIT
+		 "/op scoped lock: %llu " BENCH_UNIT "/op\n",
+		 bench_backend(), region, nested, scoped);
+}
+
+static void bench_region_thread(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	for (uint32_t i = 0; i < BENCH_THREAD_OPS; i++) {
+		sid_pal_enter_critical_region();
+		bench_shared++;
+		sid_pal_exit_critical_region();
+		if (!(i % 64)) {
+			k_yield();
+		}
+	}
+}
+
+static void bench_scoped_thread(void *arg1, void *arg2, void *arg3)
+{
+	struct sid_region_lock *lock = arg1;
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	for (uint32_t i = 0; i < BENCH_THREAD_OPS; i++) {
+		SID_REGION_LOCKED(lock)
+		{
+			bench_shared++;
+		}
+		if (!(i % 64)) {
+			k_yield();
+		}
+	}
+}
+
+static uint64_t bench_threads_run(k_thread_entry_t entry, bool own_lock)
+{
+	timing_t start, end;
+
+	start = bench_now();
+	for (int i = 0; i < BENCH_THREADS; i++) {
+		k_thread_create(&bench_threads[i], bench_stacks[i],
+				K_THREAD_STACK_SIZEOF(bench_stacks[i]), entry,
+				own_lock ? &bench_thread_locks[i] : &bench_lock, NULL, NULL,
+				K_PRIO_PREEMPT(10), 0, K_NO_WAIT);
+	}
+	for (int i = 0; i < BENCH_THREADS; i++) {
+		zassert_equal(0, k_thread_join(&bench_threads[i], K_SECONDS(10)));
+	}
+	end = bench_now();
+
+	return bench_per_op(start, end, BENCH_THREADS * BENCH_THREAD_OPS);
+}
+
+ZTEST(critical_region_benchmark, test_contended_cost)
+{
+	uint64_t region, shared_lock, own_lock;
+	uint32_t expected;
+
+	bench_shared = 0;
+	region = bench_threads_run(bench_region_thread, false);
+	shared_lock = bench_threads_run(bench_scoped_thread, false);
+	expected = 2 * BENCH_THREADS * BENCH_THREAD_OPS;
+	zassert_equal(expected, bench_shared, "lost updates: %u of %u", bench_shared, expected);
+
+	/* Separate locks protect separate data, only the cost is measured. */
+	own_lock = bench_threads_run(bench_scoped_thread, true);
+
+	TC_PRINT("backend: %s threads: %u region: %llu " BENCH_UNIT "/op shared lock: %llu "
+		 BENCH_UNIT "/op own lock: %llu " BENCH_UNIT "/op\n",
+		 bench_backend(), BENCH_THREADS, region, shared_lock, own_lock);
+}
+
+static void bench_timer_isr(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+	bench_isr_cycles = k_cycle_get_32();
+}
+
+K_TIMER_DEFINE(bench_timer, bench_timer_isr, NULL);
+
+ZTEST(critical_region_benchmark, test_interrupt_latency)
+{
+	uint32_t latency_max = 0;
+	uint64_t latency_sum = 0;
+
+	/* The timer expires in the middle of the region, the ISR runs when it is allowed to. */
+	for (uint32_t i = 0; i < BENCH_LATENCY_ROUNDS; i++) {
+		uint32_t expiry, latency;
+
+		k_sleep(K_TICKS(1));
+		bench_isr_cycles = 0;
+		expiry = k_cycle_get_32() + k_us_to_cyc_ceil32(BENCH_HOLD_US / 2);
+		k_timer_start(&bench_timer, K_USEC(BENCH_HOLD_US / 2), K_NO_WAIT);
+
+		sid_pal_enter_critical_region();
+		k_busy_wait(BENCH_HOLD_US);
+		sid_pal_exit_critical_region();
+
+		zassert_equal(1, k_timer_status_sync(&bench_timer));
+		latency = (int32_t)(bench_isr_cycles - expiry) > 0 ? bench_isr_cycles - expiry : 0;
+		latency_max = MAX(latency_max, latency);
+		latency_sum += latency;
+	}
+
+	TC_PRINT("backend: %s hold: %u us irq latency: avg %u us max %u us\n", bench_backend(),
+		 BENCH_HOLD_US, k_cyc_to_us_floor32(latency_sum / BENCH_LATENCY_ROUNDS),
+		 k_cyc_to_us_floor32(latency_max));
+}
+
+static void *bench_setup(void)
+{
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+static void bench_teardown(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	timing_stop();
+}
+
+ZTEST_SUITE(critical_region_benchmark, NULL, bench_setup, NULL, NULL, bench_teardown);
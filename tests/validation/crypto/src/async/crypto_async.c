@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sid_pal_crypto_ifc.h>
+#include <sid_crypto_async.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <string.h>
+
+#define P256_PRK_SIZE 32
+#define P256_PUK_SIZE 64
+#define P256_SIGNATURE_SIZE 64
+
+/* Events are sent every millisecond while the signature is calculated. */
+#define EVENT_PERIOD_MS 1
+#define EVENT_QUEUE_SIZE 8
+#define EVENT_LATENCY_MAX_US 2000
+#define SIGN_TIMEOUT_MS 5000
+
+#define EVENT_THREAD_PRIORITY K_PRIO_PREEMPT(2)
+
+K_MSGQ_DEFINE(event_msgq, sizeof(uint32_t), EVENT_QUEUE_SIZE, 4);
+static uint32_t event_latency_max_us;
+static uint32_t event_count;
+
+static K_SEM_DEFINE(async_done_sem, 0, CONFIG_SIDEWALK_CRYPTO_ASYNC_QUEUE_SIZE);
+static sid_error_t async_result;
+
+static uint8_t prk[P256_PRK_SIZE];
+static uint8_t puk[P256_PUK_SIZE];
+static uint8_t message[128];
+static uint8_t signature[P256_SIGNATURE_SIZE];
+
+/* The thread stands for the Sidewalk event thread, it has to stay responsive. */
+static void event_task(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	uint32_t sent_cycles;
+
+	while (1) {
+		k_msgq_get(&event_msgq, &sent_cycles, K_FOREVER);
+		uint32_t latency_us = k_cyc_to_us_floor32(k_cycle_get_32() - sent_cycles);
+
+		event_latency_max_us = MAX(event_latency_max_us, latency_us);
+		event_count++;
+	}
+}
+
+K_THREAD_DEFINE(event_thread, 1024, event_task, NULL, NULL, NULL, EVENT_THREAD_PRIORITY, 0, 0);
+
+static void async_done(sid_error_t result, void *ctx)
+{
+	ARG_UNUSED(ctx);
+
+	async_result = result;
+	k_sem_give(&async_done_sem);
+}
+
+static sid_pal_dsa_params_t sign_params(void)
+{
+	return (sid_pal_dsa_params_t){
+		.algo = SID_PAL_ECDSA_SECP256R1,
+		.mode = SID_PAL_CRYPTO_SIGN,
+		.key = prk,
+		.key_size = sizeof(prk),
+		.in = message,
+		.in_size = sizeof(message),
+		.signature = signature,
+		.sig_size = sizeof(signature),
+	};
+}
+
+ZTEST(crypto_async, test_ecc_dsa_async_event_latency)
+{
+	sid_pal_dsa_params_t params = sign_params();
+	uint32_t start_ms = k_uptime_get_32();
+	uint32_t events_sent = 0;
+	uint32_t now_cycles;
+
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_crypto_ecc_dsa_async(&params, async_done, NULL));
+
+	while (k_sem_take(&async_done_sem, K_NO_WAIT)) {
+		zassert_true(k_uptime_get_32() - start_ms < SIGN_TIMEOUT_MS, "sign timeout");
+		now_cycles = k_cycle_get_32();
+		zassert_equal(0, k_msgq_put(&event_msgq, &now_cycles, K_NO_WAIT));
+		events_sent++;
+		k_msleep(EVENT_PERIOD_MS);
+	}
+	zassert_equal(SID_ERROR_NONE, async_result);
+
+	/* Wait for the last event. */
+	k_msleep(EVENT_PERIOD_MS);
+	TC_PRINT("P-256 sign: %u ms, %u events, max latency %u us\n",
+		 k_uptime_get_32() - start_ms, event_count, event_latency_max_us);
+	zassert_equal(events_sent, event_count);
+	zassert_true(event_latency_max_us < EVENT_LATENCY_MAX_US, "latency %u us",
+		     event_latency_max_us);
+
+	/* The signature is the same as from the synchronous variant, so it verifies. */
+	params.mode = SID_PAL_CRYPTO_VERIFY;
+	params.key = puk;
+	params.key_size = sizeof(puk);
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_ecc_dsa(&params));
+}
+
+ZTEST(crypto_async, test_ecc_async_queue_full)
+{
+	sid_pal_dsa_params_t params = sign_params();
+
+	/* The worker has a lower priority, so it does not take a request before the test waits. */
+	for (int i = 0; i < CONFIG_SIDEWALK_CRYPTO_ASYNC_QUEUE_SIZE; i++) {
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_crypto_ecc_dsa_async(&params, async_done, NULL));
+	}
+	zassert_equal(SID_ERROR_BUSY, sid_pal_crypto_ecc_dsa_async(&params, async_done, NULL));
+
+	for (int i = 0; i < CONFIG_SIDEWALK_CRYPTO_ASYNC_QUEUE_SIZE; i++) {
+		zassert_equal(0, k_sem_take(&async_done_sem, K_MSEC(SIGN_TIMEOUT_MS)));
+		zassert_equal(SID_ERROR_NONE, async_result);
+	}
+}
+
+ZTEST(crypto_async, test_ecc_async_invalid_args)
+{
+	sid_pal_dsa_params_t dsa_params = sign_params();
+	sid_pal_ecdh_params_t ecdh_params = { 0 };
+	sid_pal_ecc_key_gen_params_t key_params = { 0 };
+
+	zassert_equal(SID_ERROR_NULL_POINTER,
+		      sid_pal_crypto_ecc_dsa_async(NULL, async_done, NULL));
+	zassert_equal(SID_ERROR_NULL_POINTER, sid_pal_crypto_ecc_dsa_async(&dsa_params, NULL, NULL));
+	zassert_equal(SID_ERROR_NULL_POINTER, sid_pal_crypto_ecc_ecdh_async(&ecdh_params, NULL, NULL));
+	zassert_equal(SID_ERROR_NULL_POINTER,
+		      sid_pal_crypto_ecc_key_gen_async(&key_params, NULL, NULL));
+
+	/* Invalid parameters are reported with the callback. */
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_crypto_ecc_ecdh_async(&ecdh_params, async_done, NULL));
+	zassert_equal(0, k_sem_take(&async_done_sem, K_MSEC(SIGN_TIMEOUT_MS)));
+	zassert_equal(SID_ERROR_NULL_POINTER, async_result);
+}
+
+ZTEST(crypto_async, test_ecc_key_gen_async)
+{
+	uint8_t new_prk[P256_PRK_SIZE] = { 0 };
+	uint8_t new_puk[P256_PUK_SIZE] = { 0 };
+	uint8_t zeros[P256_PUK_SIZE] = { 0 };
+	sid_pal_ecc_key_gen_params_t key_params = {
+		.algo = SID_PAL_ECDSA_SECP256R1,
+		.prk = new_prk,
+		.prk_size = sizeof(new_prk),
+		.puk = new_puk,
+		.puk_size = sizeof(new_puk),
+	};
+
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_crypto_ecc_key_gen_async(&key_params, async_done, NULL));
+	zassert_equal(0, k_sem_take(&async_done_sem, K_MSEC(SIGN_TIMEOUT_MS)));
+	zassert_equal(SID_ERROR_NONE, async_result);
+	zassert_true(memcmp(zeros, new_puk, sizeof(new_puk)));
+}
+
+static void *crypto_async_setup(void)
+{
+	for (uint32_t i = 0; i < sizeof(message); i++) {
+		message[i] = i;
+	}
+
+	return NULL;
+}
+
+static void crypto_async_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	sid_pal_ecc_key_gen_params_t key_params = {
+		.algo = SID_PAL_ECDSA_SECP256R1,
+		.prk = prk,
+		.prk_size = sizeof(prk),
+		.puk = puk,
+		.puk_size = sizeof(puk),
+	};
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_init());
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_ecc_key_gen(&key_params));
+
+	k_sem_reset(&async_done_sem);
+	k_msgq_purge(&event_msgq);
+	event_latency_max_us = 0;
+	event_count = 0;
+}
+
+static void crypto_async_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_deinit());
+}
+
+ZTEST_SUITE(crypto_async, NULL, crypto_async_setup, crypto_async_before, crypto_async_after,
+	    NULL);
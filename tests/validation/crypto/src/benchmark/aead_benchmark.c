@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sid_pal_crypto_ifc.h>
+#include <sid_crypto_batch.h>
+#ifdef CONFIG_SIDEWALK_CRYPTO_KEY_CACHE
+#include <sid_crypto_key_cache.h>
+#endif /* CONFIG_SIDEWALK_CRYPTO_KEY_CACHE */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/ztest.h>
+#include <string.h>
+
+#define BENCH_FRAMES 200
+#define BENCH_FRAME_SIZE 48
+#define BENCH_AAD_SIZE 16
+#define BENCH_IV_SIZE 12
+#define BENCH_MAC_SIZE 16
+/* More keys than cached, so the rotation always misses. */
+#define BENCH_KEYS 5
+
+static uint8_t bench_keys[BENCH_KEYS][16];
+static uint8_t bench_iv[BENCH_IV_SIZE];
+static uint8_t bench_aad[BENCH_AAD_SIZE];
+static uint8_t bench_plain[BENCH_FRAME_SIZE];
+static uint8_t bench_cipher[BENCH_FRAME_SIZE];
+static uint8_t bench_decrypted[BENCH_FRAME_SIZE];
+static uint8_t bench_mac[BENCH_MAC_SIZE];
+
+/* Frames encrypted in place, as a batch or one by one. */
+#define BENCH_BATCH 16
+#define BENCH_BATCH_ROUNDS 12
+#define BENCH_BATCH_FRAME_MAX 255
+
+static const size_t bench_batch_sizes[] = { 20, 64, 128, 255 };
+static uint8_t bench_batch_frames[BENCH_BATCH][BENCH_BATCH_FRAME_MAX];
+static uint8_t bench_batch_macs[BENCH_BATCH][BENCH_MAC_SIZE];
+static sid_pal_aead_params_t bench_batch_params[BENCH_BATCH];
+
+static sid_error_t bench_aead(sid_pal_aes_mode_t mode, const uint8_t *key, const uint8_t *in,
+			      uint8_t *out)
+{
+	sid_pal_aead_params_t params = {
+		.algo = SID_PAL_AEAD_GCM_128,
+		.mode = mode,
+		.key = key,
+		.key_size = 128,
+		.iv = bench_iv,
+		.iv_size = sizeof(bench_iv),
+		.aad = bench_aad,
+		.aad_size = sizeof(bench_aad),
+		.in = in,
+		.in_size = BENCH_FRAME_SIZE,
+		.out = out,
+		.out_size = BENCH_FRAME_SIZE,
+		.mac = bench_mac,
+		.mac_size = sizeof(bench_mac),
+	};
+
+	return sid_pal_crypto_aead_crypt(&params);
+}
+
+static void bench_roundtrip(const uint8_t *key)
+{
+	zassert_equal(SID_ERROR_NONE,
+		      bench_aead(SID_PAL_CRYPTO_ENCRYPT, key, bench_plain, bench_cipher));
+	zassert_equal(SID_ERROR_NONE,
+		      bench_aead(SID_PAL_CRYPTO_DECRYPT, key, bench_cipher, bench_decrypted));
+	zassert_mem_equal(bench_plain, bench_decrypted, sizeof(bench_plain));
+}
+
+/* Returns the average cost of an encrypted frame in ns. */
+static uint64_t bench_frames(uint32_t keys)
+{
+	timing_t start, end;
+
+	start = timing_counter_get();
+	for (uint32_t i = 0; i < BENCH_FRAMES; i++) {
+		zassert_equal(SID_ERROR_NONE, bench_aead(SID_PAL_CRYPTO_ENCRYPT,
+							 bench_keys[i % keys], bench_plain,
+							 bench_cipher));
+	}
+	end = timing_counter_get();
+
+	return timing_cycles_to_ns(timing_cycles_get(&start, &end)) / BENCH_FRAMES;
+}
+
+static void bench_print_stats(void)
+{
+#ifdef CONFIG_SIDEWALK_CRYPTO_KEY_CACHE
+	struct sid_crypto_key_cache_stats stats;
+
+	sid_crypto_key_cache_stats_get(&stats);
+	TC_PRINT("key cache: hits %u misses %u evictions %u\n", stats.hits, stats.misses,
+		 stats.evictions);
+	sid_crypto_key_cache_stats_reset();
+#endif /* CONFIG_SIDEWALK_CRYPTO_KEY_CACHE */
+}
+
+ZTEST(crypto_aead_benchmark, test_aead_roundtrip)
+{
+	for (uint32_t i = 0; i < BENCH_KEYS; i++) {
+		bench_roundtrip(bench_keys[i]);
+	}
+	/* Cached keys are used again. */
+	for (uint32_t i = 0; i < BENCH_KEYS; i++) {
+		bench_roundtrip(bench_keys[i]);
+	}
+}
+
+ZTEST(crypto_aead_benchmark, test_aead_frame_cost)
+{
+	TC_PRINT("key cache: %s\n",
+		 IS_ENABLED(CONFIG_SIDEWALK_CRYPTO_KEY_CACHE) ? "enabled" : "disabled");
+
+	TC_PRINT("GCM %u B frame, 1 key:  %llu ns/frame\n", BENCH_FRAME_SIZE, bench_frames(1));
+	bench_print_stats();
+
+	TC_PRINT("GCM %u B frame, %u keys: %llu ns/frame\n", BENCH_FRAME_SIZE, BENCH_KEYS,
+		 bench_frames(BENCH_KEYS));
+	bench_print_stats();
+}
+
+static void bench_batch_prepare(size_t frame_size)
+{
+	for (uint32_t i = 0; i < BENCH_BATCH; i++) {
+		bench_batch_params[i] = (sid_pal_aead_params_t){
+			.algo = SID_PAL_AEAD_GCM_128,
+			.mode = SID_PAL_CRYPTO_ENCRYPT,
+			.key = bench_keys[0],
+			.key_size = 128,
+			.iv = bench_iv,
+			.iv_size = sizeof(bench_iv),
+			.aad = bench_aad,
+			.aad_size = sizeof(bench_aad),
+			.in = bench_batch_frames[i],
+			.in_size = frame_size,
+			.out = bench_batch_frames[i],
+			.out_size = frame_size,
+			.mac = bench_batch_macs[i],
+			.mac_size = BENCH_MAC_SIZE,
+		};
+	}
+}
+
+/* Returns the number of frames per second. */
+static uint32_t bench_batch_rate(bool batch)
+{
+	const uint32_t frames = BENCH_BATCH * BENCH_BATCH_ROUNDS;
+	timing_t start, end;
+	uint64_t ns;
+	size_t processed;
+
+	start = timing_counter_get();
+	for (uint32_t round = 0; round < BENCH_BATCH_ROUNDS; round++) {
+		if (batch) {
+			zassert_equal(SID_ERROR_NONE,
+				      sid_pal_crypto_aead_crypt_batch(bench_batch_params,
+								      BENCH_BATCH, &processed));
+			continue;
+		}
+		for (uint32_t i = 0; i < BENCH_BATCH; i++) {
+			zassert_equal(SID_ERROR_NONE,
+				      sid_pal_crypto_aead_crypt(&bench_batch_params[i]));
+		}
+	}
+	end = timing_counter_get();
+
+	ns = timing_cycles_to_ns(timing_cycles_get(&start, &end));
+	return ns ? (uint32_t)((uint64_t)frames * NSEC_PER_SEC / ns) : 0;
+}
+
+ZTEST(crypto_aead_benchmark, test_aead_batch_throughput)
+{
+	TC_PRINT("GCM in place, batch of %u frames\n", BENCH_BATCH);
+	for (size_t i = 0; i < ARRAY_SIZE(bench_batch_sizes); i++) {
+		uint32_t single_rate, batch_rate;
+
+		bench_batch_prepare(bench_batch_sizes[i]);
+		single_rate = bench_batch_rate(false);
+		batch_rate = bench_batch_rate(true);
+		TC_PRINT("%3zu B frame: single %6u frames/s, batch %6u frames/s\n",
+			 bench_batch_sizes[i], single_rate, batch_rate);
+	}
+	bench_print_stats();
+}
+
+#ifdef CONFIG_SIDEWALK_CRYPTO_KEY_CACHE
+ZTEST(crypto_aead_benchmark, test_aead_key_cache_hits)
+{
+	struct sid_crypto_key_cache_stats stats;
+
+	bench_frames(1);
+	sid_crypto_key_cache_stats_get(&stats);
+	zassert_equal(1, stats.misses);
+	zassert_equal(BENCH_FRAMES - 1, stats.hits);
+}
+
+ZTEST(crypto_aead_benchmark, test_aead_key_cache_invalidate)
+{
+	struct sid_crypto_key_cache_stats stats;
+
+	bench_roundtrip(bench_keys[0]);
+	sid_crypto_key_cache_invalidate_key(bench_keys[0], sizeof(bench_keys[0]));
+	bench_roundtrip(bench_keys[0]);
+	sid_crypto_key_cache_invalidate();
+	bench_roundtrip(bench_keys[0]);
+
+	/* Encrypt and decrypt keys are imported again after every invalidation. */
+	sid_crypto_key_cache_stats_get(&stats);
+	zassert_equal(6, stats.misses);
+	zassert_equal(0, stats.hits);
+	zassert_equal(0, stats.evictions);
+}
+#endif /* CONFIG_SIDEWALK_CRYPTO_KEY_CACHE */
+
+static void *aead_bench_setup(void)
+{
+	timing_init();
+
+	for (uint32_t i = 0; i < BENCH_KEYS; i++) {
+		memset(bench_keys[i], 0xA0 + i, sizeof(bench_keys[i]));
+	}
+	memset(bench_iv, 0x5A, sizeof(bench_iv));
+	memset(bench_aad, 0x3C, sizeof(bench_aad));
+	for (uint32_t i = 0; i < sizeof(bench_plain); i++) {
+		bench_plain[i] = i;
+	}
+
+	return NULL;
+}
+
+static void aead_bench_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_init());
+	timing_start();
+#ifdef CONFIG_SIDEWALK_CRYPTO_KEY_CACHE
+	sid_crypto_key_cache_stats_reset();
+#endif /* CONFIG_SIDEWALK_CRYPTO_KEY_CACHE */
+}
+
+static void aead_bench_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	timing_stop();
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_deinit());
+}
+
+ZTEST_SUITE(crypto_aead_benchmark, NULL, aead_bench_setup, aead_bench_before, aead_bench_after,
+	    NULL);
@@ -0,0 +1,588 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Cost of every sid_pal_crypto primitive. Every result is printed as one JSON
+ * object per line, so the logs of different boards, crypto backends and SDK
+ * versions can be compared with scripts/ci/compare_crypto_benchmarks.py.
+ */
+
+#include <sid_pal_crypto_ifc.h>
+#include <sid_crypto_batch.h>
+#include <sid_crypto_stream.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/ztest.h>
+#include <string.h>
+
+#if defined(CONFIG_PSA_CRYPTO_DRIVER_CRACEN)
+#define BENCH_BACKEND "cracen"
+#elif defined(CONFIG_PSA_CRYPTO_DRIVER_CC3XX) && defined(CONFIG_HAS_HW_NRF_CC312)
+#define BENCH_BACKEND "cc312"
+#elif defined(CONFIG_PSA_CRYPTO_DRIVER_CC3XX) && defined(CONFIG_HAS_HW_NRF_CC310)
+#define BENCH_BACKEND "cc310"
+#elif defined(CONFIG_PSA_CRYPTO_DRIVER_OBERON)
+#define BENCH_BACKEND "oberon"
+#else
+#define BENCH_BACKEND "unknown"
+#endif
+
+#define BENCH_SIZE_MAX 1024
+/* Symmetric operations run until about this many bytes are processed. */
+#define BENCH_BYTES 16384
+#define BENCH_OPS_MIN 16
+#define BENCH_OPS_MAX 256
+#define BENCH_ECC_OPS 4
+/* Hash and HMAC of large inputs, e.g. a DFU image. */
+#define BENCH_LARGE_SIZE_MAX KB(64)
+#define BENCH_LARGE_BYTES KB(256)
+#define BENCH_LARGE_OPS_MIN 4
+#define BENCH_BATCH 4
+/* Part size of the multi-part operations, e.g. a received DFU chunk. */
+#define BENCH_PART_SIZE 64
+
+#define BENCH_KEY_SIZE 16
+#define BENCH_HMAC_KEY_SIZE 32
+#define BENCH_GCM_IV_SIZE 12
+#define BENCH_CCM_IV_SIZE 13
+#define BENCH_AAD_SIZE 16
+#define BENCH_MAC_SIZE 16
+#define BENCH_DIGEST_SIZE 64
+#define BENCH_ECC_KEY_SIZE 64
+#define BENCH_SIG_SIZE 64
+#define BENCH_SECRET_SIZE 32
+#define BENCH_DSA_MSG_SIZE 64
+
+static const size_t bench_sizes[] = { 16, 64, 256, BENCH_SIZE_MAX };
+static const size_t bench_large_sizes[] = { KB(1), KB(4), KB(16), BENCH_LARGE_SIZE_MAX };
+
+static uint8_t bench_key[BENCH_KEY_SIZE];
+static uint8_t bench_hmac_key[BENCH_HMAC_KEY_SIZE];
+static uint8_t bench_iv[BENCH_KEY_SIZE];
+static uint8_t bench_aad[BENCH_AAD_SIZE];
+static uint8_t bench_in[BENCH_SIZE_MAX];
+static uint8_t bench_large_in[BENCH_LARGE_SIZE_MAX];
+static uint8_t bench_cipher[BENCH_SIZE_MAX];
+static uint8_t bench_out[BENCH_SIZE_MAX];
+static uint8_t bench_mac[BENCH_MAC_SIZE];
+static uint8_t bench_digest[BENCH_DIGEST_SIZE];
+static uint8_t bench_batch_out[BENCH_BATCH][BENCH_SIZE_MAX];
+static uint8_t bench_batch_macs[BENCH_BATCH][BENCH_MAC_SIZE];
+static sid_pal_aead_params_t bench_batch_params[BENCH_BATCH];
+
+struct bench_ecc_keys {
+	sid_pal_ecc_algo_t algo;
+	size_t prk_size;
+	size_t puk_size;
+	uint8_t prk[BENCH_ECC_KEY_SIZE];
+	uint8_t puk[BENCH_ECC_KEY_SIZE];
+	/* Key pair of the other side of the key agreement. */
+	uint8_t remote_puk[BENCH_ECC_KEY_SIZE];
+	uint8_t signature[BENCH_SIG_SIZE];
+};
+
+static struct bench_ecc_keys bench_ed25519 = {
+	.algo = SID_PAL_EDDSA_ED25519, .prk_size = 32, .puk_size = 32
+};
+static struct bench_ecc_keys bench_p256_dsa = {
+	.algo = SID_PAL_ECDSA_SECP256R1, .prk_size = 32, .puk_size = 64
+};
+static struct bench_ecc_keys bench_x25519 = {
+	.algo = SID_PAL_ECDH_CURVE25519, .prk_size = 32, .puk_size = 32
+};
+static struct bench_ecc_keys bench_p256_dh = {
+	.algo = SID_PAL_ECDH_SECP256R1, .prk_size = 32, .puk_size = 64
+};
+
+/* Operation under test, size is the payload size in bytes. */
+typedef sid_error_t (*bench_op_t)(size_t size, const void *arg);
+
+static void bench_report(const char *primitive, size_t size, uint32_t ops, uint64_t cycles)
+{
+	const uint64_t ns = timing_cycles_to_ns(cycles);
+	const uint64_t ops_per_s = ns ? (uint64_t)ops * NSEC_PER_SEC / ns : 0;
+
+	if (size) {
+		/* In hundredths, cbprintf has no floating point support by default. */
+		const uint64_t cpb = cycles * 100 / ((uint64_t)ops * size);
+
+		TC_PRINT("{\"suite\":\"sid_crypto\",\"type\":\"result\",\"board\":\"%s\","
+			 "\"backend\":\"%s\",\"primitive\":\"%s\",\"size\":%zu,\"ops\":%u,"
+			 "\"cycles_per_op\":%llu,\"cycles_per_byte\":%llu.%02llu,"
+			 "\"ops_per_s\":%llu}\n",
+			 CONFIG_BOARD, BENCH_BACKEND, primitive, size, ops, cycles / ops,
+			 cpb / 100, cpb % 100, ops_per_s);
+	} else {
+		TC_PRINT("{\"suite\":\"sid_crypto\",\"type\":\"result\",\"board\":\"%s\","
+			 "\"backend\":\"%s\",\"primitive\":\"%s\",\"size\":0,\"ops\":%u,"
+			 "\"cycles_per_op\":%llu,\"cycles_per_byte\":null,\"ops_per_s\":%llu}\n",
+			 CONFIG_BOARD, BENCH_BACKEND, primitive, ops, cycles / ops, ops_per_s);
+	}
+}
+
+static void bench_run(const char *primitive, bench_op_t op, const void *arg, size_t size,
+		      uint32_t ops)
+{
+	timing_t start, end;
+
+	/* The first call is not measured, it can include one-time setup of the backend. */
+	zassert_equal(SID_ERROR_NONE, op(size, arg), "%s %zu B failed", primitive, size);
+
+	start = timing_counter_get();
+	for (uint32_t i = 0; i < ops; i++) {
+		zassert_equal(SID_ERROR_NONE, op(size, arg), "%s %zu B failed", primitive, size);
+	}
+	end = timing_counter_get();
+
+	bench_report(primitive, size, ops, timing_cycles_get(&start, &end));
+}
+
+static void bench_run_sizes(const char *primitive, bench_op_t op, const void *arg)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(bench_sizes); i++) {
+		const uint32_t ops = CLAMP(BENCH_BYTES / bench_sizes[i], BENCH_OPS_MIN,
+					   BENCH_OPS_MAX);
+
+		bench_run(primitive, op, arg, bench_sizes[i], ops);
+	}
+}
+
+static sid_error_t op_rand(size_t size, const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	return sid_pal_crypto_rand(bench_out, size);
+}
+
+static sid_error_t op_hash(size_t size, const void *arg)
+{
+	sid_pal_hash_params_t params = {
+		.algo = *(const sid_pal_hash_algo_t *)arg,
+		.data = bench_in,
+		.data_size = size,
+		.digest = bench_digest,
+		.digest_size = sizeof(bench_digest),
+	};
+
+	return sid_pal_crypto_hash(&params);
+}
+
+static sid_error_t op_hash_large(size_t size, const void *arg)
+{
+	sid_pal_hash_params_t params = {
+		.algo = *(const sid_pal_hash_algo_t *)arg,
+		.data = bench_large_in,
+		.data_size = size,
+		.digest = bench_digest,
+		.digest_size = sizeof(bench_digest),
+	};
+
+	return sid_pal_crypto_hash(&params);
+}
+
+static sid_error_t op_hash_multipart(size_t size, const void *arg)
+{
+	sid_pal_hash_ctx_t ctx;
+	sid_error_t erc;
+
+	erc = sid_pal_crypto_hash_init(&ctx, *(const sid_pal_hash_algo_t *)arg);
+	for (size_t offset = 0; erc == SID_ERROR_NONE && offset < size;
+	     offset += BENCH_PART_SIZE) {
+		erc = sid_pal_crypto_hash_update(&ctx, &bench_in[offset],
+						 MIN(BENCH_PART_SIZE, size - offset));
+	}
+	if (erc != SID_ERROR_NONE) {
+		return erc;
+	}
+
+	return sid_pal_crypto_hash_finish(&ctx, bench_digest, sizeof(bench_digest));
+}
+
+static sid_error_t op_hmac(size_t size, const void *arg)
+{
+	sid_pal_hmac_params_t params = {
+		.algo = *(const sid_pal_hash_algo_t *)arg,
+		.key = bench_hmac_key,
+		.key_size = sizeof(bench_hmac_key),
+		.data = bench_in,
+		.data_size = size,
+		.digest = bench_digest,
+		.digest_size = sizeof(bench_digest),
+	};
+
+	return sid_pal_crypto_hmac(&params);
+}
+
+static sid_error_t op_hmac_large(size_t size, const void *arg)
+{
+	sid_pal_hmac_params_t params = {
+		.algo = *(const sid_pal_hash_algo_t *)arg,
+		.key = bench_hmac_key,
+		.key_size = sizeof(bench_hmac_key),
+		.data = bench_large_in,
+		.data_size = size,
+		.digest = bench_digest,
+		.digest_size = sizeof(bench_digest),
+	};
+
+	return sid_pal_crypto_hmac(&params);
+}
+
+static sid_error_t op_hmac_multipart(size_t size, const void *arg)
+{
+	sid_pal_hmac_ctx_t ctx;
+	sid_error_t erc;
+
+	erc = sid_pal_crypto_hmac_init(&ctx, *(const sid_pal_hash_algo_t *)arg, bench_hmac_key,
+				       sizeof(bench_hmac_key));
+	for (size_t offset = 0; erc == SID_ERROR_NONE && offset < size;
+	     offset += BENCH_PART_SIZE) {
+		erc = sid_pal_crypto_hmac_update(&ctx, &bench_in[offset],
+						 MIN(BENCH_PART_SIZE, size - offset));
+	}
+	if (erc != SID_ERROR_NONE) {
+		return erc;
+	}
+
+	return sid_pal_crypto_hmac_finish(&ctx, bench_digest, sizeof(bench_digest));
+}
+
+static sid_error_t op_aes_ctr(size_t size, const void *arg)
+{
+	sid_pal_aes_params_t params = {
+		.algo = SID_PAL_AES_CTR_128,
+		.mode = *(const sid_pal_aes_mode_t *)arg,
+		.key = bench_key,
+		.key_size = sizeof(bench_key) * 8,
+		.iv = bench_iv,
+		.iv_size = sizeof(bench_iv),
+		.in = bench_in,
+		.in_size = size,
+		.out = bench_out,
+		.out_size = size,
+	};
+
+	return sid_pal_crypto_aes_crypt(&params);
+}
+
+static sid_error_t op_aes_cmac(size_t size, const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	sid_pal_aes_params_t params = {
+		.algo = SID_PAL_AES_CMAC_128,
+		.mode = SID_PAL_CRYPTO_MAC_CALCULATE,
+		.key = bench_key,
+		.key_size = sizeof(bench_key) * 8,
+		.in = bench_in,
+		.in_size = size,
+		.out = bench_mac,
+		.out_size = sizeof(bench_mac),
+	};
+
+	return sid_pal_crypto_aes_crypt(&params);
+}
+
+static sid_pal_aead_params_t bench_aead_params(sid_pal_aead_algo_t algo, sid_pal_aes_mode_t mode,
+					       size_t size)
+{
+	const bool encrypt = (mode == SID_PAL_CRYPTO_ENCRYPT);
+
+	return (sid_pal_aead_params_t){
+		.algo = algo,
+		.mode = mode,
+		.key = bench_key,
+		.key_size = sizeof(bench_key) * 8,
+		.iv = bench_iv,
+		.iv_size = (algo == SID_PAL_AEAD_GCM_128) ? BENCH_GCM_IV_SIZE : BENCH_CCM_IV_SIZE,
+		.aad = bench_aad,
+		.aad_size = sizeof(bench_aad),
+		.in = encrypt ? bench_in : bench_cipher,
+		.in_size = size,
+		.out = encrypt ? bench_cipher : bench_out,
+		.out_size = size,
+		.mac = bench_mac,
+		.mac_size = sizeof(bench_mac),
+	};
+}
+
+/* Encrypts into bench_cipher, which is the input of the decryption. */
+static sid_error_t op_aead_encrypt(size_t size, const void *arg)
+{
+	sid_pal_aead_params_t params =
+		bench_aead_params(*(const sid_pal_aead_algo_t *)arg, SID_PAL_CRYPTO_ENCRYPT, size);
+
+	return sid_pal_crypto_aead_crypt(&params);
+}
+
+static sid_error_t op_aead_decrypt(size_t size, const void *arg)
+{
+	sid_pal_aead_params_t params =
+		bench_aead_params(*(const sid_pal_aead_algo_t *)arg, SID_PAL_CRYPTO_DECRYPT, size);
+
+	return sid_pal_crypto_aead_crypt(&params);
+}
+
+/* Size is the size of every frame of the batch. */
+static sid_error_t op_aead_batch(size_t size, const void *arg)
+{
+	size_t processed;
+
+	for (uint32_t i = 0; i < BENCH_BATCH; i++) {
+		bench_batch_params[i] = bench_aead_params(*(const sid_pal_aead_algo_t *)arg,
+							  SID_PAL_CRYPTO_ENCRYPT, size);
+		bench_batch_params[i].out = bench_batch_out[i];
+		bench_batch_params[i].mac = bench_batch_macs[i];
+	}
+
+	return sid_pal_crypto_aead_crypt_batch(bench_batch_params, BENCH_BATCH, &processed);
+}
+
+static sid_error_t op_ecc_key_gen(size_t size, const void *arg)
+{
+	const struct bench_ecc_keys *keys = arg;
+	uint8_t prk[BENCH_ECC_KEY_SIZE];
+	uint8_t puk[BENCH_ECC_KEY_SIZE];
+	sid_pal_ecc_key_gen_params_t params = {
+		.algo = keys->algo,
+		.prk = prk,
+		.prk_size = keys->prk_size,
+		.puk = puk,
+		.puk_size = keys->puk_size,
+	};
+
+	ARG_UNUSED(size);
+
+	return sid_pal_crypto_ecc_key_gen(&params);
+}
+
+static sid_error_t op_ecc_sign(size_t size, const void *arg)
+{
+	struct bench_ecc_keys *keys = (struct bench_ecc_keys *)arg;
+	sid_pal_dsa_params_t params = {
+		.algo = keys->algo,
+		.mode = SID_PAL_CRYPTO_SIGN,
+		.key = keys->prk,
+		.key_size = keys->prk_size,
+		.in = bench_in,
+		.in_size = size,
+		.signature = keys->signature,
+		.sig_size = sizeof(keys->signature),
+	};
+
+	return sid_pal_crypto_ecc_dsa(&params);
+}
+
+/* Verifies the signature of the last op_ecc_sign(). */
+static sid_error_t op_ecc_verify(size_t size, const void *arg)
+{
+	struct bench_ecc_keys *keys = (struct bench_ecc_keys *)arg;
+	sid_pal_dsa_params_t params = {
+		.algo = keys->algo,
+		.mode = SID_PAL_CRYPTO_VERIFY,
+		.key = keys->puk,
+		.key_size = keys->puk_size,
+		.in = bench_in,
+		.in_size = size,
+		.signature = keys->signature,
+		.sig_size = sizeof(keys->signature),
+	};
+
+	return sid_pal_crypto_ecc_dsa(&params);
+}
+
+static sid_error_t op_ecc_ecdh(size_t size, const void *arg)
+{
+	const struct bench_ecc_keys *keys = arg;
+	uint8_t secret[BENCH_SECRET_SIZE];
+	sid_pal_ecdh_params_t params = {
+		.algo = keys->algo,
+		.prk = keys->prk,
+		.prk_size = keys->prk_size,
+		.puk = keys->remote_puk,
+		.puk_size = keys->puk_size,
+		.shared_secret = secret,
+		.shared_secret_sz = sizeof(secret),
+	};
+
+	ARG_UNUSED(size);
+
+	return sid_pal_crypto_ecc_ecdh(&params);
+}
+
+static void bench_ecc_keys_generate(struct bench_ecc_keys *keys)
+{
+	uint8_t remote_prk[BENCH_ECC_KEY_SIZE];
+	sid_pal_ecc_key_gen_params_t params = {
+		.algo = keys->algo,
+		.prk = keys->prk,
+		.prk_size = keys->prk_size,
+		.puk = keys->puk,
+		.puk_size = keys->puk_size,
+	};
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_ecc_key_gen(&params));
+
+	params.prk = remote_prk;
+	params.puk = keys->remote_puk;
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_ecc_key_gen(&params));
+}
+
+ZTEST(crypto_benchmark, test_bench_rand)
+{
+	bench_run_sizes("rand", op_rand, NULL);
+}
+
+ZTEST(crypto_benchmark, test_bench_hash)
+{
+	static const sid_pal_hash_algo_t sha256 = SID_PAL_HASH_SHA256;
+	static const sid_pal_hash_algo_t sha512 = SID_PAL_HASH_SHA512;
+
+	bench_run_sizes("sha256", op_hash, &sha256);
+	bench_run_sizes("sha512", op_hash, &sha512);
+	bench_run_sizes("sha256_multipart", op_hash_multipart, &sha256);
+	bench_run_sizes("sha512_multipart", op_hash_multipart, &sha512);
+}
+
+ZTEST(crypto_benchmark, test_bench_hmac)
+{
+	static const sid_pal_hash_algo_t sha256 = SID_PAL_HASH_SHA256;
+	static const sid_pal_hash_algo_t sha512 = SID_PAL_HASH_SHA512;
+
+	bench_run_sizes("hmac_sha256", op_hmac, &sha256);
+	bench_run_sizes("hmac_sha512", op_hmac, &sha512);
+	bench_run_sizes("hmac_sha256_multipart", op_hmac_multipart, &sha256);
+	bench_run_sizes("hmac_sha512_multipart", op_hmac_multipart, &sha512);
+}
+
+/* Compare with CONFIG_SIDEWALK_CRYPTO_DATA_CHUNK_SIZE to see the cost of the PSA calls per part. */
+ZTEST(crypto_benchmark, test_bench_hash_large)
+{
+	static const sid_pal_hash_algo_t sha256 = SID_PAL_HASH_SHA256;
+
+	for (size_t i = 0; i < ARRAY_SIZE(bench_large_sizes); i++) {
+		const size_t size = bench_large_sizes[i];
+		const uint32_t ops = MAX(BENCH_LARGE_BYTES / size, BENCH_LARGE_OPS_MIN);
+
+		bench_run("sha256", op_hash_large, &sha256, size, ops);
+		bench_run("hmac_sha256", op_hmac_large, &sha256, size, ops);
+	}
+}
+
+ZTEST(crypto_benchmark, test_bench_aes)
+{
+	static const sid_pal_aes_mode_t encrypt = SID_PAL_CRYPTO_ENCRYPT;
+	static const sid_pal_aes_mode_t decrypt = SID_PAL_CRYPTO_DECRYPT;
+
+	bench_run_sizes("aes_ctr_128_encrypt", op_aes_ctr, &encrypt);
+	bench_run_sizes("aes_ctr_128_decrypt", op_aes_ctr, &decrypt);
+	bench_run_sizes("aes_cmac_128", op_aes_cmac, NULL);
+}
+
+ZTEST(crypto_benchmark, test_bench_aead)
+{
+	static const sid_pal_aead_algo_t gcm = SID_PAL_AEAD_GCM_128;
+	static const sid_pal_aead_algo_t ccm = SID_PAL_AEAD_CCM_128;
+
+	/* Every encryption is followed by the decryption of its output, with the same size. */
+	for (size_t i = 0; i < ARRAY_SIZE(bench_sizes); i++) {
+		const size_t size = bench_sizes[i];
+		const uint32_t ops = CLAMP(BENCH_BYTES / size, BENCH_OPS_MIN, BENCH_OPS_MAX);
+
+		bench_run("aes_gcm_128_encrypt", op_aead_encrypt, &gcm, size, ops);
+		bench_run("aes_gcm_128_decrypt", op_aead_decrypt, &gcm, size, ops);
+		bench_run("aes_ccm_128_encrypt", op_aead_encrypt, &ccm, size, ops);
+		bench_run("aes_ccm_128_decrypt", op_aead_decrypt, &ccm, size, ops);
+	}
+}
+
+ZTEST(crypto_benchmark, test_bench_aead_batch)
+{
+	static const sid_pal_aead_algo_t gcm = SID_PAL_AEAD_GCM_128;
+
+	/* Reported per batch, the size is the size of one of the frames. */
+	for (size_t i = 0; i < ARRAY_SIZE(bench_sizes); i++) {
+		const size_t size = bench_sizes[i];
+		const uint32_t ops = CLAMP(BENCH_BYTES / (size * BENCH_BATCH), BENCH_OPS_MIN,
+					   BENCH_OPS_MAX);
+
+		bench_run("aes_gcm_128_encrypt_batch4", op_aead_batch, &gcm, size, ops);
+	}
+}
+
+ZTEST(crypto_benchmark, test_bench_ecc_key_gen)
+{
+	bench_run("ed25519_key_gen", op_ecc_key_gen, &bench_ed25519, 0, BENCH_ECC_OPS);
+	bench_run("p256_key_gen", op_ecc_key_gen, &bench_p256_dsa, 0, BENCH_ECC_OPS);
+	bench_run("x25519_key_gen", op_ecc_key_gen, &bench_x25519, 0, BENCH_ECC_OPS);
+}
+
+ZTEST(crypto_benchmark, test_bench_ecc_dsa)
+{
+	bench_ecc_keys_generate(&bench_ed25519);
+	bench_ecc_keys_generate(&bench_p256_dsa);
+
+	bench_run("ed25519_sign", op_ecc_sign, &bench_ed25519, BENCH_DSA_MSG_SIZE,
+		  BENCH_ECC_OPS);
+	bench_run("ed25519_verify", op_ecc_verify, &bench_ed25519, BENCH_DSA_MSG_SIZE,
+		  BENCH_ECC_OPS);
+	bench_run("p256_sign", op_ecc_sign, &bench_p256_dsa, BENCH_DSA_MSG_SIZE, BENCH_ECC_OPS);
+	bench_run("p256_verify", op_ecc_verify, &bench_p256_dsa, BENCH_DSA_MSG_SIZE,
+		  BENCH_ECC_OPS);
+}
+
+ZTEST(crypto_benchmark, test_bench_ecc_ecdh)
+{
+	bench_ecc_keys_generate(&bench_x25519);
+	bench_ecc_keys_generate(&bench_p256_dh);
+
+	bench_run("x25519_ecdh", op_ecc_ecdh, &bench_x25519, 0, BENCH_ECC_OPS);
+	bench_run("p256_ecdh", op_ecc_ecdh, &bench_p256_dh, 0, BENCH_ECC_OPS);
+}
+
+static void *crypto_bench_setup(void)
+{
+	timing_init();
+
+	memset(bench_key, 0x2B, sizeof(bench_key));
+	memset(bench_hmac_key, 0x0B, sizeof(bench_hmac_key));
+	memset(bench_iv, 0xF0, sizeof(bench_iv));
+	memset(bench_aad, 0x3C, sizeof(bench_aad));
+	for (uint32_t i = 0; i < sizeof(bench_in); i++) {
+		bench_in[i] = i;
+	}
+	memset(bench_large_in, 0x5A, sizeof(bench_large_in));
+
+	TC_PRINT("{\"suite\":\"sid_crypto\",\"type\":\"config\",\"board\":\"%s\","
+		 "\"backend\":\"%s\",\"timing_mhz\":%u,\"data_chunk\":%u,\"key_cache\":%s,"
+		 "\"rand_pool\":%s}\n",
+		 CONFIG_BOARD, BENCH_BACKEND, timing_freq_get_mhz(),
+		 CONFIG_SIDEWALK_CRYPTO_DATA_CHUNK_SIZE,
+		 IS_ENABLED(CONFIG_SIDEWALK_CRYPTO_KEY_CACHE) ? "true" : "false",
+		 IS_ENABLED(CONFIG_SIDEWALK_CRYPTO_RAND_POOL) ? "true" : "false");
+
+	return NULL;
+}
+
+static void crypto_bench_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_init());
+	timing_start();
+}
+
+static void crypto_bench_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	timing_stop();
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_deinit());
+}
+
+ZTEST_SUITE(crypto_benchmark, NULL, crypto_bench_setup, crypto_bench_before, crypto_bench_after,
+	    NULL);
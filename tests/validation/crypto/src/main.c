@@ -7,6 +7,8 @@
 #include <zephyr/ztest.h>
 
 #include <sid_pal_crypto_ifc.h>
+#include <sid_crypto_stream.h>
+#include <sid_crypto_batch.h>
 #include <string.h>
 
 #define SHA256_SZ 32
@@ -1193,6 +1195,113 @@ ZTEST(crypto, test_hmac_negative)
 #endif /* CONFIG_SOC_NRF54L15 */
 }
 
+ZTEST(crypto, test_hash_stream_positive)
+{
+	const size_t data_size = strlen((char *)hash_string);
+	sid_pal_hash_ctx_t ctx;
+	uint8_t out_buf[64];
+
+	/* Parts of different sizes, also an empty one. */
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hash_init(&ctx, SID_PAL_HASH_SHA256));
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hash_update(&ctx, hash_string, 1));
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hash_update(&ctx, NULL, 0));
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hash_update(&ctx, &hash_string[1], 10));
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_crypto_hash_update(&ctx, &hash_string[11], data_size - 11));
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hash_finish(&ctx, out_buf, SHA256_SZ));
+	zassert_equal(0, memcmp(out_buf, sha256_result, SHA256_SZ));
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hash_init(&ctx, SID_PAL_HASH_SHA256));
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hash_update(&ctx, hash_string, data_size));
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hash_verify(&ctx, sha256_result, SHA256_SZ));
+
+#if defined(CONFIG_SOC_NRF54L15)
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hash_init(&ctx, SID_PAL_HASH_SHA512));
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hash_update(&ctx, hash_string, 7));
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_crypto_hash_update(&ctx, &hash_string[7], data_size - 7));
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hash_finish(&ctx, out_buf, SHA512_SZ));
+	zassert_equal(0, memcmp(out_buf, sha512_result, SHA512_SZ));
+#endif /* CONFIG_SOC_NRF54L15 */
+}
+
+ZTEST(crypto, test_hash_stream_negative)
+{
+	const size_t data_size = strlen((char *)hash_string);
+	sid_pal_hash_ctx_t ctx;
+	uint8_t out_buf[64];
+
+	zassert_equal(SID_ERROR_NULL_POINTER, sid_pal_crypto_hash_init(NULL, SID_PAL_HASH_SHA256));
+	zassert_equal(SID_ERROR_NOSUPPORT, sid_pal_crypto_hash_init(&ctx, 0));
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hash_init(&ctx, SID_PAL_HASH_SHA256));
+	zassert_equal(SID_ERROR_NULL_POINTER, sid_pal_crypto_hash_update(&ctx, NULL, 1));
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hash_update(&ctx, hash_string, data_size - 1));
+	zassert_not_equal(SID_ERROR_NONE,
+			  sid_pal_crypto_hash_verify(&ctx, sha256_result, SHA256_SZ));
+
+	/* The context can be started again after abort. */
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hash_init(&ctx, SID_PAL_HASH_SHA256));
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hash_abort(&ctx));
+	zassert_not_equal(SID_ERROR_NONE, sid_pal_crypto_hash_finish(&ctx, out_buf, SHA256_SZ));
+}
+
+ZTEST(crypto, test_hmac_stream_positive)
+{
+	const size_t data_size = strlen((char *)hmac_hash_string);
+	sid_pal_hmac_ctx_t ctx;
+	uint8_t out_buf[64];
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hmac_init(&ctx, SID_PAL_HASH_SHA256,
+							       hmac_key, sizeof(hmac_key)));
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hmac_update(&ctx, hmac_hash_string, 5));
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_crypto_hmac_update(&ctx, &hmac_hash_string[5], data_size - 5));
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hmac_finish(&ctx, out_buf, SHA256_SZ));
+	zassert_equal(0, memcmp(out_buf, hmac_sha256_result, SHA256_SZ));
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hmac_init(&ctx, SID_PAL_HASH_SHA256,
+							       hmac_key, sizeof(hmac_key)));
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_crypto_hmac_update(&ctx, hmac_hash_string, data_size));
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_crypto_hmac_verify(&ctx, hmac_sha256_result, SHA256_SZ));
+
+#if defined(CONFIG_SOC_NRF54L15)
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hmac_init(&ctx, SID_PAL_HASH_SHA512,
+							       hmac_key, sizeof(hmac_key)));
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_crypto_hmac_update(&ctx, hmac_hash_string, data_size));
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hmac_finish(&ctx, out_buf, SHA512_SZ));
+	zassert_equal(0, memcmp(out_buf, hmac_sha512_result, SHA512_SZ));
+#endif /* CONFIG_SOC_NRF54L15 */
+}
+
+ZTEST(crypto, test_hmac_stream_negative)
+{
+	const size_t data_size = strlen((char *)hmac_hash_string);
+	sid_pal_hmac_ctx_t ctx;
+
+	zassert_equal(SID_ERROR_NULL_POINTER,
+		      sid_pal_crypto_hmac_init(&ctx, SID_PAL_HASH_SHA256, NULL, 16));
+	zassert_equal(SID_ERROR_INVALID_ARGS,
+		      sid_pal_crypto_hmac_init(&ctx, SID_PAL_HASH_SHA256, hmac_key, 0));
+	zassert_equal(SID_ERROR_NOSUPPORT,
+		      sid_pal_crypto_hmac_init(&ctx, 0, hmac_key, sizeof(hmac_key)));
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hmac_init(&ctx, SID_PAL_HASH_SHA256,
+							       hmac_invalid_key,
+							       sizeof(hmac_invalid_key)));
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_crypto_hmac_update(&ctx, hmac_hash_string, data_size));
+	zassert_not_equal(SID_ERROR_NONE,
+			  sid_pal_crypto_hmac_verify(&ctx, hmac_sha256_result, SHA256_SZ));
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hmac_init(&ctx, SID_PAL_HASH_SHA256,
+							       hmac_key, sizeof(hmac_key)));
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hmac_abort(&ctx));
+}
+
 ZTEST(crypto, test_cmac_positive)
 {
 	sid_pal_aes_params_t aes_params = { 0 };
@@ -1364,6 +1473,97 @@ ZTEST(crypto, test_gcm_positive)
 	zassert_equal(0, memcmp(out_buf, aes_gcm_plaintext, aead_params.out_size));
 }
 
+#define BATCH_FRAMES 3
+
+static void gcm_batch_params(sid_pal_aead_params_t *params, sid_pal_aes_mode_t mode,
+			     uint8_t frames[][sizeof(aes_gcm_plaintext)], uint8_t macs[][16])
+{
+	for (size_t i = 0; i < BATCH_FRAMES; i++) {
+		params[i] = (sid_pal_aead_params_t){
+			.algo = SID_PAL_AEAD_GCM_128,
+			.mode = mode,
+			.key = aes_gcm_key,
+			.key_size = 16 * 8, // 128 bits
+			.iv = aes_gcm_iv,
+			.iv_size = sizeof(aes_gcm_iv),
+			.aad = aes_gcm_aad,
+			.aad_size = sizeof(aes_gcm_aad),
+			/* In place. */
+			.in = frames[i],
+			.in_size = sizeof(aes_gcm_plaintext),
+			.out = frames[i],
+			.out_size = sizeof(aes_gcm_plaintext),
+			.mac = macs[i],
+			.mac_size = sizeof(aes_gcm_mac),
+		};
+	}
+}
+
+ZTEST(crypto, test_gcm_batch_positive)
+{
+	sid_pal_aead_params_t params[BATCH_FRAMES];
+	uint8_t frames[BATCH_FRAMES][sizeof(aes_gcm_plaintext)];
+	uint8_t macs[BATCH_FRAMES][16];
+	size_t processed;
+
+	for (size_t i = 0; i < BATCH_FRAMES; i++) {
+		memcpy(frames[i], aes_gcm_plaintext, sizeof(aes_gcm_plaintext));
+	}
+	gcm_batch_params(params, SID_PAL_CRYPTO_ENCRYPT, frames, macs);
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_crypto_aead_crypt_batch(params, BATCH_FRAMES, &processed));
+	zassert_equal(BATCH_FRAMES, processed);
+	for (size_t i = 0; i < BATCH_FRAMES; i++) {
+		zassert_mem_equal(frames[i], aes_gcm_ciphertext, sizeof(aes_gcm_ciphertext));
+		zassert_mem_equal(macs[i], aes_gcm_mac, sizeof(aes_gcm_mac));
+	}
+
+	gcm_batch_params(params, SID_PAL_CRYPTO_DECRYPT, frames, macs);
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_crypto_aead_crypt_batch(params, BATCH_FRAMES, &processed));
+	zassert_equal(BATCH_FRAMES, processed);
+	for (size_t i = 0; i < BATCH_FRAMES; i++) {
+		zassert_mem_equal(frames[i], aes_gcm_plaintext, sizeof(aes_gcm_plaintext));
+	}
+}
+
+ZTEST(crypto, test_gcm_batch_negative)
+{
+	sid_pal_aead_params_t params[BATCH_FRAMES];
+	uint8_t frames[BATCH_FRAMES][sizeof(aes_gcm_plaintext)];
+	uint8_t macs[BATCH_FRAMES][16];
+	size_t processed;
+
+	zassert_equal(SID_ERROR_NULL_POINTER,
+		      sid_pal_crypto_aead_crypt_batch(NULL, BATCH_FRAMES, &processed));
+	zassert_equal(SID_ERROR_NULL_POINTER, sid_pal_crypto_aead_crypt_batch(params, 1, NULL));
+	zassert_equal(SID_ERROR_INVALID_ARGS, sid_pal_crypto_aead_crypt_batch(params, 0, &processed));
+
+	/* Every frame has to use the key and the mode of the first one. */
+	gcm_batch_params(params, SID_PAL_CRYPTO_DECRYPT, frames, macs);
+	params[1].key = aes_gcm_invalid_key;
+	zassert_equal(SID_ERROR_INVALID_ARGS,
+		      sid_pal_crypto_aead_crypt_batch(params, BATCH_FRAMES, &processed));
+	zassert_equal(0, processed);
+
+	gcm_batch_params(params, SID_PAL_CRYPTO_DECRYPT, frames, macs);
+	params[2].mode = SID_PAL_CRYPTO_ENCRYPT;
+	zassert_equal(SID_ERROR_INVALID_ARGS,
+		      sid_pal_crypto_aead_crypt_batch(params, BATCH_FRAMES, &processed));
+
+	/* The processing stops at the frame with an invalid MAC. */
+	for (size_t i = 0; i < BATCH_FRAMES; i++) {
+		memcpy(frames[i], aes_gcm_ciphertext, sizeof(aes_gcm_ciphertext));
+		memcpy(macs[i], aes_gcm_mac, sizeof(aes_gcm_mac));
+	}
+	memcpy(macs[1], aes_gcm_invalid_mac, sizeof(aes_gcm_invalid_mac));
+	gcm_batch_params(params, SID_PAL_CRYPTO_DECRYPT, frames, macs);
+	zassert_not_equal(SID_ERROR_NONE,
+			  sid_pal_crypto_aead_crypt_batch(params, BATCH_FRAMES, &processed));
+	zassert_equal(1, processed);
+	zassert_mem_equal(frames[0], aes_gcm_plaintext, sizeof(aes_gcm_plaintext));
+}
+
 ZTEST(crypto, test_gcm_invalid_params_encrypt)
 {
 	test_gcm_invalid_params(SID_PAL_CRYPTO_ENCRYPT);
@@ -1486,6 +1686,50 @@ ZTEST(crypto, test_ctr_positive)
 	zassert_equal(0, memcmp(out_buf, aes_ctr_plaintext, aes_params.out_size));
 }
 
+ZTEST(crypto, test_ctr_batch_positive)
+{
+	sid_pal_aes_params_t params[BATCH_FRAMES];
+	uint8_t frames[BATCH_FRAMES][sizeof(aes_ctr_plaintext)];
+	size_t processed;
+
+	for (size_t i = 0; i < BATCH_FRAMES; i++) {
+		memcpy(frames[i], aes_ctr_plaintext, sizeof(aes_ctr_plaintext));
+		params[i] = (sid_pal_aes_params_t){
+			.algo = SID_PAL_AES_CTR_128,
+			.mode = SID_PAL_CRYPTO_ENCRYPT,
+			.iv = aes_ctr_iv,
+			.iv_size = sizeof(aes_ctr_iv),
+			.key = aes_ctr_key,
+			.key_size = 16 * 8, // 128 bits
+			/* In place. */
+			.in = frames[i],
+			.in_size = sizeof(aes_ctr_plaintext),
+			.out = frames[i],
+			.out_size = sizeof(aes_ctr_plaintext),
+		};
+	}
+
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_crypto_aes_crypt_batch(params, BATCH_FRAMES, &processed));
+	zassert_equal(BATCH_FRAMES, processed);
+	for (size_t i = 0; i < BATCH_FRAMES; i++) {
+		zassert_mem_equal(frames[i], aes_ctr_ciphertext, sizeof(aes_ctr_ciphertext));
+		params[i].mode = SID_PAL_CRYPTO_DECRYPT;
+	}
+
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_crypto_aes_crypt_batch(params, BATCH_FRAMES, &processed));
+	zassert_equal(BATCH_FRAMES, processed);
+	for (size_t i = 0; i < BATCH_FRAMES; i++) {
+		zassert_mem_equal(frames[i], aes_ctr_plaintext, sizeof(aes_ctr_plaintext));
+	}
+
+	params[1].key = aes_ctr_invalid_key;
+	zassert_equal(SID_ERROR_INVALID_ARGS,
+		      sid_pal_crypto_aes_crypt_batch(params, BATCH_FRAMES, &processed));
+	zassert_equal(0, processed);
+}
+
 ZTEST(crypto, test_ctr_invalid_params_encrypt)
 {
 	test_ctr_invalid_params(SID_PAL_CRYPTO_ENCRYPT);
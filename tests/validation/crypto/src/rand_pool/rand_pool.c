@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sid_pal_crypto_ifc.h>
+#include <sid_crypto_rand_pool.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <string.h>
+
+#define REQUEST_SIZE 16
+#define REQUESTS 8
+/* The refill thread has the lowest priority, the test sleeps to let it run. */
+#define REFILL_WAIT_MS 100
+
+BUILD_ASSERT(REQUEST_SIZE * REQUESTS <= CONFIG_SIDEWALK_CRYPTO_RAND_POOL_SIZE);
+
+static void print_stats(const struct sid_crypto_rand_pool_stats *stats)
+{
+	TC_PRINT("rand pool: hits %u misses %u refilled %u B discarded %u B\n", stats->hits,
+		 stats->misses, stats->refill_bytes, stats->discarded_bytes);
+	if (stats->hits) {
+		TC_PRINT("hit latency: avg %llu ns max %u ns\n",
+			 stats->hit_latency_sum_ns / stats->hits, stats->hit_latency_max_ns);
+	}
+	if (stats->misses) {
+		TC_PRINT("miss latency: avg %llu ns max %u ns\n",
+			 stats->miss_latency_sum_ns / stats->misses, stats->miss_latency_max_ns);
+	}
+}
+
+ZTEST(crypto_rand_pool, test_rand_pool_hits)
+{
+	uint8_t rand[REQUESTS][REQUEST_SIZE];
+	struct sid_crypto_rand_pool_stats stats;
+
+	for (int i = 0; i < REQUESTS; i++) {
+		zassert_equal(SID_ERROR_NONE, sid_pal_crypto_rand(rand[i], REQUEST_SIZE));
+	}
+	for (int i = 1; i < REQUESTS; i++) {
+		zassert_true(memcmp(rand[0], rand[i], REQUEST_SIZE), "repeated random bytes");
+	}
+
+	sid_crypto_rand_pool_stats_get(&stats);
+	print_stats(&stats);
+	zassert_equal(REQUESTS, stats.hits);
+	zassert_equal(0, stats.misses);
+}
+
+ZTEST(crypto_rand_pool, test_rand_pool_large_request)
+{
+	uint8_t rand[CONFIG_SIDEWALK_CRYPTO_RAND_POOL_REQUEST_MAX + 1];
+	struct sid_crypto_rand_pool_stats stats;
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_rand(rand, sizeof(rand)));
+
+	sid_crypto_rand_pool_stats_get(&stats);
+	zassert_equal(0, stats.hits);
+	zassert_equal(1, stats.misses);
+}
+
+ZTEST(crypto_rand_pool, test_rand_pool_flush)
+{
+	uint8_t rand[REQUEST_SIZE];
+	struct sid_crypto_rand_pool_stats stats;
+
+	/* The refill thread cannot run before the request, so the pool is still empty. */
+	sid_crypto_rand_pool_flush();
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_rand(rand, sizeof(rand)));
+
+	sid_crypto_rand_pool_stats_get(&stats);
+	zassert_equal(0, stats.hits);
+	zassert_equal(1, stats.misses);
+
+	/* Refilled again at idle. */
+	k_msleep(REFILL_WAIT_MS);
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_rand(rand, sizeof(rand)));
+	sid_crypto_rand_pool_stats_get(&stats);
+	zassert_equal(1, stats.hits);
+}
+
+static void rand_pool_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_init());
+	k_msleep(REFILL_WAIT_MS);
+	sid_crypto_rand_pool_stats_reset();
+}
+
+static void rand_pool_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_deinit());
+}
+
+ZTEST_SUITE(crypto_rand_pool, NULL, NULL, rand_pool_before, rand_pool_after, NULL);
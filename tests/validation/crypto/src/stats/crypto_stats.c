@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sid_pal_crypto_ifc.h>
+#include <sid_crypto_stats.h>
+
+#include <zephyr/ztest.h>
+#include <string.h>
+
+#define DATA_SIZE 48
+
+static uint8_t key[16];
+static uint8_t iv[16];
+static uint8_t data[DATA_SIZE];
+static uint8_t out[DATA_SIZE];
+
+static uint32_t hist_count(const struct sid_crypto_stats_hist *hist)
+{
+	uint32_t count = 0;
+
+	for (int i = 0; i < SID_CRYPTO_STATS_HIST_BUCKETS; i++) {
+		count += hist->buckets[i];
+	}
+	return count;
+}
+
+ZTEST(crypto_stats, test_stats_aes_ctr)
+{
+	struct sid_crypto_stats stats;
+	sid_pal_aes_params_t params = {
+		.algo = SID_PAL_AES_CTR_128,
+		.mode = SID_PAL_CRYPTO_ENCRYPT,
+		.key = key,
+		.key_size = sizeof(key) * 8,
+		.iv = iv,
+		.iv_size = sizeof(iv),
+		.in = data,
+		.in_size = sizeof(data),
+		.out = out,
+		.out_size = sizeof(out),
+	};
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_aes_crypt(&params));
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_aes_crypt(&params));
+
+	sid_crypto_stats_get(&stats);
+	const struct sid_crypto_stats_algo_stats *ctr = &stats.algo[SID_CRYPTO_STATS_AES_CTR];
+
+	zassert_equal(2, ctr->calls);
+	zassert_equal(0, ctr->failures);
+	zassert_equal(2 * DATA_SIZE, ctr->bytes);
+	zassert_equal(2, hist_count(&ctr->latency));
+	zassert_true(ctr->latency.max_cycles > 0);
+	zassert_true(ctr->latency.sum_cycles >= ctr->latency.max_cycles);
+	zassert_equal(0, stats.algo[SID_CRYPTO_STATS_AES_CMAC].calls);
+}
+
+ZTEST(crypto_stats, test_stats_failure)
+{
+	struct sid_crypto_stats stats;
+	uint8_t digest[32];
+	sid_pal_hmac_params_t params = {
+		.algo = SID_PAL_HASH_SHA256,
+		.key = key,
+		.key_size = sizeof(key),
+		.data = data,
+		.data_size = sizeof(data),
+		.digest = digest,
+		.digest_size = sizeof(digest),
+	};
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_hmac(&params));
+	/* Too small digest buffer, the call fails in PSA. */
+	params.digest_size = 1;
+	zassert_not_equal(SID_ERROR_NONE, sid_pal_crypto_hmac(&params));
+	/* Rejected before the algorithm is known, not recorded. */
+	params.key = NULL;
+	zassert_not_equal(SID_ERROR_NONE, sid_pal_crypto_hmac(&params));
+
+	sid_crypto_stats_get(&stats);
+	const struct sid_crypto_stats_algo_stats *hmac =
+		&stats.algo[SID_CRYPTO_STATS_HMAC_SHA256];
+
+	zassert_equal(2, hmac->calls);
+	zassert_equal(1, hmac->failures);
+	zassert_equal(DATA_SIZE, hmac->bytes);
+}
+
+ZTEST(crypto_stats, test_stats_reset)
+{
+	struct sid_crypto_stats stats;
+	struct sid_crypto_stats zeros = { 0 };
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_rand(out, sizeof(out)));
+	sid_crypto_stats_get(&stats);
+	zassert_equal(1, stats.algo[SID_CRYPTO_STATS_RAND].calls);
+	zassert_equal(sizeof(out), stats.algo[SID_CRYPTO_STATS_RAND].bytes);
+
+	sid_crypto_stats_reset();
+	sid_crypto_stats_get(&stats);
+	zassert_mem_equal(&zeros, &stats, sizeof(stats));
+}
+
+ZTEST(crypto_stats, test_stats_algo_name)
+{
+	zassert_str_equal("AES-GCM", sid_crypto_stats_algo_name(SID_CRYPTO_STATS_AES_GCM));
+	zassert_str_equal("P-256", sid_crypto_stats_algo_name(SID_CRYPTO_STATS_P256));
+	zassert_str_equal("unknown", sid_crypto_stats_algo_name(SID_CRYPTO_STATS_ALGO_NUM));
+}
+
+static void crypto_stats_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(key, 0x2B, sizeof(key));
+	memset(iv, 0xF0, sizeof(iv));
+	memset(data, 0x6B, sizeof(data));
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_init());
+	sid_crypto_stats_reset();
+}
+
+static void crypto_stats_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_crypto_deinit());
+}
+
+ZTEST_SUITE(crypto_stats, NULL, NULL, crypto_stats_before, crypto_stats_after, NULL);
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sid_pal_storage_kv_ifc.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/ztest.h>
+
+#if defined(CONFIG_ARCH_POSIX) && defined(CONFIG_EXTERNAL_LIBC)
+/* The simulated time does not advance while the code runs, so the host clock is used. */
+#include <time.h>
+#define BENCH_HOST_CLOCK 1
+#endif
+
+#define BENCH_GROUP 0x30
+/* Keys of the records never written. */
+#define BENCH_MISSING_KEY_BASE 0x8000
+
+static const uint32_t bench_sizes[] = { 50, 100, 250, 500 };
+
+struct bench_result {
+	uint64_t ns;
+	uint64_t cycles;
+};
+
+static timing_t bench_now(void)
+{
+#ifdef BENCH_HOST_CLOCK
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (timing_t)now.tv_sec * NSEC_PER_SEC + now.tv_nsec;
+#else
+	return timing_counter_get();
+#endif /* BENCH_HOST_CLOCK */
+}
+
+static struct bench_result bench_per_op(timing_t start, timing_t end, uint32_t ops)
+{
+#ifdef BENCH_HOST_CLOCK
+	/* No CPU cycles on the host, only the time is measured. */
+	return (struct bench_result){ .ns = (end - start) / ops, .cycles = 0 };
+#else
+	uint64_t cycles = timing_cycles_get(&start, &end);
+
+	return (struct bench_result){ .ns = timing_cycles_to_ns(cycles) / ops,
+				      .cycles = cycles / ops };
+#endif /* BENCH_HOST_CLOCK */
+}
+
+/* Reads in an order unrelated to the write order. */
+static uint16_t bench_key(uint32_t i, uint32_t count)
+{
+	return (i * 7) % count;
+}
+
+static void bench_run(uint32_t stored, uint32_t count)
+{
+	timing_t start, end;
+	struct bench_result get, get_len, get_missing;
+	uint32_t value;
+	uint32_t len;
+
+	/* Records of the previous runs stay stored, only the missing ones are written. */
+	for (uint32_t i = stored; i < count; i++) {
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_storage_kv_record_set(BENCH_GROUP, i, &i, sizeof(i)));
+	}
+
+	start = bench_now();
+	for (uint32_t i = 0; i < count; i++) {
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_storage_kv_record_get(BENCH_GROUP, bench_key(i, count), &value,
+							    sizeof(value)));
+	}
+	end = bench_now();
+	get = bench_per_op(start, end, count);
+
+	start = bench_now();
+	for (uint32_t i = 0; i < count; i++) {
+		zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_get_len(
+						      BENCH_GROUP, bench_key(i, count), &len));
+	}
+	end = bench_now();
+	get_len = bench_per_op(start, end, count);
+
+	start = bench_now();
+	for (uint32_t i = 0; i < count; i++) {
+		zassert_equal(SID_ERROR_NOT_FOUND,
+			      sid_pal_storage_kv_record_get(BENCH_GROUP, BENCH_MISSING_KEY_BASE + i,
+							    &value, sizeof(value)));
+	}
+	end = bench_now();
+	get_missing = bench_per_op(start, end, count);
+
+	TC_PRINT("records: %3u get: %8llu ns/op %8llu cyc/op get_len: %8llu ns/op %8llu cyc/op "
+		 "get missing: %8llu ns/op %8llu cyc/op\n",
+		 count, get.ns, get.cycles, get_len.ns, get_len.cycles, get_missing.ns,
+		 get_missing.cycles);
+}
+
+ZTEST(storage_benchmark, test_storage_lookup_cost)
+{
+	const char *lookups = "settings subtree";
+	uint32_t stored = 0;
+
+	if (IS_ENABLED(CONFIG_SIDEWALK_STORAGE_BACKEND_ID)) {
+		lookups = "numeric IDs";
+	} else if (IS_ENABLED(CONFIG_SIDEWALK_STORAGE_INDEX)) {
+		lookups = "RAM index";
+	}
+	TC_PRINT("storage lookups: %s\n", lookups);
+	for (size_t i = 0; i < ARRAY_SIZE(bench_sizes); i++) {
+		bench_run(stored, bench_sizes[i]);
+		stored = bench_sizes[i];
+	}
+}
+
+static void *bench_setup(void)
+{
+	timing_init();
+	timing_start();
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_init());
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(BENCH_GROUP));
+
+	return NULL;
+}
+
+static void bench_teardown(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(BENCH_GROUP));
+	timing_stop();
+}
+
+ZTEST_SUITE(storage_benchmark, NULL, bench_setup, NULL, NULL, bench_teardown);
@@ -0,0 +1,369 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/*
+ * Latency percentiles of the Sidewalk key-value storage operations on a record
+ * set like the one of a provisioned device. Every result is printed as one
+ * JSON object per line, so runs with the NVS and ZMS settings backends, the
+ * RAM index, the numeric IDs or the cache can be compared with
+ * scripts/ci/compare_storage_benchmarks.py.
+ */
+
+#include <sid_pal_storage_kv_ifc.h>
+#ifdef CONFIG_SIDEWALK_STORAGE_CACHE
+#include <sid_storage_cache.h>
+#endif /* CONFIG_SIDEWALK_STORAGE_CACHE */
+#ifdef CONFIG_SIDEWALK_STORAGE_INDEX
+#include <sid_storage_index.h>
+#endif /* CONFIG_SIDEWALK_STORAGE_INDEX */
+
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/ztest.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(CONFIG_SETTINGS_NVS)
+#include <zephyr/fs/nvs.h>
+#define BENCH_BACKEND "nvs"
+#elif defined(CONFIG_SETTINGS_ZMS)
+#include <zephyr/fs/zms.h>
+#define BENCH_BACKEND "zms"
+#else
+#define BENCH_BACKEND "settings"
+#endif
+
+#if defined(CONFIG_SIDEWALK_STORAGE_BACKEND_ID)
+#define BENCH_LOOKUPS "id"
+#elif defined(CONFIG_SIDEWALK_STORAGE_INDEX)
+#define BENCH_LOOKUPS "index"
+#else
+#define BENCH_LOOKUPS "subtree"
+#endif
+
+#if defined(CONFIG_ARCH_POSIX) && defined(CONFIG_EXTERNAL_LIBC)
+/* The simulated time does not advance while the code runs, so the host clock is used. */
+#include <time.h>
+#define BENCH_HOST_CLOCK 1
+#endif
+
+#define BENCH_GROUP_FIRST 0x70
+#define BENCH_GROUPS 4
+#define BENCH_KEYS 16
+#define BENCH_RECORDS (BENCH_GROUPS * BENCH_KEYS)
+/* Written again and deleted by every group delete. */
+#define BENCH_SCRATCH_GROUP (BENCH_GROUP_FIRST + BENCH_GROUPS)
+#define BENCH_SCRATCH_KEYS 8
+/* Records used most of the time with the hot distribution, e.g. counters and sync state. */
+#define BENCH_HOT_RECORDS 8
+#define BENCH_HOT_PERCENT 80
+#define BENCH_OPS 256
+#define BENCH_GROUP_DELETE_OPS 32
+#define BENCH_INIT_OPS 16
+#define BENCH_VALUE_MAX 128
+/* Up to three quarters of the map slots hold records. */
+#define BENCH_SLOTS_MIN(_records) ((_records) + DIV_ROUND_UP(_records, 3))
+
+#ifdef CONFIG_SIDEWALK_STORAGE_BACKEND_ID
+BUILD_ASSERT(CONFIG_SIDEWALK_STORAGE_ID_SLOTS >=
+		     BENCH_SLOTS_MIN(BENCH_RECORDS + BENCH_SCRATCH_KEYS),
+	     "CONFIG_SIDEWALK_STORAGE_ID_SLOTS too small for the benchmark records");
+#endif /* CONFIG_SIDEWALK_STORAGE_BACKEND_ID */
+#ifdef CONFIG_SIDEWALK_STORAGE_INDEX
+BUILD_ASSERT(CONFIG_SIDEWALK_STORAGE_INDEX_SLOTS >=
+		     BENCH_SLOTS_MIN(BENCH_RECORDS + BENCH_SCRATCH_KEYS),
+	     "CONFIG_SIDEWALK_STORAGE_INDEX_SLOTS too small for the benchmark records");
+#endif /* CONFIG_SIDEWALK_STORAGE_INDEX */
+
+enum bench_dist {
+	BENCH_DIST_UNIFORM,
+	BENCH_DIST_HOT,
+	BENCH_DIST_NUM,
+};
+
+static const char *const bench_dist_names[BENCH_DIST_NUM] = {
+	[BENCH_DIST_UNIFORM] = "uniform",
+	[BENCH_DIST_HOT] = "hot",
+};
+
+/* Sizes of the Sidewalk records, from counters to keys and certificates. */
+static const uint16_t bench_value_sizes[] = { 4, 4, 8, 16, 32, 64, 128 };
+
+static uint32_t bench_ns[BENCH_OPS];
+static uint8_t bench_value[BENCH_VALUE_MAX];
+static uint32_t bench_rand_state;
+#ifndef BENCH_HOST_CLOCK
+static timing_t bench_start;
+#endif /* BENCH_HOST_CLOCK */
+
+static uint64_t bench_now_ns(void)
+{
+#ifdef BENCH_HOST_CLOCK
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * NSEC_PER_SEC + now.tv_nsec;
+#else
+	timing_t now = timing_counter_get();
+
+	return timing_cycles_to_ns(timing_cycles_get(&bench_start, &now));
+#endif /* BENCH_HOST_CLOCK */
+}
+
+static uint32_t bench_elapsed_ns(uint64_t start)
+{
+	return (uint32_t)MIN(bench_now_ns() - start, UINT32_MAX);
+}
+
+/* xorshift32, the same sequence on every run. */
+static uint32_t bench_rand(void)
+{
+	bench_rand_state ^= bench_rand_state << 13;
+	bench_rand_state ^= bench_rand_state >> 17;
+	bench_rand_state ^= bench_rand_state << 5;
+	return bench_rand_state;
+}
+
+static uint32_t bench_record(enum bench_dist dist)
+{
+	uint32_t r = bench_rand();
+
+	if (dist == BENCH_DIST_HOT && r % 100 < BENCH_HOT_PERCENT) {
+		return (r / 100) % BENCH_HOT_RECORDS;
+	}
+	return (r / 100) % BENCH_RECORDS;
+}
+
+static uint16_t bench_group(uint32_t record)
+{
+	return BENCH_GROUP_FIRST + record / BENCH_KEYS;
+}
+
+static uint16_t bench_key(uint32_t record)
+{
+	return record % BENCH_KEYS;
+}
+
+static uint32_t bench_size(uint32_t record)
+{
+	return bench_value_sizes[record % ARRAY_SIZE(bench_value_sizes)];
+}
+
+static int bench_ns_cmp(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+
+	return (x > y) - (x < y);
+}
+
+/* Nearest rank percentile of the sorted samples. */
+static uint32_t bench_percentile(uint32_t ops, uint32_t percent)
+{
+	uint32_t rank = (ops * percent + 99) / 100;
+
+	return bench_ns[MAX(rank, 1) - 1];
+}
+
+static void bench_report(const char *op, const char *dist, uint32_t ops)
+{
+	uint64_t sum = 0;
+
+	for (uint32_t i = 0; i < ops; i++) {
+		sum += bench_ns[i];
+	}
+	qsort(bench_ns, ops, sizeof(bench_ns[0]), bench_ns_cmp);
+
+	TC_PRINT("{\"suite\":\"sid_storage\",\"type\":\"result\",\"board\":\"%s\","
+		 "\"backend\":\"%s\",\"lookups\":\"%s\",\"cache\":%s,\"op\":\"%s\","
+		 "\"dist\":\"%s\",\"records\":%u,\"ops\":%u,\"mean_ns\":%llu,\"p50_ns\":%u,"
+		 "\"p90_ns\":%u,\"p99_ns\":%u,\"max_ns\":%u}\n",
+		 CONFIG_BOARD, BENCH_BACKEND, BENCH_LOOKUPS,
+		 IS_ENABLED(CONFIG_SIDEWALK_STORAGE_CACHE) ? "true" : "false", op, dist,
+		 BENCH_RECORDS, ops, sum / ops, bench_percentile(ops, 50),
+		 bench_percentile(ops, 90), bench_percentile(ops, 99), bench_ns[ops - 1]);
+}
+
+static void bench_write_all(void)
+{
+	for (uint32_t record = 0; record < BENCH_RECORDS; record++) {
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_storage_kv_record_set(bench_group(record), bench_key(record),
+							    bench_value, bench_size(record)));
+	}
+}
+
+static void bench_delete_all(void)
+{
+	for (uint16_t group = BENCH_GROUP_FIRST; group <= BENCH_SCRATCH_GROUP; group++) {
+		zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(group));
+	}
+}
+
+#if defined(CONFIG_SETTINGS_NVS) || defined(CONFIG_SETTINGS_ZMS)
+/* Mounts the settings file system again, which scans the flash as on a boot. */
+static int bench_fs_remount(void)
+{
+	void *storage = NULL;
+	int err;
+
+#ifdef CONFIG_SIDEWALK_STORAGE_CACHE
+	zassert_equal(SID_ERROR_NONE, sid_storage_cache_sync());
+#endif /* CONFIG_SIDEWALK_STORAGE_CACHE */
+	err = settings_storage_get(&storage);
+	if (err || !storage) {
+		return err ? err : -ENODEV;
+	}
+#if defined(CONFIG_SETTINGS_NVS)
+	return nvs_mount(storage);
+#else
+	return zms_mount(storage);
+#endif
+}
+#endif /* CONFIG_SETTINGS_NVS || CONFIG_SETTINGS_ZMS */
+
+ZTEST(storage_ops_benchmark, test_storage_ops_records)
+{
+	uint32_t record;
+	uint32_t len;
+	uint64_t start;
+	sid_error_t erc;
+
+	for (int dist = 0; dist < BENCH_DIST_NUM; dist++) {
+		for (uint32_t i = 0; i < BENCH_OPS; i++) {
+			record = bench_record(dist);
+			start = bench_now_ns();
+			erc = sid_pal_storage_kv_record_set(bench_group(record), bench_key(record),
+							    bench_value, bench_size(record));
+			bench_ns[i] = bench_elapsed_ns(start);
+			zassert_equal(SID_ERROR_NONE, erc);
+		}
+		bench_report("set", bench_dist_names[dist], BENCH_OPS);
+
+		for (uint32_t i = 0; i < BENCH_OPS; i++) {
+			record = bench_record(dist);
+			start = bench_now_ns();
+			erc = sid_pal_storage_kv_record_get(bench_group(record), bench_key(record),
+							    bench_value, bench_size(record));
+			bench_ns[i] = bench_elapsed_ns(start);
+			zassert_equal(SID_ERROR_NONE, erc);
+		}
+		bench_report("get", bench_dist_names[dist], BENCH_OPS);
+
+		for (uint32_t i = 0; i < BENCH_OPS; i++) {
+			record = bench_record(dist);
+			start = bench_now_ns();
+			erc = sid_pal_storage_kv_record_get_len(bench_group(record),
+								bench_key(record), &len);
+			bench_ns[i] = bench_elapsed_ns(start);
+			zassert_equal(SID_ERROR_NONE, erc);
+			zassert_equal(bench_size(record), len);
+		}
+		bench_report("get_len", bench_dist_names[dist], BENCH_OPS);
+
+		/* Every deleted record is written again, so the record set does not shrink. */
+		for (uint32_t i = 0; i < BENCH_OPS; i++) {
+			record = bench_record(dist);
+			start = bench_now_ns();
+			erc = sid_pal_storage_kv_record_delete(bench_group(record), bench_key(record));
+			bench_ns[i] = bench_elapsed_ns(start);
+			zassert_equal(SID_ERROR_NONE, erc);
+			zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_set(
+							      bench_group(record), bench_key(record),
+							      bench_value, bench_size(record)));
+		}
+		bench_report("delete", bench_dist_names[dist], BENCH_OPS);
+	}
+}
+
+ZTEST(storage_ops_benchmark, test_storage_ops_group_delete)
+{
+	uint64_t start;
+	sid_error_t erc;
+
+	for (uint32_t i = 0; i < BENCH_GROUP_DELETE_OPS; i++) {
+		for (uint16_t key = 0; key < BENCH_SCRATCH_KEYS; key++) {
+			zassert_equal(SID_ERROR_NONE,
+				      sid_pal_storage_kv_record_set(BENCH_SCRATCH_GROUP, key,
+								    bench_value, bench_size(key)));
+		}
+		start = bench_now_ns();
+		erc = sid_pal_storage_kv_group_delete(BENCH_SCRATCH_GROUP);
+		bench_ns[i] = bench_elapsed_ns(start);
+		zassert_equal(SID_ERROR_NONE, erc);
+	}
+	bench_report("group_delete", "scratch", BENCH_GROUP_DELETE_OPS);
+}
+
+ZTEST(storage_ops_benchmark, test_storage_ops_init)
+{
+	uint64_t start;
+	sid_error_t erc;
+
+	for (uint32_t i = 0; i < BENCH_INIT_OPS; i++) {
+		start = bench_now_ns();
+		erc = sid_pal_storage_kv_init();
+		bench_ns[i] = bench_elapsed_ns(start);
+		zassert_equal(SID_ERROR_NONE, erc);
+	}
+	bench_report("init", "all", BENCH_INIT_OPS);
+
+#if defined(CONFIG_SETTINGS_NVS) || defined(CONFIG_SETTINGS_ZMS)
+	int err;
+
+	for (uint32_t i = 0; i < BENCH_INIT_OPS; i++) {
+		start = bench_now_ns();
+		err = bench_fs_remount();
+		erc = sid_pal_storage_kv_init();
+		bench_ns[i] = bench_elapsed_ns(start);
+		zassert_equal(0, err);
+		zassert_equal(SID_ERROR_NONE, erc);
+	}
+	bench_report("cold_init", "all", BENCH_INIT_OPS);
+#endif /* CONFIG_SETTINGS_NVS || CONFIG_SETTINGS_ZMS */
+}
+
+static void *bench_setup(void)
+{
+	timing_init();
+	timing_start();
+#ifndef BENCH_HOST_CLOCK
+	bench_start = timing_counter_get();
+#endif /* BENCH_HOST_CLOCK */
+	bench_rand_state = 0x5eed1234;
+	for (size_t i = 0; i < sizeof(bench_value); i++) {
+		bench_value[i] = i;
+	}
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_init());
+	bench_delete_all();
+	bench_write_all();
+#ifdef CONFIG_SIDEWALK_STORAGE_INDEX
+	/* Lookups falling back to the settings backend would not measure the index. */
+	zassert_true(sid_storage_index_is_complete());
+#endif /* CONFIG_SIDEWALK_STORAGE_INDEX */
+
+	TC_PRINT("{\"suite\":\"sid_storage\",\"type\":\"config\",\"board\":\"%s\","
+		 "\"backend\":\"%s\",\"lookups\":\"%s\",\"cache\":%s,\"host_clock\":%s,"
+		 "\"records\":%u,\"hot_records\":%u,\"hot_percent\":%u}\n",
+		 CONFIG_BOARD, BENCH_BACKEND, BENCH_LOOKUPS,
+		 IS_ENABLED(CONFIG_SIDEWALK_STORAGE_CACHE) ? "true" : "false",
+		 IS_ENABLED(BENCH_HOST_CLOCK) ? "true" : "false", BENCH_RECORDS,
+		 BENCH_HOT_RECORDS, BENCH_HOT_PERCENT);
+
+	return NULL;
+}
+
+static void bench_teardown(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	bench_delete_all();
+	timing_stop();
+}
+
+ZTEST_SUITE(storage_ops_benchmark, NULL, bench_setup, NULL, NULL, bench_teardown);
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sid_pal_storage_kv_ifc.h>
+#include <sid_storage_cache.h>
+#include <settings_utils.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <stdio.h>
+#include <string.h>
+
+#define CACHE_GROUP 0x10
+#define CACHE_CRITICAL_GROUP 0x11
+#define CACHE_PROTOCOL_GROUP 0x00
+/* Last key of the protocol group range, not used by the Sidewalk stack. */
+#define CACHE_PROTOCOL_KEY 0xBFFF
+
+/* Reads the record from flash, bypassing the cache. */
+static int flash_record_get(uint16_t group, uint16_t key, uint32_t *value)
+{
+	char serial[32];
+
+	snprintf(serial, sizeof(serial), "sidewalk/storage/%04x/%04x", group, key);
+	return settings_utils_load_immediate_value(serial, value, sizeof(*value));
+}
+
+ZTEST(storage_cache, test_cache_coalesce)
+{
+	struct sid_storage_cache_stats stats;
+	uint32_t value = 0;
+
+	for (uint32_t i = 1; i <= 3; i++) {
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_storage_kv_record_set(CACHE_GROUP, 1, &i, sizeof(i)));
+	}
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_get(CACHE_GROUP, 1, &value, sizeof(value)));
+	zassert_equal(3, value);
+	zassert_true(flash_record_get(CACHE_GROUP, 1, &value) <= 0, "written before the flush");
+
+	zassert_equal(SID_ERROR_NONE, sid_storage_cache_sync());
+	zassert_equal(sizeof(value), flash_record_get(CACHE_GROUP, 1, &value));
+	zassert_equal(3, value);
+
+	sid_storage_cache_stats_get(&stats);
+	zassert_equal(3, stats.writes);
+	zassert_equal(2, stats.coalesced);
+	zassert_equal(1, stats.flushes);
+	zassert_equal(1, stats.flushed_records);
+}
+
+ZTEST(storage_cache, test_cache_unchanged)
+{
+	struct sid_storage_cache_stats stats;
+	const uint32_t value = 0xCAFE;
+
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_set(CACHE_GROUP, 2, &value, sizeof(value)));
+	zassert_equal(SID_ERROR_NONE, sid_storage_cache_sync());
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_set(CACHE_GROUP, 2, &value, sizeof(value)));
+	zassert_equal(SID_ERROR_NONE, sid_storage_cache_sync());
+
+	sid_storage_cache_stats_get(&stats);
+	zassert_equal(1, stats.unchanged);
+	zassert_equal(1, stats.flushed_records);
+}
+
+ZTEST(storage_cache, test_cache_critical_write_through)
+{
+	struct sid_storage_cache_stats stats;
+	const uint32_t value = 0xC0FFEE;
+	uint32_t read = 0;
+
+	zassert_equal(SID_ERROR_NONE,
+		      sid_storage_cache_critical_add(CACHE_CRITICAL_GROUP, SID_STORAGE_CACHE_KEY_ANY));
+	zassert_true(sid_storage_cache_is_critical(CACHE_CRITICAL_GROUP, 7));
+	zassert_false(sid_storage_cache_is_critical(CACHE_GROUP, 7));
+
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_set(CACHE_CRITICAL_GROUP, 7, &value, sizeof(value)));
+	zassert_equal(sizeof(read), flash_record_get(CACHE_CRITICAL_GROUP, 7, &read));
+	zassert_equal(value, read);
+
+	sid_storage_cache_stats_get(&stats);
+	zassert_equal(1, stats.write_through);
+	zassert_equal(0, stats.writes);
+}
+
+ZTEST(storage_cache, test_cache_critical_protocol)
+{
+#ifdef CONFIG_SIDEWALK_STORAGE_CACHE_CRITICAL_PROTOCOL
+	struct sid_storage_cache_stats stats;
+	const uint32_t value = 0xFACE;
+	uint32_t read = 0;
+
+	zassert_true(sid_storage_cache_is_critical(CACHE_PROTOCOL_GROUP, CACHE_PROTOCOL_KEY));
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_set(CACHE_PROTOCOL_GROUP,
+								    CACHE_PROTOCOL_KEY, &value,
+								    sizeof(value)));
+	zassert_equal(sizeof(read), flash_record_get(CACHE_PROTOCOL_GROUP, CACHE_PROTOCOL_KEY,
+						     &read));
+	zassert_equal(value, read);
+
+	sid_storage_cache_stats_get(&stats);
+	zassert_equal(1, stats.write_through);
+	zassert_equal(0, stats.writes);
+
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_delete(CACHE_PROTOCOL_GROUP, CACHE_PROTOCOL_KEY));
+#else
+	ztest_test_skip();
+#endif /* CONFIG_SIDEWALK_STORAGE_CACHE_CRITICAL_PROTOCOL */
+}
+
+ZTEST(storage_cache, test_cache_protocol_coalesce)
+{
+#ifdef CONFIG_SIDEWALK_STORAGE_CACHE_CRITICAL_PROTOCOL
+	ztest_test_skip();
+#else
+	struct sid_storage_cache_stats stats;
+	uint32_t value = 0;
+
+	zassert_false(sid_storage_cache_is_critical(CACHE_PROTOCOL_GROUP, CACHE_PROTOCOL_KEY));
+
+	/* A protocol counter, updated on every frame. */
+	for (uint32_t i = 1; i <= 3; i++) {
+		zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_set(CACHE_PROTOCOL_GROUP,
+									    CACHE_PROTOCOL_KEY, &i,
+									    sizeof(i)));
+	}
+	zassert_true(flash_record_get(CACHE_PROTOCOL_GROUP, CACHE_PROTOCOL_KEY, &value) <= 0,
+		     "written before the flush");
+
+	zassert_equal(SID_ERROR_NONE, sid_storage_cache_sync());
+	zassert_equal(sizeof(value),
+		      flash_record_get(CACHE_PROTOCOL_GROUP, CACHE_PROTOCOL_KEY, &value));
+	zassert_equal(3, value);
+
+	sid_storage_cache_stats_get(&stats);
+	zassert_equal(0, stats.write_through);
+	zassert_equal(3, stats.writes);
+	zassert_equal(2, stats.coalesced);
+	zassert_equal(1, stats.flushed_records);
+
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_delete(CACHE_PROTOCOL_GROUP, CACHE_PROTOCOL_KEY));
+	zassert_equal(SID_ERROR_NONE, sid_storage_cache_sync());
+#endif /* CONFIG_SIDEWALK_STORAGE_CACHE_CRITICAL_PROTOCOL */
+}
+
+ZTEST(storage_cache, test_cache_delete)
+{
+	struct sid_storage_cache_stats stats;
+	const uint32_t value = 0xDEAD;
+	uint32_t read = 0;
+
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_set(CACHE_GROUP, 3, &value, sizeof(value)));
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_delete(CACHE_GROUP, 3));
+	zassert_equal(SID_ERROR_NOT_FOUND,
+		      sid_pal_storage_kv_record_get(CACHE_GROUP, 3, &read, sizeof(read)));
+
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_set(CACHE_GROUP, 4, &value, sizeof(value)));
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(CACHE_GROUP));
+	zassert_equal(SID_ERROR_NOT_FOUND,
+		      sid_pal_storage_kv_record_get(CACHE_GROUP, 4, &read, sizeof(read)));
+
+	/* The deleted records are not written by the flush. */
+	zassert_equal(SID_ERROR_NONE, sid_storage_cache_sync());
+	sid_storage_cache_stats_get(&stats);
+	zassert_equal(0, stats.flushed_records);
+}
+
+ZTEST(storage_cache, test_cache_full)
+{
+	struct sid_storage_cache_stats stats;
+
+	for (uint32_t i = 0; i <= CONFIG_SIDEWALK_STORAGE_CACHE_ENTRIES; i++) {
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_storage_kv_record_set(CACHE_GROUP, 0x100 + i, &i, sizeof(i)));
+	}
+
+	/* The last record did not fit, the others were flushed to make room for it. */
+	sid_storage_cache_stats_get(&stats);
+	zassert_equal(1, stats.flushes);
+	zassert_equal(CONFIG_SIDEWALK_STORAGE_CACHE_ENTRIES, stats.flushed_records);
+
+	for (uint32_t i = 0; i <= CONFIG_SIDEWALK_STORAGE_CACHE_ENTRIES; i++) {
+		uint32_t value = UINT32_MAX;
+
+		zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_get(CACHE_GROUP, 0x100 + i,
+									    &value, sizeof(value)));
+		zassert_equal(i, value);
+	}
+}
+
+ZTEST(storage_cache, test_cache_flush_delay)
+{
+	struct sid_storage_cache_stats stats;
+	const uint32_t value = 0xBEEF;
+	uint32_t read = 0;
+
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_set(CACHE_GROUP, 5, &value, sizeof(value)));
+	k_msleep(CONFIG_SIDEWALK_STORAGE_CACHE_FLUSH_DELAY_MS + 100);
+
+	zassert_equal(sizeof(read), flash_record_get(CACHE_GROUP, 5, &read));
+	zassert_equal(value, read);
+	sid_storage_cache_stats_get(&stats);
+	zassert_equal(1, stats.flushes);
+}
+
+static void storage_cache_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_init());
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(CACHE_GROUP));
+	zassert_equal(SID_ERROR_NONE, sid_storage_cache_sync());
+	sid_storage_cache_stats_reset();
+}
+
+static void storage_cache_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(CACHE_GROUP));
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(CACHE_CRITICAL_GROUP));
+}
+
+ZTEST_SUITE(storage_cache, NULL, NULL, storage_cache_before, storage_cache_after, NULL);
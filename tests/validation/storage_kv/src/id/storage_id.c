@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sid_pal_storage_kv_ifc.h>
+#include <settings_utils.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/ztest.h>
+#ifdef CONFIG_SETTINGS_NVS
+#include <zephyr/fs/nvs.h>
+#endif /* CONFIG_SETTINGS_NVS */
+
+#define ID_GROUP 0x40
+/* ID of the layout record of sid_storage_id.c. */
+#define ID_LAYOUT_ID 0x3fff
+/* Directory and value IDs of the record slots of sid_storage_id.c. */
+#define ID_DIR_BASE 0x4000
+#define ID_VALUE_BASE 0x6000
+/* Last slot of the ID range, over the slots of any build. */
+#define ID_SLOT_LAST (ID_VALUE_BASE - ID_DIR_BASE - 1)
+
+/* Layout record of sid_storage_id.c. */
+struct id_layout {
+	uint8_t version;
+	uint8_t migrated;
+	uint16_t slots;
+};
+
+#ifdef CONFIG_SETTINGS_NVS
+static struct id_layout id_layout_get(void *storage)
+{
+	struct id_layout layout = { 0 };
+
+	zassert_equal(sizeof(layout), nvs_read(storage, ID_LAYOUT_ID, &layout, sizeof(layout)));
+	return layout;
+}
+
+/* Writes the record to the slot directly, like a build with more slots. */
+static void id_slot_write(void *storage, uint16_t slot, uint16_t key, uint32_t value)
+{
+	const uint16_t dir[2] = { ID_GROUP, key };
+
+	zassert_equal(sizeof(value), nvs_write(storage, ID_VALUE_BASE + slot, &value, sizeof(value)));
+	zassert_equal(sizeof(dir), nvs_write(storage, ID_DIR_BASE + slot, dir, sizeof(dir)));
+}
+#endif /* CONFIG_SETTINGS_NVS */
+
+ZTEST(storage_id, test_id_set_get_len)
+{
+	const uint8_t value[6] = { 1, 2, 3, 4, 5, 6 };
+	uint8_t read[6] = { 0 };
+	uint32_t len = 0;
+
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_set(ID_GROUP, 1, value, sizeof(value)));
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_get_len(ID_GROUP, 1, &len));
+	zassert_equal(sizeof(value), len);
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_get(ID_GROUP, 1, read, len));
+	zassert_mem_equal(value, read, sizeof(value));
+
+	/* The record is stored without a settings entry. */
+	zassert_true(settings_utils_load_immediate_value("sidewalk/storage/0040/0001", read,
+							 sizeof(read)) <= 0);
+}
+
+ZTEST(storage_id, test_id_reinit)
+{
+	const uint32_t value = 0x5eed;
+	uint32_t read = 0;
+
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_set(ID_GROUP, 2, &value, sizeof(value)));
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_init());
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_get(ID_GROUP, 2, &read, sizeof(read)));
+	zassert_equal(value, read);
+}
+
+ZTEST(storage_id, test_id_migration)
+{
+#ifdef CONFIG_SETTINGS_NVS
+	const uint32_t value = 0xabcd;
+	uint32_t read = 0;
+	void *storage = NULL;
+
+	/* Record of the settings layout, and a device which has not migrated yet. */
+	zassert_equal(0, settings_save_one("sidewalk/storage/0040/0003", &value, sizeof(value)));
+	zassert_equal(0, settings_storage_get(&storage));
+	zassert_equal(0, nvs_delete(storage, ID_LAYOUT_ID));
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_init());
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_get(ID_GROUP, 3, &read, sizeof(read)));
+	zassert_equal(value, read);
+	zassert_true(settings_utils_load_immediate_value("sidewalk/storage/0040/0003", &read,
+							 sizeof(read)) <= 0);
+#else
+	ztest_test_skip();
+#endif /* CONFIG_SETTINGS_NVS */
+}
+
+ZTEST(storage_id, test_id_migration_too_large)
+{
+#ifdef CONFIG_SETTINGS_NVS
+	static uint8_t value[SETTINGS_MAX_VAL_LEN + 1];
+	void *storage = NULL;
+
+	zassert_equal(0, settings_save_one("sidewalk/storage/0040/0004", value, sizeof(value)));
+	zassert_equal(0, settings_storage_get(&storage));
+	zassert_equal(0, nvs_delete(storage, ID_LAYOUT_ID));
+
+	/* The record is kept in the settings and the migration is not marked done. */
+	zassert_equal(SID_ERROR_GENERIC, sid_pal_storage_kv_init());
+	zassert_false(id_layout_get(storage).migrated);
+	zassert_equal(sizeof(value), settings_utils_load_immediate_value(
+					     "sidewalk/storage/0040/0004", value, sizeof(value)));
+
+	/* Without the record the migration is finished. */
+	zassert_equal(0, settings_delete("sidewalk/storage/0040/0004"));
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_init());
+	zassert_true(id_layout_get(storage).migrated);
+#else
+	ztest_test_skip();
+#endif /* CONFIG_SETTINGS_NVS */
+}
+
+ZTEST(storage_id, test_id_slot_over_limit)
+{
+#ifdef CONFIG_SETTINGS_NVS
+	const uint32_t value = 0x10ad;
+	struct id_layout layout;
+	uint32_t read = 0;
+	void *storage = NULL;
+
+	/* Record written by a build with more slots, which raised the used slots. */
+	zassert_equal(0, settings_storage_get(&storage));
+	layout = id_layout_get(storage);
+	layout.slots = ID_SLOT_LAST + 1;
+	zassert_equal(sizeof(layout), nvs_write(storage, ID_LAYOUT_ID, &layout, sizeof(layout)));
+	id_slot_write(storage, ID_SLOT_LAST, 5, value);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_init());
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_get(ID_GROUP, 5, &read, sizeof(read)));
+	zassert_equal(value, read);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_delete(ID_GROUP, 5));
+	zassert_equal(-ENOENT, nvs_read(storage, ID_DIR_BASE + ID_SLOT_LAST, &read, sizeof(read)));
+
+	/* The next init reads only the slots still used. */
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_init());
+	zassert_true(id_layout_get(storage).slots <= CONFIG_SIDEWALK_STORAGE_ID_SLOTS);
+#else
+	ztest_test_skip();
+#endif /* CONFIG_SETTINGS_NVS */
+}
+
+ZTEST(storage_id, test_id_init_used_slots)
+{
+#ifdef CONFIG_SETTINGS_NVS
+	const uint32_t value = 0x5107;
+	struct id_layout layout;
+	uint32_t len = 0;
+	void *storage = NULL;
+
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_set(ID_GROUP, 6, &value, sizeof(value)));
+	zassert_equal(0, settings_storage_get(&storage));
+	layout = id_layout_get(storage);
+	zassert_true(layout.slots > 0 && layout.slots <= CONFIG_SIDEWALK_STORAGE_ID_SLOTS);
+
+	/* A slot over the used slots is not read by init. */
+	id_slot_write(storage, ID_SLOT_LAST, 7, value);
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_init());
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_get_len(ID_GROUP, 6, &len));
+	zassert_equal(SID_ERROR_NOT_FOUND, sid_pal_storage_kv_record_get_len(ID_GROUP, 7, &len));
+
+	zassert_equal(0, nvs_delete(storage, ID_DIR_BASE + ID_SLOT_LAST));
+	zassert_equal(0, nvs_delete(storage, ID_VALUE_BASE + ID_SLOT_LAST));
+#else
+	ztest_test_skip();
+#endif /* CONFIG_SETTINGS_NVS */
+}
+
+static void storage_id_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_init());
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(ID_GROUP));
+}
+
+static void storage_id_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(ID_GROUP));
+}
+
+ZTEST_SUITE(storage_id, NULL, NULL, storage_id_before, storage_id_after, NULL);
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sid_pal_storage_kv_ifc.h>
+#include <sid_storage_index.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define INDEX_GROUP 0x20
+#define INDEX_OTHER_GROUP 0x21
+
+ZTEST(storage_index, test_index_set_get)
+{
+	uint32_t records = sid_storage_index_records();
+	uint32_t value = 0;
+	uint32_t len = 0;
+
+	for (uint32_t i = 1; i <= 3; i++) {
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_storage_kv_record_set(INDEX_GROUP, i, &i, sizeof(i)));
+	}
+	zassert_true(sid_storage_index_is_complete());
+	zassert_equal(records + 3, sid_storage_index_records());
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_get_len(INDEX_GROUP, 2, &len));
+	zassert_equal(sizeof(value), len);
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_get(INDEX_GROUP, 2, &value, sizeof(value)));
+	zassert_equal(2, value);
+}
+
+ZTEST(storage_index, test_index_rebuild)
+{
+	const uint64_t value = 0x0123456789abcdefULL;
+	uint64_t read = 0;
+	uint32_t records;
+	uint32_t len = 0;
+
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_set(INDEX_GROUP, 1, &value, sizeof(value)));
+	records = sid_storage_index_records();
+
+	/* The index is built again from the records in flash. */
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_init());
+	zassert_true(sid_storage_index_is_complete());
+	zassert_equal(records, sid_storage_index_records());
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_get_len(INDEX_GROUP, 1, &len));
+	zassert_equal(sizeof(value), len);
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_get(INDEX_GROUP, 1, &read, sizeof(read)));
+	zassert_equal(value, read);
+}
+
+ZTEST(storage_index, test_index_update_len)
+{
+	const uint8_t short_value[2] = { 0xaa, 0xbb };
+	const uint8_t long_value[12] = { 0xcc };
+	uint32_t len = 0;
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_set(INDEX_GROUP, 4, short_value,
+								    sizeof(short_value)));
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_set(INDEX_GROUP, 4, long_value, sizeof(long_value)));
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_get_len(INDEX_GROUP, 4, &len));
+	zassert_equal(sizeof(long_value), len);
+}
+
+ZTEST(storage_index, test_index_missing)
+{
+	uint32_t value = 0;
+	uint32_t len = 0;
+
+	zassert_equal(SID_ERROR_NOT_FOUND,
+		      sid_pal_storage_kv_record_get(INDEX_GROUP, 0x99, &value, sizeof(value)));
+	zassert_equal(SID_ERROR_NOT_FOUND,
+		      sid_pal_storage_kv_record_get_len(INDEX_GROUP, 0x99, &len));
+}
+
+ZTEST(storage_index, test_index_delete)
+{
+	uint32_t records = sid_storage_index_records();
+	uint32_t value = 0;
+
+	for (uint32_t i = 1; i <= 4; i++) {
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_storage_kv_record_set(INDEX_GROUP, i, &i, sizeof(i)));
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_storage_kv_record_set(INDEX_OTHER_GROUP, i, &i, sizeof(i)));
+	}
+	zassert_equal(records + 8, sid_storage_index_records());
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_delete(INDEX_GROUP, 1));
+	zassert_equal(SID_ERROR_NOT_FOUND,
+		      sid_pal_storage_kv_record_get(INDEX_GROUP, 1, &value, sizeof(value)));
+	zassert_equal(records + 7, sid_storage_index_records());
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(INDEX_GROUP));
+	zassert_equal(records + 4, sid_storage_index_records());
+	for (uint32_t i = 1; i <= 4; i++) {
+		zassert_equal(SID_ERROR_NOT_FOUND,
+			      sid_pal_storage_kv_record_get(INDEX_GROUP, i, &value, sizeof(value)));
+		zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_get(INDEX_OTHER_GROUP, i,
+									    &value, sizeof(value)));
+		zassert_equal(i, value);
+	}
+}
+
+static void storage_index_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_init());
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(INDEX_GROUP));
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(INDEX_OTHER_GROUP));
+}
+
+static void storage_index_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(INDEX_GROUP));
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(INDEX_OTHER_GROUP));
+}
+
+ZTEST_SUITE(storage_index, NULL, NULL, storage_index_before, storage_index_after, NULL);
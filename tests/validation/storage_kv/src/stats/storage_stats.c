@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sid_pal_storage_kv_ifc.h>
+#include <sid_storage_stats.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <string.h>
+
+#define STATS_GROUP 0x60
+#define STATS_OTHER_GROUP 0x61
+
+static struct sid_storage_stats stats;
+
+static const struct sid_storage_stats_group *stats_group_find(uint16_t group)
+{
+	for (int i = 0; i < SID_STORAGE_STATS_GROUPS; i++) {
+		if ((stats.groups[i].writes || stats.groups[i].deletes) &&
+		    stats.groups[i].group == group) {
+			return &stats.groups[i];
+		}
+	}
+	return NULL;
+}
+
+ZTEST(storage_stats, test_stats_group_counters)
+{
+	const uint8_t value[10] = { 0 };
+	const struct sid_storage_stats_group *entry;
+
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_set(STATS_GROUP, 1, value, sizeof(value)));
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_set(STATS_GROUP, 2, value, 4));
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_delete(STATS_GROUP, 2));
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_set(STATS_OTHER_GROUP, 1, value, 1));
+
+	sid_storage_stats_get(&stats);
+	entry = stats_group_find(STATS_GROUP);
+	zassert_not_null(entry);
+	zassert_equal(2, entry->writes);
+	zassert_equal(sizeof(value) + 4, entry->bytes);
+	zassert_equal(1, entry->deletes);
+	/* The delete is committed with the write of the other group. */
+	zassert_equal(3, entry->commits);
+	zassert_equal(3, stats.backend.commits);
+
+	entry = stats_group_find(STATS_OTHER_GROUP);
+	zassert_not_null(entry);
+	zassert_equal(1, entry->writes);
+	zassert_equal(0, entry->deletes);
+	zassert_equal(1, entry->commits);
+}
+
+ZTEST(storage_stats, test_stats_hot_key)
+{
+	const uint32_t value = 0x1234;
+	bool found = false;
+
+	for (int i = 0; i < 5; i++) {
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_storage_kv_record_set(STATS_GROUP, 3, &value, sizeof(value)));
+	}
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_set(STATS_GROUP, 4, &value, sizeof(value)));
+
+	sid_storage_stats_get(&stats);
+	for (int i = 0; i < SID_STORAGE_STATS_KEYS; i++) {
+		if (stats.keys[i].writes && stats.keys[i].group == STATS_GROUP &&
+		    stats.keys[i].key == 3) {
+			zassert_equal(5, stats.keys[i].writes);
+			found = true;
+		}
+	}
+	zassert_true(found);
+}
+
+ZTEST(storage_stats, test_stats_save_reset)
+{
+	const uint32_t value = 0x5678;
+
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_set(STATS_GROUP, 5, &value, sizeof(value)));
+	zassert_equal(SID_ERROR_NONE, sid_storage_stats_save());
+	sid_storage_stats_get(&stats);
+	zassert_equal(1, stats.saves);
+
+	/* Kept over a reinit of the storage. */
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_init());
+	sid_storage_stats_get(&stats);
+	zassert_not_null(stats_group_find(STATS_GROUP));
+	zassert_equal(1, stats.saves);
+
+	zassert_equal(SID_ERROR_NONE, sid_storage_stats_reset());
+	sid_storage_stats_get(&stats);
+	zassert_is_null(stats_group_find(STATS_GROUP));
+	zassert_equal(0, stats.backend.commits);
+	zassert_equal(0, stats.saves);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_init());
+	sid_storage_stats_get(&stats);
+	zassert_is_null(stats_group_find(STATS_GROUP));
+}
+
+static void storage_stats_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_init());
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(STATS_GROUP));
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(STATS_OTHER_GROUP));
+	zassert_equal(SID_ERROR_NONE, sid_storage_stats_reset());
+}
+
+static void storage_stats_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(STATS_GROUP));
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(STATS_OTHER_GROUP));
+}
+
+ZTEST_SUITE(storage_stats, NULL, NULL, storage_stats_before, storage_stats_after, NULL);
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sid_pal_storage_kv_ifc.h>
+#include <sid_storage_txn.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/ztest.h>
+#include <string.h>
+
+#define TXN_GROUP 0x50
+#define TXN_OTHER_GROUP 0x51
+
+ZTEST(storage_txn, test_txn_commit)
+{
+	const uint32_t first = 0x1111;
+	const uint8_t second[5] = { 1, 2, 3, 4, 5 };
+	uint8_t read[5] = { 0 };
+	uint32_t len = 0;
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_txn_begin());
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_set(TXN_GROUP, 1, &first, sizeof(first)));
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_set(TXN_GROUP, 2, second, sizeof(second)));
+
+	/* The thread of the transaction reads its staged values. */
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_get_len(TXN_GROUP, 2, &len));
+	zassert_equal(sizeof(second), len);
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_get(TXN_GROUP, 2, read, len));
+	zassert_mem_equal(second, read, sizeof(second));
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_txn_commit());
+
+	/* Stored after a reinit as well. */
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_init());
+	memset(read, 0, sizeof(read));
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_get(TXN_GROUP, 1, read, 4));
+	zassert_mem_equal(&first, read, sizeof(first));
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_get(TXN_GROUP, 2, read, sizeof(read)));
+	zassert_mem_equal(second, read, sizeof(second));
+}
+
+ZTEST(storage_txn, test_txn_abort)
+{
+	const uint32_t stored = 0x2222;
+	const uint32_t staged = 0x3333;
+	uint32_t read = 0;
+
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_set(TXN_GROUP, 3, &stored, sizeof(stored)));
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_txn_begin());
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_set(TXN_GROUP, 3, &staged, sizeof(staged)));
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_set(TXN_GROUP, 4, &staged, sizeof(staged)));
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_txn_abort());
+
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_get(TXN_GROUP, 3, &read, sizeof(read)));
+	zassert_equal(stored, read);
+	zassert_equal(SID_ERROR_NOT_FOUND,
+		      sid_pal_storage_kv_record_get(TXN_GROUP, 4, &read, sizeof(read)));
+}
+
+ZTEST(storage_txn, test_txn_delete)
+{
+	const uint32_t value = 0x4444;
+	uint32_t read = 0;
+	uint32_t len = 0;
+
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_set(TXN_GROUP, 5, &value, sizeof(value)));
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_set(TXN_OTHER_GROUP, 1, &value, sizeof(value)));
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_txn_begin());
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_record_delete(TXN_GROUP, 5));
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(TXN_OTHER_GROUP));
+	/* Written again after the delete of its group. */
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_set(TXN_OTHER_GROUP, 2, &value, sizeof(value)));
+
+	zassert_equal(SID_ERROR_NOT_FOUND, sid_pal_storage_kv_record_get_len(TXN_GROUP, 5, &len));
+	zassert_equal(SID_ERROR_NOT_FOUND,
+		      sid_pal_storage_kv_record_get(TXN_OTHER_GROUP, 1, &read, sizeof(read)));
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_get(TXN_OTHER_GROUP, 2, &read, sizeof(read)));
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_txn_commit());
+
+	zassert_equal(SID_ERROR_NOT_FOUND,
+		      sid_pal_storage_kv_record_get(TXN_GROUP, 5, &read, sizeof(read)));
+	zassert_equal(SID_ERROR_NOT_FOUND,
+		      sid_pal_storage_kv_record_get(TXN_OTHER_GROUP, 1, &read, sizeof(read)));
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_get(TXN_OTHER_GROUP, 2, &read, sizeof(read)));
+	zassert_equal(value, read);
+}
+
+ZTEST(storage_txn, test_txn_state)
+{
+	uint8_t value[CONFIG_SIDEWALK_STORAGE_TXN_BUF_SIZE] = { 0 };
+
+	zassert_equal(SID_ERROR_INVALID_STATE, sid_pal_storage_kv_txn_commit());
+	zassert_equal(SID_ERROR_INVALID_STATE, sid_pal_storage_kv_txn_abort());
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_txn_begin());
+	zassert_equal(SID_ERROR_BUSY, sid_pal_storage_kv_txn_begin());
+	zassert_equal(SID_ERROR_BUFFER_OVERFLOW,
+		      sid_pal_storage_kv_record_set(TXN_GROUP, 6, value, sizeof(value)));
+	zassert_equal(SID_ERROR_INVALID_ARGS,
+		      sid_pal_storage_kv_record_set(SID_STORAGE_TXN_JOURNAL_GROUP, 0, value, 1));
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_txn_abort());
+}
+
+ZTEST(storage_txn, test_txn_journal_replay)
+{
+#ifndef CONFIG_SIDEWALK_STORAGE_BACKEND_ID
+	/* Journal of a transaction interrupted before its operations were applied. */
+	struct {
+		uint32_t crc;
+		uint16_t len;
+		uint16_t version;
+		uint8_t type;
+		uint8_t reserved;
+		uint16_t group;
+		uint16_t key;
+		uint16_t value_len;
+		uint32_t value;
+	} __packed journal = { .len = 12,
+			       .version = 1,
+			       .type = 1,
+			       .group = TXN_GROUP,
+			       .key = 7,
+			       .value_len = 4,
+			       .value = 0x5555 };
+	uint32_t read = 0;
+
+	journal.crc = crc32_ieee((uint8_t *)&journal.type, journal.len);
+	zassert_equal(0, settings_save_one("sidewalk/storage/ffff/0000", &journal, sizeof(journal)));
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_init());
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_storage_kv_record_get(TXN_GROUP, 7, &read, sizeof(read)));
+	zassert_equal(journal.value, read);
+	zassert_equal(SID_ERROR_NOT_FOUND,
+		      sid_pal_storage_kv_record_get(SID_STORAGE_TXN_JOURNAL_GROUP,
+						    SID_STORAGE_TXN_JOURNAL_KEY, &read, sizeof(read)));
+#else
+	ztest_test_skip();
+#endif /* CONFIG_SIDEWALK_STORAGE_BACKEND_ID */
+}
+
+static void storage_txn_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_init());
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(TXN_GROUP));
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(TXN_OTHER_GROUP));
+}
+
+static void storage_txn_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	(void)sid_pal_storage_kv_txn_abort();
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(TXN_GROUP));
+	zassert_equal(SID_ERROR_NONE, sid_pal_storage_kv_group_delete(TXN_OTHER_GROUP));
+}
+
+ZTEST_SUITE(storage_txn, NULL, NULL, storage_txn_before, storage_txn_after, NULL);
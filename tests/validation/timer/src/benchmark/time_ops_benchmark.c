@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sid_time_ops.h>
+#include <sid_time_ops_inline.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/ztest.h>
+
+#define BENCH_SAMPLES 256
+#define BENCH_ROUNDS 100
+
+/* The library functions are called through the parentheses, so they are not replaced by
+ * the inline variants when CONFIG_SIDEWALK_TIME_OPS_INLINE is enabled.
+ */
+
+static struct sid_timespec bench_times[BENCH_SAMPLES];
+static uint32_t bench_values[BENCH_SAMPLES];
+static uint32_t bench_seed;
+static volatile uint32_t bench_sink;
+
+static const struct sid_timespec edge_times[] = {
+	{ .tv_sec = 0, .tv_nsec = 0 },
+	{ .tv_sec = 0, .tv_nsec = 1 },
+	{ .tv_sec = 0, .tv_nsec = 999999999 },
+	{ .tv_sec = 0, .tv_nsec = 1000000000 },
+	{ .tv_sec = 1, .tv_nsec = 3999999999 },
+	{ .tv_sec = 1, .tv_nsec = UINT32_MAX },
+	{ .tv_sec = 4294966, .tv_nsec = 999999 },
+	{ .tv_sec = 0x7FFFFFFF, .tv_nsec = 500000000 },
+	{ .tv_sec = UINT32_MAX - 5, .tv_nsec = 2000000000 },
+	{ .tv_sec = UINT32_MAX, .tv_nsec = 999999999 },
+	{ .tv_sec = UINT32_MAX, .tv_nsec = UINT32_MAX },
+};
+
+static const uint32_t edge_values[] = { 0,	 1,	  999,	    1000,      999999,	  1000000,
+					4294967, 4294968, 999999999, 1000000000, 4294967294, UINT32_MAX };
+
+static uint32_t bench_rand(void)
+{
+	bench_seed = bench_seed * 1664525u + 1013904223u;
+	return bench_seed;
+}
+
+static void assert_timespec_equal(const struct sid_timespec *lib, const struct sid_timespec *inl)
+{
+	zassert_equal(lib->tv_sec, inl->tv_sec, "sec lib %u inline %u", lib->tv_sec, inl->tv_sec);
+	zassert_equal(lib->tv_nsec, inl->tv_nsec, "nsec lib %u inline %u", lib->tv_nsec,
+		      inl->tv_nsec);
+}
+
+static uint64_t bench_cycles_per_op(timing_t start, timing_t end)
+{
+	return timing_cycles_get(&start, &end) / (BENCH_SAMPLES * BENCH_ROUNDS);
+}
+
+#define BENCH_OP(name, lib_expr, inline_expr)                                                      \
+	do {                                                                                       \
+		timing_t start, end;                                                               \
+		uint64_t lib_cycles, inline_cycles;                                                \
+                                                                                                   \
+		start = timing_counter_get();                                                      \
+		for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {                          \
+			for (uint32_t i = 0; i < BENCH_SAMPLES; i++) {                             \
+				lib_expr                                                           \
+			}                                                                          \
+		}                                                                                  \
+		end = timing_counter_get();                                                        \
+		lib_cycles = bench_cycles_per_op(start, end);                                      \
+                                                                                                   \
+		start = timing_counter_get();                                                      \
+		for (uint32_t round = 0; round < BENCH_ROUNDS; round++) {                          \
+			for (uint32_t i = 0; i < BENCH_SAMPLES; i++) {                             \
+				inline_expr                                                        \
+			}                                                                          \
+		}                                                                                  \
+		end = timing_counter_get();                                                        \
+		inline_cycles = bench_cycles_per_op(start, end);                                   \
+                                                                                                   \
+		TC_PRINT("%-22s lib: %4llu cyc/op inline: %4llu cyc/op\n", name, lib_cycles,       \
+			 inline_cycles);                                                           \
+	} while (0)
+
+ZTEST(time_ops_benchmark, test_time_ops_edge_cases)
+{
+	struct sid_timespec lib, inl;
+
+	for (size_t i = 0; i < ARRAY_SIZE(edge_times); i++) {
+		const struct sid_timespec *tm1 = &edge_times[i];
+
+		for (size_t j = 0; j < ARRAY_SIZE(edge_times); j++) {
+			const struct sid_timespec *tm2 = &edge_times[j];
+
+			zassert_equal((sid_time_gt)(tm1, tm2), sid_time_gt_inline(tm1, tm2));
+			zassert_equal((sid_time_lt)(tm1, tm2), sid_time_lt_inline(tm1, tm2));
+			zassert_equal((sid_time_eq)(tm1, tm2), sid_time_eq_inline(tm1, tm2));
+
+			/* Skip the cases the library asserts on. */
+			lib = *tm1;
+			inl = *tm2;
+			(sid_time_normalize)(&lib);
+			(sid_time_normalize)(&inl);
+			if (lib.tv_sec <= UINT32_MAX - inl.tv_sec) {
+				lib = *tm1;
+				inl = *tm1;
+				(sid_time_add)(&lib, tm2);
+				sid_time_add_inline(&inl, tm2);
+				assert_timespec_equal(&lib, &inl);
+			}
+			if (!(sid_time_gt)(tm2, tm1)) {
+				(sid_time_delta)(&lib, tm1, tm2);
+				sid_time_delta_inline(&inl, tm1, tm2);
+				assert_timespec_equal(&lib, &inl);
+			}
+		}
+
+		lib = *tm1;
+		inl = *tm1;
+		(sid_time_normalize)(&lib);
+		sid_time_normalize_inline(&inl);
+		assert_timespec_equal(&lib, &inl);
+
+		zassert_equal((sid_time_is_infinity)(tm1), sid_time_is_infinity_inline(tm1));
+		zassert_equal((sid_time_is_zero)(tm1), sid_time_is_zero_inline(tm1));
+		zassert_equal((sid_timespec_to_ms)(tm1), sid_timespec_to_ms_inline(tm1));
+		zassert_equal((sid_timespec_to_ms_64)(tm1), sid_timespec_to_ms_64_inline(tm1));
+		zassert_equal((sid_timespec_to_us)(tm1), sid_timespec_to_us_inline(tm1));
+		zassert_equal((sid_timespec_to_us_64)(tm1), sid_timespec_to_us_64_inline(tm1));
+
+		for (size_t j = 0; j < ARRAY_SIZE(edge_values); j++) {
+			lib = (sid_add_ms_to_timespec_ret)(*tm1, edge_values[j]);
+			inl = sid_add_ms_to_timespec_ret_inline(*tm1, edge_values[j]);
+			assert_timespec_equal(&lib, &inl);
+		}
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(edge_values); i++) {
+		(sid_ms_to_timespec)(edge_values[i], &lib);
+		sid_ms_to_timespec_inline(edge_values[i], &inl);
+		assert_timespec_equal(&lib, &inl);
+
+		(sid_us_to_timespec)(edge_values[i], &lib);
+		sid_us_to_timespec_inline(edge_values[i], &inl);
+		assert_timespec_equal(&lib, &inl);
+
+		(sid_ms_to_timespec_64)((uint64_t)edge_values[i] * 1000, &lib);
+		sid_ms_to_timespec_64_inline((uint64_t)edge_values[i] * 1000, &inl);
+		assert_timespec_equal(&lib, &inl);
+	}
+}
+
+ZTEST(time_ops_benchmark, test_time_ops_cost)
+{
+	struct sid_timespec tm;
+
+	TC_PRINT("time ops: %s\n",
+		 IS_ENABLED(CONFIG_SIDEWALK_TIME_OPS_INLINE) ? "inline enabled" : "library");
+
+	BENCH_OP("sid_time_gt", { bench_sink += (sid_time_gt)(&bench_times[i], &bench_times[0]); },
+		 { bench_sink += sid_time_gt_inline(&bench_times[i], &bench_times[0]); });
+
+	BENCH_OP("sid_time_add",
+		 {
+			 tm = bench_times[i];
+			 (sid_time_add)(&tm, &bench_times[0]);
+			 bench_sink += tm.tv_nsec;
+		 },
+		 {
+			 tm = bench_times[i];
+			 sid_time_add_inline(&tm, &bench_times[0]);
+			 bench_sink += tm.tv_nsec;
+		 });
+
+	BENCH_OP("sid_time_sub",
+		 {
+			 tm = bench_times[i];
+			 (sid_time_sub)(&tm, &bench_times[0]);
+			 bench_sink += tm.tv_nsec;
+		 },
+		 {
+			 tm = bench_times[i];
+			 sid_time_sub_inline(&tm, &bench_times[0]);
+			 bench_sink += tm.tv_nsec;
+		 });
+
+	BENCH_OP("sid_timespec_to_ms", { bench_sink += (sid_timespec_to_ms)(&bench_times[i]); },
+		 { bench_sink += sid_timespec_to_ms_inline(&bench_times[i]); });
+
+	BENCH_OP("sid_ms_to_timespec",
+		 {
+			 (sid_ms_to_timespec)(bench_values[i], &tm);
+			 bench_sink += tm.tv_nsec;
+		 },
+		 {
+			 sid_ms_to_timespec_inline(bench_values[i], &tm);
+			 bench_sink += tm.tv_nsec;
+		 });
+
+	BENCH_OP("sid_us_to_timespec",
+		 {
+			 (sid_us_to_timespec)(bench_values[i], &tm);
+			 bench_sink += tm.tv_nsec;
+		 },
+		 {
+			 sid_us_to_timespec_inline(bench_values[i], &tm);
+			 bench_sink += tm.tv_nsec;
+		 });
+
+	BENCH_OP("sid_add_ms_to_timespec",
+		 {
+			 tm = bench_times[i];
+			 (sid_add_ms_to_timespec)(&tm, bench_values[i]);
+			 bench_sink += tm.tv_nsec;
+		 },
+		 {
+			 tm = bench_times[i];
+			 sid_add_ms_to_timespec_inline(&tm, bench_values[i]);
+			 bench_sink += tm.tv_nsec;
+		 });
+}
+
+static void *time_ops_bench_setup(void)
+{
+	timing_init();
+	timing_start();
+
+	/* Deterministic normalized samples, later than bench_times[0], far from overflow. */
+	bench_seed = 1;
+	for (size_t i = 0; i < ARRAY_SIZE(bench_times); i++) {
+		bench_times[i].tv_sec = 1000 + (bench_rand() >> 12);
+		bench_times[i].tv_nsec = bench_rand() % SID_TIME_NSEC_PER_SEC;
+		bench_values[i] = bench_rand() >> 4;
+	}
+	bench_times[0] = (struct sid_timespec){ .tv_sec = 1000, .tv_nsec = 0 };
+
+	return NULL;
+}
+
+static void time_ops_bench_teardown(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	timing_stop();
+}
+
+ZTEST_SUITE(time_ops_benchmark, NULL, time_ops_bench_setup, NULL, NULL,
+	    time_ops_bench_teardown);
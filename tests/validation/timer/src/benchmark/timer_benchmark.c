@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sid_pal_timer_ifc.h>
+#include <sid_pal_uptime_ifc.h>
+#include <sid_time_ops.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/ztest.h>
+
+#if defined(CONFIG_ARCH_POSIX) && defined(CONFIG_EXTERNAL_LIBC)
+/* The simulated time does not advance while the code runs, so the host clock is used. */
+#include <time.h>
+#define BENCH_HOST_CLOCK 1
+#endif
+
+#define BENCH_TIMERS_MAX 1000
+/* Armed timers are far in the future, so the hardware timer never fires during the benchmark. */
+#define BENCH_ALARM_BASE_S 3600
+#define BENCH_ALARM_SPREAD_MS 100000
+
+static sid_pal_timer_t bench_timers[BENCH_TIMERS_MAX];
+static uint32_t bench_fired;
+static uint32_t bench_seed;
+
+static const uint32_t bench_sizes[] = { 10, 50, 100, 500, 1000 };
+
+static void bench_timer_cb(void *arg, sid_pal_timer_t *originator)
+{
+	ARG_UNUSED(arg);
+	ARG_UNUSED(originator);
+	bench_fired++;
+}
+
+/* Deterministic pseudo random alarms, to get comparable results between runs. */
+static uint32_t bench_rand(void)
+{
+	bench_seed = bench_seed * 1664525u + 1013904223u;
+	return bench_seed >> 8;
+}
+
+struct bench_result {
+	uint64_t ns;
+	uint64_t cycles;
+};
+
+static timing_t bench_now(void)
+{
+#ifdef BENCH_HOST_CLOCK
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (timing_t)now.tv_sec * NSEC_PER_SEC + now.tv_nsec;
+#else
+	return timing_counter_get();
+#endif /* BENCH_HOST_CLOCK */
+}
+
+static struct bench_result bench_per_op(timing_t start, timing_t end, uint32_t ops)
+{
+#ifdef BENCH_HOST_CLOCK
+	/* The host clock counts nanoseconds, cycles are not reported. */
+	return (struct bench_result){ .ns = (end - start) / ops, .cycles = 0 };
+#else
+	uint64_t cycles = timing_cycles_get(&start, &end);
+
+	return (struct bench_result){ .ns = timing_cycles_to_ns(cycles) / ops,
+				      .cycles = cycles / ops };
+#endif /* BENCH_HOST_CLOCK */
+}
+
+static void bench_arm_all(uint32_t count)
+{
+	struct sid_timespec now;
+
+	sid_pal_uptime_now(&now);
+	for (uint32_t i = 0; i < count; i++) {
+		struct sid_timespec when = now;
+
+		when.tv_sec += BENCH_ALARM_BASE_S;
+		sid_add_ms_to_timespec(&when, bench_rand() % BENCH_ALARM_SPREAD_MS);
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_timer_arm(&bench_timers[i], SID_PAL_TIMER_PRIO_CLASS_PRECISE,
+						&when, NULL));
+	}
+}
+
+static void bench_run(uint32_t count)
+{
+	timing_t start, end;
+	struct bench_result arm, cancel, fire;
+
+	bench_seed = count;
+
+	start = bench_now();
+	bench_arm_all(count);
+	end = bench_now();
+	arm = bench_per_op(start, end, count);
+
+	/* Cancel in an order unrelated to the alarm order. */
+	start = bench_now();
+	for (uint32_t i = 0; i < count; i++) {
+		sid_pal_timer_cancel(&bench_timers[(i * 7) % count]);
+	}
+	end = bench_now();
+	cancel = bench_per_op(start, end, count);
+
+	for (uint32_t i = 0; i < count; i++) {
+		zassert_false(sid_pal_timer_is_armed(&bench_timers[i]));
+	}
+
+	bench_arm_all(count);
+	struct sid_timespec fire_time;
+
+	/* Later than every armed alarm. */
+	sid_pal_uptime_now(&fire_time);
+	fire_time.tv_sec += 2 * BENCH_ALARM_BASE_S;
+	bench_fired = 0;
+	start = bench_now();
+	sid_pal_timer_event_callback(NULL, &fire_time);
+	end = bench_now();
+	fire = bench_per_op(start, end, count);
+
+	zassert_equal(count, bench_fired, "fired %u of %u timers", bench_fired, count);
+
+	TC_PRINT("timers: %4u arm: %6llu ns/op %6llu cyc/op cancel: %6llu ns/op %6llu cyc/op "
+		 "fire: %6llu ns/op %6llu cyc/op\n",
+		 count, arm.ns, arm.cycles, cancel.ns, cancel.cycles, fire.ns, fire.cycles);
+}
+
+ZTEST(pal_timer_benchmark, test_timer_queue_cost)
+{
+	TC_PRINT("timer queue: %s, alarms: %s\n",
+		 IS_ENABLED(CONFIG_SIDEWALK_TIMER_QUEUE_HEAP) ? "pairing heap" : "sorted list",
+		 IS_ENABLED(CONFIG_SIDEWALK_TIMER_TICKS) ? "ticks" : "timespec");
+	for (size_t i = 0; i < ARRAY_SIZE(bench_sizes); i++) {
+		bench_run(bench_sizes[i]);
+	}
+}
+
+static void *bench_setup(void)
+{
+	timing_init();
+	timing_start();
+
+	for (size_t i = 0; i < ARRAY_SIZE(bench_timers); i++) {
+		zassert_equal(SID_ERROR_NONE,
+			      sid_pal_timer_init(&bench_timers[i], bench_timer_cb, NULL));
+	}
+
+	return NULL;
+}
+
+static void bench_teardown(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	for (size_t i = 0; i < ARRAY_SIZE(bench_timers); i++) {
+		sid_pal_timer_deinit(&bench_timers[i]);
+	}
+	timing_stop();
+}
+
+ZTEST_SUITE(pal_timer_benchmark, NULL, bench_setup, NULL, NULL, bench_teardown);
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <sid_pal_timer_ifc.h>
+#include <sid_pal_uptime_ifc.h>
+#include <sid_time_ops.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define WORKQ_LOWPOWER_DELAY_MS 10
+#define WORKQ_LOWPOWER_BUSY_MS 300
+#define WORKQ_PRECISE_PERIOD_MS 20
+#define WORKQ_PRECISE_SAMPLES 10
+/* Far below the time blocked by the low power callback. */
+#define WORKQ_PRECISE_LATENCY_MAX_US 2000
+
+static sid_pal_timer_t lowpower_timer;
+static sid_pal_timer_t precise_timer;
+
+static K_SEM_DEFINE(workq_done_sem, 0, 2);
+
+static struct sid_timespec lowpower_begin;
+static struct sid_timespec lowpower_end;
+static struct sid_timespec precise_alarm;
+static struct sid_timespec precise_period;
+static uint32_t precise_latency_us[WORKQ_PRECISE_SAMPLES];
+static uint32_t precise_during_lowpower;
+static uint32_t precise_count;
+
+static void lowpower_cb(void *arg, sid_pal_timer_t *originator)
+{
+	ARG_UNUSED(arg);
+	ARG_UNUSED(originator);
+
+	sid_pal_uptime_now(&lowpower_begin);
+	/* A slow application callback, blocks its thread without yielding. */
+	k_busy_wait(WORKQ_LOWPOWER_BUSY_MS * USEC_PER_MSEC);
+	sid_pal_uptime_now(&lowpower_end);
+	k_sem_give(&workq_done_sem);
+}
+
+static void precise_cb(void *arg, sid_pal_timer_t *originator)
+{
+	struct sid_timespec now;
+
+	ARG_UNUSED(arg);
+	ARG_UNUSED(originator);
+
+	sid_pal_uptime_now(&now);
+	if (precise_count >= WORKQ_PRECISE_SAMPLES) {
+		return;
+	}
+
+	if (sid_time_gt(&now, &lowpower_begin) && sid_time_is_zero(&lowpower_end)) {
+		precise_during_lowpower++;
+	}
+	precise_latency_us[precise_count] = 0;
+	if (sid_time_gt(&now, &precise_alarm)) {
+		sid_time_sub(&now, &precise_alarm);
+		precise_latency_us[precise_count] = sid_timespec_to_us(&now);
+	}
+	sid_time_add(&precise_alarm, &precise_period);
+
+	if (++precise_count == WORKQ_PRECISE_SAMPLES) {
+		k_sem_give(&workq_done_sem);
+	}
+}
+
+ZTEST(pal_timer_workq, test_precise_latency_with_slow_lowpower_callback)
+{
+	struct sid_timespec now, lowpower_alarm;
+	uint32_t latency_max = 0;
+	uint64_t latency_sum = 0;
+
+	sid_ms_to_timespec(WORKQ_PRECISE_PERIOD_MS, &precise_period);
+	sid_pal_uptime_now(&now);
+	lowpower_alarm = now;
+	sid_add_ms_to_timespec(&lowpower_alarm, WORKQ_LOWPOWER_DELAY_MS);
+	precise_alarm = now;
+	sid_time_add(&precise_alarm, &precise_period);
+
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_timer_arm(&lowpower_timer, SID_PAL_TIMER_PRIO_CLASS_LOWPOWER,
+					&lowpower_alarm, NULL));
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_timer_arm(&precise_timer, SID_PAL_TIMER_PRIO_CLASS_PRECISE,
+					&precise_alarm, &precise_period));
+
+	zassert_equal(0, k_sem_take(&workq_done_sem, K_MSEC(2 * WORKQ_LOWPOWER_BUSY_MS)));
+	zassert_equal(0, k_sem_take(&workq_done_sem, K_MSEC(2 * WORKQ_LOWPOWER_BUSY_MS)));
+	sid_pal_timer_cancel(&precise_timer);
+
+	for (uint32_t i = 0; i < WORKQ_PRECISE_SAMPLES; i++) {
+		latency_max = MAX(latency_max, precise_latency_us[i]);
+		latency_sum += precise_latency_us[i];
+	}
+	TC_PRINT("precise latency: max %u us avg %llu us, %u of %u fired during low power callback\n",
+		 latency_max, latency_sum / WORKQ_PRECISE_SAMPLES, precise_during_lowpower,
+		 WORKQ_PRECISE_SAMPLES);
+
+	zassert_true(precise_during_lowpower > 0, "precise timers waited for low power callback");
+	zassert_true(latency_max <= WORKQ_PRECISE_LATENCY_MAX_US, "precise latency %u us",
+		     latency_max);
+}
+
+ZTEST(pal_timer_workq, test_canceled_timer_callback_is_not_dispatched)
+{
+	struct sid_timespec now, alarm;
+	uint32_t count;
+
+	/* Keep the low power queue busy, so the callback of the canceled timer stays pending. */
+	sid_pal_uptime_now(&now);
+	alarm = now;
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_timer_arm(&lowpower_timer, SID_PAL_TIMER_PRIO_CLASS_LOWPOWER, &alarm,
+					NULL));
+	k_msleep(WORKQ_LOWPOWER_DELAY_MS);
+	sid_ms_to_timespec(WORKQ_PRECISE_PERIOD_MS, &precise_period);
+	zassert_equal(SID_ERROR_NONE,
+		      sid_pal_timer_arm(&precise_timer, SID_PAL_TIMER_PRIO_CLASS_LOWPOWER, &alarm,
+					NULL));
+	sid_pal_timer_cancel(&precise_timer);
+	count = precise_count;
+
+	zassert_equal(0, k_sem_take(&workq_done_sem, K_MSEC(2 * WORKQ_LOWPOWER_BUSY_MS)));
+	k_msleep(WORKQ_LOWPOWER_DELAY_MS);
+	zassert_equal(count, precise_count);
+}
+
+static void workq_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_sem_reset(&workq_done_sem);
+	lowpower_begin = SID_TIME_INFINITY;
+	lowpower_end = SID_TIME_ZERO;
+	precise_during_lowpower = 0;
+	precise_count = 0;
+	zassert_equal(SID_ERROR_NONE, sid_pal_timer_init(&lowpower_timer, lowpower_cb, NULL));
+	zassert_equal(SID_ERROR_NONE, sid_pal_timer_init(&precise_timer, precise_cb, NULL));
+}
+
+static void workq_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	sid_pal_timer_deinit(&lowpower_timer);
+	sid_pal_timer_deinit(&precise_timer);
+}
+
+ZTEST_SUITE(pal_timer_workq, NULL, NULL, workq_before, workq_after, NULL);
@@ -12,6 +12,9 @@
 #include <zephyr/kernel.h>
 
 #include <zephyr/logging/log.h>
+#ifdef CONFIG_SIDEWALK_STORAGE_STATS
+#include <sid_storage_stats.h>
+#endif /* CONFIG_SIDEWALK_STORAGE_STATS */
 LOG_MODULE_REGISTER(settings_utils, CONFIG_SIDEWALK_LOG_LEVEL);
 
 /**
@@ -108,12 +111,17 @@ app_start_t application_to_start(void)
 						  &dfu_mode, sizeof(dfu_mode));
 
 	if (dfu_mode) {
-		dfu_mode = false;
-		int rc = settings_save_one(CONFIG_DEPRECATED_DFU_FLAG_SETTINGS_KEY,
-					   (const void *)&dfu_mode, sizeof(dfu_mode));
+		/* A missing flag loads as false. */
+		int rc = settings_delete(CONFIG_DEPRECATED_DFU_FLAG_SETTINGS_KEY);
 		if (rc) {
 			LOG_ERR("Failed to erase DFU flag from persistant storage, Err = %d", rc);
 		}
+#ifdef CONFIG_SIDEWALK_STORAGE_STATS
+		if (!rc) {
+			sid_storage_stats_source_erase(SID_STORAGE_STATS_SETTINGS_UTILS,
+						       sizeof(dfu_mode));
+		}
+#endif /* CONFIG_SIDEWALK_STORAGE_STATS */
 		return DFU_APPLICATION;
 	}
 #endif /* CONFIG_SIDEWALK_DFU_SERVICE_BLE */
@@ -136,6 +144,11 @@ int settings_utils_link_mask_set(uint32_t link_mask)
 {
 	int ret = settings_save_one(CONFIG_PERSISTENT_LINK_MASK_SETTINGS_KEY,
 				    (const void *)&link_mask, sizeof(link_mask));
+#ifdef CONFIG_SIDEWALK_STORAGE_STATS
+	if (!ret) {
+		sid_storage_stats_source_write(SID_STORAGE_STATS_SETTINGS_UTILS, sizeof(link_mask));
+	}
+#endif /* CONFIG_SIDEWALK_STORAGE_STATS */
 	ret |= settings_commit();
 	return ret;
 }
@@ -10,6 +10,9 @@
 #include <dfu/dfu_target_mcuboot.h>
 
 #include <zephyr/logging/log.h>
+#ifdef CONFIG_SIDEWALK_STORAGE_STATS
+#include <sid_storage_stats.h>
+#endif /* CONFIG_SIDEWALK_STORAGE_STATS */
 
 LOG_MODULE_REGISTER(nordic_dfu_img, CONFIG_SIDEWALK_LOG_LEVEL);
 
@@ -40,7 +43,13 @@ static int open(int image_id, size_t image_size)
 
 static int write(const uint8_t *chunk, size_t chunk_size)
 {
-	return dfu_target_write(chunk, chunk_size);
+	int err = dfu_target_write(chunk, chunk_size);
+#ifdef CONFIG_SIDEWALK_STORAGE_STATS
+	if (!err) {
+		sid_storage_stats_source_write(SID_STORAGE_STATS_DFU_IMAGE, chunk_size);
+	}
+#endif /* CONFIG_SIDEWALK_STORAGE_STATS */
+	return err;
 }
 
 static int close(bool success)